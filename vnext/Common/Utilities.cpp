@@ -3,57 +3,367 @@
 
 #include "Utilities.h"
 
-// Boost Library
-#include <boost/archive/iterators/base64_from_binary.hpp>
-#include <boost/archive/iterators/binary_from_base64.hpp>
-#include <boost/archive/iterators/ostream_iterator.hpp>
-#include <boost/archive/iterators/transform_width.hpp>
+// Standard Library
+#include <cstring>
 
-// Windows API
-#include <winrt/Windows.Security.Cryptography.h>
+// SSSE3 is not part of the x86 and x64 baselines, so its code paths are chosen at run time.
+#if (defined(_M_X64) && !defined(_M_ARM64EC)) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define RN_BASE64_SSSE3 1
+#include <tmmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define RN_BASE64_TARGET_SSSE3
+#else
+#define RN_BASE64_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+#else
+#define RN_BASE64_SSSE3 0
+#endif
 
-// Standard Library
-#include <sstream>
+#if defined(_M_ARM64) || defined(__aarch64__)
+#define RN_BASE64_NEON 1
+#include <arm_neon.h>
+#else
+#define RN_BASE64_NEON 0
+#endif
 
+using std::optional;
 using std::string;
 using std::string_view;
-using std::wstring_view;
-using winrt::array_view;
-
-using winrt::Windows::Security::Cryptography::BinaryStringEncoding;
-using winrt::Windows::Security::Cryptography::CryptographicBuffer;
 
 namespace Microsoft::React::Utilities {
 
-string DecodeBase64(string_view base64) noexcept {
-  typedef array_view<char const> av_t;
-  auto bytes = av_t(base64.data(), static_cast<av_t::size_type>(base64.size()));
+namespace {
+
+constexpr char EncodeTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Values above 63 in DecodeTable.
+constexpr uint8_t Padding = 0xfd;
+constexpr uint8_t Whitespace = 0xfe;
+constexpr uint8_t Invalid = 0xff;
+
+struct DecodeTableType {
+  uint8_t Values[256];
+
+  constexpr DecodeTableType() noexcept : Values{} {
+    for (auto &value : Values) {
+      value = Invalid;
+    }
+    for (uint8_t i = 0; i < 64; ++i) {
+      Values[static_cast<uint8_t>(EncodeTable[i])] = i;
+    }
+    Values['='] = Padding;
+    // ASCII whitespace, as skipped by atob (https://infra.spec.whatwg.org/#ascii-whitespace).
+    Values['\t'] = Values['\n'] = Values['\f'] = Values['\r'] = Values[' '] = Whitespace;
+  }
+};
+
+constexpr DecodeTableType DecodeTable;
 
-  using namespace boost::archive::iterators;
-  typedef transform_width<binary_from_base64<const char *>, 8, 6> decode_base64;
-  std::ostringstream oss;
-  std::copy(decode_base64(bytes.cbegin()), decode_base64(bytes.cend()), ostream_iterator<char>(oss));
+#if RN_BASE64_SSSE3
 
-  return oss.str();
+bool HasSsse3() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 1);
+  return (info[2] & (1 << 9)) != 0;
+#else
+  return __builtin_cpu_supports("ssse3");
+#endif
 }
 
-// https://www.boost.org/doc/libs/1_76_0/libs/serialization/doc/dataflow.html
-string EncodeBase64(string_view text) noexcept {
-  typedef array_view<char const> av_t;
-  auto bytes = av_t(text.data(), static_cast<av_t::size_type>(text.size()));
+bool UseSsse3() noexcept {
+  static const bool useSsse3 = HasSsse3();
+  return useSsse3;
+}
+
+// Encodes 12 bytes of each 16 bytes loaded, and returns the number of bytes encoded.
+// See http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html.
+RN_BASE64_TARGET_SSSE3 size_t EncodeBlocksSsse3(const uint8_t *bytes, size_t size, char *output) noexcept {
+  const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  const __m128i shiftLut = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+  size_t encoded = 0;
+  for (; size - encoded >= 16; encoded += 12, output += 16) {
+    auto in = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + encoded)), shuffle);
+
+    // Spreads the 24 bits of each group over the low 6 bits of 4 bytes.
+    auto ac = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+    auto bd = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+    auto indices = _mm_or_si128(ac, bd);
+
+    // Maps 0-25 to 13, 26-51 to 0 and 52-63 to 1-12, which index the offset from each value to its character.
+    auto ranges = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    ranges = _mm_or_si128(ranges, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+    auto chars = _mm_add_epi8(indices, _mm_shuffle_epi8(shiftLut, ranges));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output), chars);
+  }
+  return encoded;
+}
+
+// Decodes 16 characters at a time, until one of them is not in the alphabet, and returns the number of characters
+// decoded. See http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html.
+RN_BASE64_TARGET_SSSE3 size_t DecodeBlocksSsse3(const char *base64, size_t size, uint8_t *output) noexcept {
+  // Flags of each low and high nibble, that share a bit for the characters outside the alphabet.
+  const __m128i lutLo = _mm_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+  const __m128i lutHi = _mm_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  // The offset from the characters to their values, by high nibble, and for '/'.
+  const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i mask2f = _mm_set1_epi8(0x2f);
+  const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+  size_t decoded = 0;
+  for (; size - decoded >= 16; decoded += 16, output += 12) {
+    auto in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(base64 + decoded));
+    auto hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask2f);
+    auto loNibbles = _mm_and_si128(in, mask2f);
+    auto flags = _mm_and_si128(_mm_shuffle_epi8(lutLo, loNibbles), _mm_shuffle_epi8(lutHi, hiNibbles));
+    if (_mm_movemask_epi8(_mm_cmpgt_epi8(flags, _mm_setzero_si128())) != 0) {
+      break;
+    }
+
+    auto roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(_mm_cmpeq_epi8(in, mask2f), hiNibbles));
+    auto values = _mm_add_epi8(in, roll);
+
+    // Joins each 4 values of 6 bits into 3 bytes.
+    auto pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    auto groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    alignas(16) uint8_t bytes[16];
+    _mm_store_si128(reinterpret_cast<__m128i *>(bytes), _mm_shuffle_epi8(groups, pack));
+    std::memcpy(output, bytes, 12);
+  }
+  return decoded;
+}
+
+#endif // RN_BASE64_SSSE3
+
+#if RN_BASE64_NEON
+
+uint8x16x4_t LoadTable(const uint8_t *table) noexcept {
+  uint8x16x4_t result;
+  result.val[0] = vld1q_u8(table);
+  result.val[1] = vld1q_u8(table + 16);
+  result.val[2] = vld1q_u8(table + 32);
+  result.val[3] = vld1q_u8(table + 48);
+  return result;
+}
+
+// Encodes 48 bytes at a time, and returns the number of bytes encoded.
+size_t EncodeBlocksNeon(const uint8_t *bytes, size_t size, char *output) noexcept {
+  auto table = LoadTable(reinterpret_cast<const uint8_t *>(EncodeTable));
+  auto mask3f = vdupq_n_u8(0x3f);
+
+  size_t encoded = 0;
+  for (; size - encoded >= 48; encoded += 48, output += 64) {
+    auto in = vld3q_u8(bytes + encoded);
+
+    uint8x16x4_t indices;
+    indices.val[0] = vshrq_n_u8(in.val[0], 2);
+    indices.val[1] = vandq_u8(vorrq_u8(vshrq_n_u8(in.val[1], 4), vshlq_n_u8(in.val[0], 4)), mask3f);
+    indices.val[2] = vandq_u8(vorrq_u8(vshrq_n_u8(in.val[2], 6), vshlq_n_u8(in.val[1], 2)), mask3f);
+    indices.val[3] = vandq_u8(in.val[2], mask3f);
+
+    uint8x16x4_t chars;
+    for (int i = 0; i < 4; ++i) {
+      chars.val[i] = vqtbl4q_u8(table, indices.val[i]);
+    }
+    vst4q_u8(reinterpret_cast<uint8_t *>(output), chars);
+  }
+  return encoded;
+}
+
+// Decodes 64 characters at a time, until one of them is not in the alphabet, and returns the number of characters
+// decoded.
+size_t DecodeBlocksNeon(const char *base64, size_t size, uint8_t *output) noexcept {
+  auto tableLo = LoadTable(DecodeTable.Values);
+  auto tableHi = LoadTable(DecodeTable.Values + 64);
+  auto offset = vdupq_n_u8(64);
+  auto mask80 = vdupq_n_u8(0x80);
+
+  size_t decoded = 0;
+  for (; size - decoded >= 64; decoded += 64, output += 48) {
+    auto in = vld4q_u8(reinterpret_cast<const uint8_t *>(base64 + decoded));
+
+    uint8x16x4_t values;
+    auto flags = vdupq_n_u8(0);
+    for (int i = 0; i < 4; ++i) {
+      // Looks up the characters below 64 in the first table, and the ones from 64 to 127 in the second.
+      values.val[i] = vqtbx4q_u8(vqtbl4q_u8(tableLo, in.val[i]), tableHi, vsubq_u8(in.val[i], offset));
+      flags = vorrq_u8(flags, vorrq_u8(values.val[i], vandq_u8(in.val[i], mask80)));
+    }
+    if (vmaxvq_u8(flags) > 63) {
+      break;
+    }
+
+    uint8x16x3_t bytes;
+    bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+    bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+    bytes.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+    vst3q_u8(output, bytes);
+  }
+  return decoded;
+}
+
+#endif // RN_BASE64_NEON
+
+// The number of bytes encoded, or characters decoded, with vector instructions.
+#if RN_BASE64_SSSE3
+
+size_t EncodeBlocks(const uint8_t *bytes, size_t size, char *output) noexcept {
+  return UseSsse3() ? EncodeBlocksSsse3(bytes, size, output) : 0;
+}
+
+size_t DecodeBlocks(const char *base64, size_t size, uint8_t *output) noexcept {
+  return UseSsse3() ? DecodeBlocksSsse3(base64, size, output) : 0;
+}
+
+#elif RN_BASE64_NEON
+
+size_t EncodeBlocks(const uint8_t *bytes, size_t size, char *output) noexcept {
+  return EncodeBlocksNeon(bytes, size, output);
+}
+
+size_t DecodeBlocks(const char *base64, size_t size, uint8_t *output) noexcept {
+  return DecodeBlocksNeon(base64, size, output);
+}
+
+#else
+
+size_t EncodeBlocks(const uint8_t *, size_t, char *) noexcept {
+  return 0;
+}
+
+size_t DecodeBlocks(const char *, size_t, uint8_t *) noexcept {
+  return 0;
+}
+
+#endif
+
+} // namespace
 
-  using namespace boost::archive::iterators;
-  typedef base64_from_binary<transform_width<const char *, 6, 8>> encode_base64;
-  std::ostringstream oss;
-  std::copy(encode_base64(bytes.cbegin()), encode_base64(bytes.cend()), ostream_iterator<char>(oss));
+void EncodeBase64(const uint8_t *bytes, size_t size, char *output) noexcept {
+  size_t i = EncodeBlocks(bytes, size, output);
+  output += i / 3 * 4;
 
-  // https://unix.stackexchange.com/questions/631501
-  size_t padLength = (4 - (oss.tellp() % 4)) % 4;
-  for (size_t i = 0; i < padLength; ++i) {
-    oss << '=';
+  for (; size - i >= 3; i += 3, output += 4) {
+    uint32_t group = (bytes[i] << 16) | (bytes[i + 1] << 8) | bytes[i + 2];
+    output[0] = EncodeTable[group >> 18];
+    output[1] = EncodeTable[(group >> 12) & 0x3f];
+    output[2] = EncodeTable[(group >> 6) & 0x3f];
+    output[3] = EncodeTable[group & 0x3f];
   }
 
-  return oss.str();
+  if (size - i == 1) {
+    output[0] = EncodeTable[bytes[i] >> 2];
+    output[1] = EncodeTable[(bytes[i] & 0x03) << 4];
+    output[2] = output[3] = '=';
+  } else if (size - i == 2) {
+    output[0] = EncodeTable[bytes[i] >> 2];
+    output[1] = EncodeTable[((bytes[i] & 0x03) << 4) | (bytes[i + 1] >> 4)];
+    output[2] = EncodeTable[(bytes[i + 1] & 0x0f) << 2];
+    output[3] = '=';
+  }
+}
+
+// Follows https://infra.spec.whatwg.org/#forgiving-base64-decode.
+optional<size_t> DecodeBase64(string_view base64, uint8_t *output) noexcept {
+  const auto *values = DecodeTable.Values;
+  const char *in = base64.data();
+  const char *end = in + base64.size();
+  uint8_t *out = output;
+
+  // The values of an incomplete group, interrupted by whitespace.
+  uint32_t group = 0;
+  int count = 0;
+
+  while (in != end) {
+    if (count == 0) {
+      auto decoded = DecodeBlocks(in, end - in, out);
+      in += decoded;
+      out += decoded / 4 * 3;
+
+      for (; end - in >= 4; in += 4, out += 3) {
+        uint32_t a = values[static_cast<uint8_t>(in[0])];
+        uint32_t b = values[static_cast<uint8_t>(in[1])];
+        uint32_t c = values[static_cast<uint8_t>(in[2])];
+        uint32_t d = values[static_cast<uint8_t>(in[3])];
+        if ((a | b | c | d) > 63) {
+          break;
+        }
+        group = (a << 18) | (b << 12) | (c << 6) | d;
+        out[0] = static_cast<uint8_t>(group >> 16);
+        out[1] = static_cast<uint8_t>(group >> 8);
+        out[2] = static_cast<uint8_t>(group);
+      }
+      group = 0;
+      if (in == end) {
+        break;
+      }
+    }
+
+    auto value = values[static_cast<uint8_t>(*in++)];
+    if (value < 64) {
+      group = (group << 6) | value;
+      if (++count == 4) {
+        out[0] = static_cast<uint8_t>(group >> 16);
+        out[1] = static_cast<uint8_t>(group >> 8);
+        out[2] = static_cast<uint8_t>(group);
+        out += 3;
+        group = 0;
+        count = 0;
+      }
+    } else if (value == Padding) {
+      // Only whitespace and the rest of the padding can follow, which completes the last group.
+      int padding = 1;
+      for (; in != end; ++in) {
+        value = values[static_cast<uint8_t>(*in)];
+        if (value == Padding) {
+          ++padding;
+        } else if (value != Whitespace) {
+          return std::nullopt;
+        }
+      }
+      if (count < 2 || count + padding != 4) {
+        return std::nullopt;
+      }
+    } else if (value != Whitespace) {
+      return std::nullopt;
+    }
+  }
+
+  // The bits of the last characters beyond the last byte are ignored.
+  if (count == 1) {
+    return std::nullopt;
+  } else if (count == 2) {
+    *out++ = static_cast<uint8_t>(group >> 4);
+  } else if (count == 3) {
+    *out++ = static_cast<uint8_t>(group >> 10);
+    *out++ = static_cast<uint8_t>(group >> 2);
+  }
+
+  return static_cast<size_t>(out - output);
+}
+
+string DecodeBase64(string_view base64) noexcept {
+  string result(Base64DecodedMaxSize(base64.size()), '\0');
+  auto size = DecodeBase64(base64, reinterpret_cast<uint8_t *>(result.data()));
+  if (!size) {
+    return {};
+  }
+
+  result.resize(*size);
+  return result;
+}
+
+string EncodeBase64(string_view text) noexcept {
+  string result(Base64EncodedSize(text.size()), '\0');
+  EncodeBase64(reinterpret_cast<const uint8_t *>(text.data()), text.size(), result.data());
+  return result;
 }
 
 } // namespace Microsoft::React::Utilities
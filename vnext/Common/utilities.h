@@ -4,7 +4,10 @@
 #pragma once
 
 // Standard Library
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
@@ -43,6 +46,29 @@ constexpr std::size_t ArraySize(T (&)[N]) noexcept {
 
 namespace Microsoft::React::Utilities {
 
+// Base64 uses the standard alphabet and padding (RFC 4648, section 4). Encoding and decoding process 12 bytes at a time
+// with SSSE3 on x86 and x64 processors that have it, 48 bytes at a time with NEON on ARM64, and one group of 3 bytes at
+// a time otherwise.
+
+// The number of characters `size` bytes encode to, padding included.
+constexpr size_t Base64EncodedSize(size_t size) noexcept {
+  return (size + 2) / 3 * 4;
+}
+
+// The most bytes `size` characters decode to.
+constexpr size_t Base64DecodedMaxSize(size_t size) noexcept {
+  return size / 4 * 3 + (size % 4) * 3 / 4;
+}
+
+// Encodes `size` bytes to the Base64EncodedSize(size) characters at `output`.
+void EncodeBase64(const uint8_t *bytes, size_t size, char *output) noexcept;
+
+// Decodes `base64` to the bytes at `output`, which has room for Base64DecodedMaxSize(base64.size()) bytes, and returns
+// their number. Like browsers do for data URIs and atob, padding is optional and ASCII whitespace is ignored. Returns
+// std::nullopt when `base64` is not valid Base64.
+std::optional<size_t> DecodeBase64(std::string_view base64, uint8_t *output) noexcept;
+
+// Returns an empty string when `text` is not valid Base64.
 std::string DecodeBase64(std::string_view text) noexcept;
 
 std::string EncodeBase64(std::string_view text) noexcept;
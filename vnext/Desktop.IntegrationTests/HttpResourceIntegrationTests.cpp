@@ -6,6 +6,7 @@
 
 #include <CppUnitTest.h>
 
+#include <Networking/HttpDiskCache.h>
 #include <Networking/IHttpResource.h>
 #include <Networking/OriginPolicy.h>
 #include <RuntimeOptions.h>
@@ -23,6 +24,7 @@ using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
 namespace http = boost::beast::http;
 
+using Networking::HttpDiskCache;
 using Networking::IHttpResource;
 using Networking::OriginPolicy;
 using std::make_shared;
@@ -43,6 +45,9 @@ TEST_CLASS (HttpResourceIntegrationTest) {
   TEST_METHOD_CLEANUP(MethodCleanup) {
     // Clear any runtime options that may be used by tests in this class.
     MicrosoftReactSetRuntimeOptionString("Http.UserAgent", nullptr);
+    MicrosoftReactSetRuntimeOptionInt("Http.ResponseHighWaterMark", 0);
+    MicrosoftReactSetRuntimeOptionInt("Http.DiskCacheCapacity", 0);
+    MicrosoftReactSetRuntimeOptionString("Http.DiskCacheDirectory", nullptr);
 
     // Bug in test HTTP server does not correctly release TCP port between test methods.
     // Using a different por per test for now.
@@ -723,6 +728,165 @@ TEST_CLASS (HttpResourceIntegrationTest) {
     Assert::AreEqual(200, statusCode);
     Assert::AreEqual({"123444"}, result);
   }
+
+  TEST_METHOD(GetDiskCacheRevalidatesAcrossResourcesSucceeds) {
+    string url = "http://localhost:" + std::to_string(s_port) + "/image.png";
+
+    char tempPath[MAX_PATH];
+    Assert::IsTrue(GetTempPathA(MAX_PATH, tempPath) != 0);
+    auto cacheDirectory = string{tempPath} + "rnwhttp_integration_" + std::to_string(GetCurrentProcessId()) + "_" +
+        std::to_string(s_port) + "\\";
+    MicrosoftReactSetRuntimeOptionInt("Http.DiskCacheCapacity", 1024 * 1024);
+    MicrosoftReactSetRuntimeOptionString("Http.DiskCacheDirectory", cacheDirectory.c_str());
+
+    int getCount = 0;
+    int notModifiedCount = 0;
+    auto server = make_shared<HttpServer>(s_port);
+    server->Callbacks().OnGet = [&getCount, &notModifiedCount](const DynamicRequest &request) -> ResponseWrapper {
+      ++getCount;
+      if (request[http::field::if_none_match] == "\"v1\"") {
+        ++notModifiedCount;
+        return {EmptyResponse{http::status::not_modified, request.version()}};
+      }
+
+      DynamicResponse response;
+      response.result(http::status::ok);
+      // Stored, but revalidated before every use.
+      response.set(http::field::cache_control, "no-cache");
+      response.set(http::field::etag, "\"v1\"");
+      response.body() = Test::CreateStringResponseBody("cached content");
+
+      return {std::move(response)};
+    };
+    server->Start();
+
+    // Each resource stands for a run of the app.
+    vector<string> results;
+    string error;
+    for (int run = 0; run < 3; ++run) {
+      promise<void> resPromise;
+      string result;
+      auto resource = IHttpResource::Make();
+      resource->SetOnData([&resPromise, &result](int64_t, string &&content) {
+        result = std::move(content);
+        resPromise.set_value();
+      });
+      resource->SetOnError([&resPromise, &error](int64_t, string &&message, bool) {
+        error = std::move(message);
+        resPromise.set_value();
+      });
+      resource->SendRequest(
+          "GET",
+          string{url},
+          0, /*requestId*/
+          {}, /*headers*/
+          {}, /*data*/
+          "text",
+          false, /*incremental*/
+          0 /*timeout*/,
+          false /*withCredentials*/,
+          [](int64_t) {});
+
+      // Synchronize response.
+      resPromise.get_future().wait();
+      results.push_back(std::move(result));
+    }
+    server->Stop();
+
+    auto stats = HttpDiskCache::Default()->Stats();
+    auto cacheFiles = cacheDirectory + "*";
+    WIN32_FIND_DATAA findData;
+    if (HANDLE find = FindFirstFileA(cacheFiles.c_str(), &findData); find != INVALID_HANDLE_VALUE) {
+      do {
+        DeleteFileA((cacheDirectory + findData.cFileName).c_str());
+      } while (FindNextFileA(find, &findData));
+      FindClose(find);
+    }
+    RemoveDirectoryA(cacheDirectory.c_str());
+
+    Assert::AreEqual({}, error);
+    Assert::AreEqual(size_t{3}, results.size());
+    for (const auto &result : results) {
+      Assert::AreEqual({"cached content"}, result);
+    }
+    Assert::AreEqual(3, getCount);
+    Assert::AreEqual(2, notModifiedCount);
+    Assert::AreEqual(uint64_t{1}, stats.Misses);
+    Assert::AreEqual(uint64_t{2}, stats.NotModified);
+  }
+
+  TEST_METHOD(GetIncrementalTextSucceeds) {
+    string url = "http://localhost:" + std::to_string(s_port);
+
+    constexpr int32_t highWaterMark = 64 * 1024;
+    MicrosoftReactSetRuntimeOptionInt("Http.ResponseHighWaterMark", highWaterMark);
+
+    string content(1024 * 1024 + 7, '\0');
+    for (size_t i = 0; i < content.size(); ++i) {
+      content[i] = static_cast<char>('a' + i % 26);
+    }
+
+    promise<void> completePromise;
+    string error;
+    string received;
+    size_t chunkCount = 0;
+    size_t maxChunkSize = 0;
+    int64_t lastProgress = 0;
+    int64_t lastTotal = 0;
+    bool progressMatches = true;
+
+    auto server = make_shared<HttpServer>(s_port);
+    server->Callbacks().OnGet = [&content](const DynamicRequest &request) -> ResponseWrapper {
+      DynamicResponse response;
+      response.result(http::status::ok);
+      response.body() = Test::CreateStringResponseBody(string{content});
+      response.prepare_payload();
+
+      return {std::move(response)};
+    };
+    server->Start();
+
+    auto resource = IHttpResource::Make();
+    resource->SetOnIncrementalData([&](int64_t, string &&chunk, int64_t progress, int64_t total) {
+      received += chunk;
+      ++chunkCount;
+      if (chunk.size() > maxChunkSize) {
+        maxChunkSize = chunk.size();
+      }
+      progressMatches = progressMatches && progress == static_cast<int64_t>(received.size());
+      lastProgress = progress;
+      lastTotal = total;
+    });
+    resource->SetOnData([&error](int64_t, string &&) { error = "Unexpected accumulated data"; });
+    resource->SetOnResponseComplete([&completePromise](int64_t) { completePromise.set_value(); });
+    resource->SetOnError([&completePromise, &error](int64_t, string &&message, bool) {
+      error = std::move(message);
+      completePromise.set_value();
+    });
+    resource->SendRequest(
+        "GET",
+        std::move(url),
+        0, /*requestId*/
+        {}, /*headers*/
+        {}, /*data*/
+        "text",
+        true, /*useIncrementalUpdates*/
+        0 /*timeout*/,
+        false /*withCredentials*/,
+        [](int64_t) {});
+
+    // Synchronize response.
+    completePromise.get_future().wait();
+    server->Stop();
+
+    Assert::AreEqual({}, error);
+    Assert::IsTrue(content == received);
+    Assert::IsTrue(chunkCount >= content.size() / highWaterMark);
+    Assert::IsTrue(maxChunkSize <= static_cast<size_t>(highWaterMark));
+    Assert::IsTrue(progressMatches);
+    Assert::AreEqual(static_cast<int64_t>(content.size()), lastProgress);
+    Assert::AreEqual(static_cast<int64_t>(content.size()), lastTotal);
+  }
 };
 
 /*static*/ uint16_t HttpResourceIntegrationTest::s_port = 4444;
@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include "../Microsoft.ReactNative/Modules/Animated/AnimatedNodeEvaluationPlan.h"
+#include "../Microsoft.ReactNative/Modules/Animated/ValueAnimatedNode.h"
+
+// Standard Library
+#include <algorithm>
+#include <unordered_set>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::ReactNative::AnimatedNode;
+using Microsoft::ReactNative::AnimatedNodeEvaluationPlan;
+using Microsoft::ReactNative::AnimatedNodeKind;
+using Microsoft::ReactNative::ValueAnimatedNode;
+using std::unique_ptr;
+using std::vector;
+using winrt::Microsoft::ReactNative::JSValueObject;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (AnimatedNodeEvaluationPlanTest) {
+  static JSValueObject NodeConfig() {
+    return JSValueObject{{"platformConfig", JSValueObject{{"useComposition", false}}}};
+  }
+
+  // Records the order in which nodes are updated.
+  class RecordingNode final : public AnimatedNode {
+    vector<int64_t> &m_updates;
+
+   public:
+    RecordingNode(int64_t tag, vector<int64_t> &updates)
+        : AnimatedNode(tag, NodeConfig(), nullptr), m_updates{updates} {}
+
+    void Update() override {
+      m_updates.push_back(Tag());
+    }
+  };
+
+  // Linear interpolation of a parent value, as InterpolationAnimatedNode computes without a node manager.
+  class LinearInterpolationNode final : public ValueAnimatedNode {
+    ValueAnimatedNode &m_parent;
+    double m_outputStart;
+    double m_outputEnd;
+
+   public:
+    LinearInterpolationNode(int64_t tag, ValueAnimatedNode &parent, double outputStart, double outputEnd)
+        : ValueAnimatedNode(tag, NodeConfig(), nullptr),
+          m_parent{parent},
+          m_outputStart{outputStart},
+          m_outputEnd{outputEnd} {}
+
+    void Update() override {
+      RawValue(m_outputStart + m_parent.Value() * (m_outputEnd - m_outputStart));
+    }
+  };
+
+  TEST_METHOD(UpdatesReachableNodesAfterTheirParents) {
+    // 1 -> 3, 2 -> 3, 3 -> 4, 5
+    vector<int64_t> updates;
+    vector<unique_ptr<RecordingNode>> nodes;
+    for (int64_t tag = 1; tag <= 5; ++tag) {
+      nodes.push_back(std::make_unique<RecordingNode>(tag, updates));
+    }
+    nodes[0]->Children() = {3};
+    nodes[1]->Children() = {3, /*missing*/ 42};
+    nodes[2]->Children() = {4};
+
+    // Pass the nodes in reverse to make sure the plan does not depend on the input order.
+    vector<std::pair<AnimatedNode *, AnimatedNodeKind>> planNodes;
+    for (auto it = nodes.rbegin(); it != nodes.rend(); ++it) {
+      planNodes.emplace_back(it->get(), AnimatedNodeKind::Other);
+    }
+
+    AnimatedNodeEvaluationPlan plan;
+    Assert::IsFalse(plan.IsValid());
+    plan.Build(planNodes);
+    Assert::IsTrue(plan.IsValid());
+    Assert::AreEqual(static_cast<size_t>(5), plan.Size());
+
+    plan.Run({1});
+    Assert::IsTrue(vector<int64_t>{1, 3, 4} == updates);
+
+    updates.clear();
+    plan.Run({1, 2, /*unknown*/ 7});
+    Assert::AreEqual(static_cast<size_t>(4), updates.size());
+    Assert::IsTrue(std::find(updates.begin(), updates.end(), 3) > std::find(updates.begin(), updates.end(), 1));
+    Assert::IsTrue(std::find(updates.begin(), updates.end(), 3) > std::find(updates.begin(), updates.end(), 2));
+    Assert::AreEqual(static_cast<int64_t>(4), updates.back());
+
+    updates.clear();
+    plan.Run({5});
+    Assert::IsTrue(vector<int64_t>{5} == updates);
+
+    plan.Invalidate();
+    Assert::IsFalse(plan.IsValid());
+  }
+
+  // 1,000 concurrent animations, each driving a value node through two interpolation nodes, give the same values
+  // every frame whether the plan is reused across frames or rebuilt for each frame.
+  TEST_METHOD(ReusedPlanMatchesRebuiltPlan) {
+    constexpr int animationCount = 1000;
+    constexpr int frameCount = 120;
+
+    vector<unique_ptr<ValueAnimatedNode>> values;
+    vector<unique_ptr<ValueAnimatedNode>> interpolations;
+    vector<std::pair<AnimatedNode *, AnimatedNodeKind>> planNodes;
+    for (int64_t i = 0; i < animationCount; ++i) {
+      auto &value = values.emplace_back(std::make_unique<ValueAnimatedNode>(i * 3, NodeConfig(), nullptr));
+      auto &opacity = interpolations.emplace_back(std::make_unique<LinearInterpolationNode>(i * 3 + 1, *value, 0, 1));
+      auto &translate =
+          interpolations.emplace_back(std::make_unique<LinearInterpolationNode>(i * 3 + 2, *opacity, -100, 100));
+      value->Children().push_back(opacity->Tag());
+      opacity->Children().push_back(translate->Tag());
+
+      planNodes.emplace_back(value.get(), AnimatedNodeKind::Value);
+      planNodes.emplace_back(opacity.get(), AnimatedNodeKind::Value);
+      planNodes.emplace_back(translate.get(), AnimatedNodeKind::Value);
+    }
+
+    // Returns the interpolated values of every frame.
+    auto runFrames = [&](bool rebuildEveryFrame) {
+      AnimatedNodeEvaluationPlan plan;
+      std::unordered_set<int64_t> updatedNodes;
+      vector<double> results;
+      for (int frame = 1; frame <= frameCount; ++frame) {
+        // Step every animation, as the frame animation drivers do, and update the dependent nodes.
+        updatedNodes.clear();
+        for (auto &value : values) {
+          value->RawValue(static_cast<double>(frame) / frameCount);
+          updatedNodes.insert(value->Tag());
+        }
+        if (rebuildEveryFrame || !plan.IsValid()) {
+          plan.Build(planNodes);
+        }
+        plan.Run(updatedNodes);
+
+        for (auto &interpolation : interpolations) {
+          results.push_back(interpolation->Value());
+        }
+      }
+
+      return results;
+    };
+
+    auto rebuiltResults = runFrames(/*rebuildEveryFrame*/ true);
+    auto reusedResults = runFrames(/*rebuildEveryFrame*/ false);
+
+    Assert::IsTrue(rebuiltResults == reusedResults);
+    for (int i = 0; i < animationCount; ++i) {
+      Assert::AreEqual(100.0, interpolations[i * 2 + 1]->Value());
+    }
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include "../Microsoft.ReactNative/Modules/Animated/AnimationKernels.h"
+#include "../Microsoft.ReactNative/Modules/Animated/AnimationUtils.h"
+
+// Standard Library
+#include <cmath>
+#include <random>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::ReactNative::DecayBatch;
+using Microsoft::ReactNative::EvaluateDecays;
+using Microsoft::ReactNative::EvaluateInterpolations;
+using Microsoft::ReactNative::EvaluateSprings;
+using Microsoft::ReactNative::InterpolationBatch;
+using Microsoft::ReactNative::SpringBatch;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (AnimationKernelsTest) {
+  // The formulas of SpringAnimationDriver::GetValueAndVelocityForTime.
+  static std::pair<double, double> SpringValueAndVelocity(
+      double time,
+      double startValue,
+      double toValue,
+      double k,
+      double c,
+      double m,
+      double initialVelocity) {
+    const auto v0 = -initialVelocity;
+    const auto zeta = c / (2 * std::sqrt(k * m));
+    const auto omega0 = std::sqrt(k / m);
+    const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
+    const auto x0 = toValue - startValue;
+
+    if (zeta < 1) {
+      const auto envelope = std::exp(-zeta * omega0 * time);
+      const auto value = toValue -
+          envelope * ((v0 + zeta * omega0 * x0) / omega1 * std::sin(omega1 * time) + x0 * std::cos(omega1 * time));
+      const auto velocity = zeta * omega0 * envelope *
+              (std::sin(omega1 * time) * (v0 + zeta * omega0 * x0) / omega1 + x0 * std::cos(omega1 * time)) -
+          envelope * (std::cos(omega1 * time) * (v0 + zeta * omega0 * x0) - omega1 * x0 * std::sin(omega1 * time));
+      return {value, velocity};
+    } else {
+      const auto envelope = std::exp(-omega0 * time);
+      const auto value = toValue - envelope * (x0 + (v0 + omega0 * x0) * time);
+      const auto velocity = envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
+      return {value, velocity};
+    }
+  }
+
+  // The formula of DecayAnimationDriver::GetValueAndVelocityForTime.
+  static double DecayValue(double time, double startValue, double velocity, double deceleration) {
+    return startValue + velocity / (1 - deceleration) * (1 - std::exp(-(1 - deceleration) * (1000 * time)));
+  }
+
+  static void AddInterpolations(InterpolationBatch &batch, size_t count) {
+    std::mt19937 random{42};
+    std::uniform_real_distribution<double> distribution{-2.0, 2.0};
+    for (size_t i = 0; i < count; ++i) {
+      const auto inputMin = distribution(random);
+      // Include empty and inverted input ranges, and values on the range bounds.
+      const auto inputMax = i % 17 == 0 ? inputMin
+          : i % 31 == 0                 ? inputMin - 1
+                                        : inputMin + std::abs(distribution(random));
+      const auto value = i % 13 == 0 ? inputMin : 2 * distribution(random);
+      batch.Add(
+          value,
+          inputMin,
+          inputMax,
+          distribution(random),
+          distribution(random),
+          static_cast<ExtrapolationType>(i % 3),
+          static_cast<ExtrapolationType>(i / 3 % 3));
+    }
+  }
+
+  TEST_METHOD(InterpolationsMatchScalarInterpolation) {
+    InterpolationBatch batch;
+    AddInterpolations(batch, 1001);
+    EvaluateInterpolations(batch);
+
+    Assert::AreEqual(batch.Size(), batch.Results.size());
+    for (size_t i = 0; i < batch.Size(); ++i) {
+      const auto expected = Interpolate(
+          batch.Values[i],
+          batch.InputMin[i],
+          batch.InputMax[i],
+          batch.OutputMin[i],
+          batch.OutputMax[i],
+          batch.ExtrapolateLeft[i],
+          batch.ExtrapolateRight[i]);
+      Assert::AreEqual(expected, batch.Results[i]);
+    }
+
+    batch.Clear();
+    EvaluateInterpolations(batch);
+    Assert::AreEqual(static_cast<size_t>(0), batch.Results.size());
+  }
+
+  TEST_METHOD(SpringsMatchScalarSprings) {
+    SpringBatch batch;
+    for (int i = 0; i < 301; ++i) {
+      // Underdamped, critically damped and overdamped springs.
+      const auto damping = i % 3 == 0 ? 10.0 : i % 3 == 1 ? 20.0 : 40.0;
+      batch.Add(i / 60.0, 0, 100, 100, damping, 1, i % 5);
+    }
+    EvaluateSprings(batch);
+
+    for (size_t i = 0; i < batch.Size(); ++i) {
+      const auto [value, velocity] = SpringValueAndVelocity(
+          batch.Times[i],
+          batch.StartValues[i],
+          batch.EndValues[i],
+          batch.Stiffness[i],
+          batch.Damping[i],
+          batch.Mass[i],
+          batch.InitialVelocities[i]);
+      Assert::AreEqual(value, batch.Values[i], 1e-9);
+      Assert::AreEqual(velocity, batch.Velocities[i], 1e-9);
+    }
+  }
+
+  TEST_METHOD(DecaysMatchScalarDecays) {
+    DecayBatch batch;
+    for (int i = 0; i < 301; ++i) {
+      batch.Add(i / 60.0, 1, 2, 0.997);
+    }
+    EvaluateDecays(batch);
+
+    for (size_t i = 0; i < batch.Size(); ++i) {
+      Assert::AreEqual(
+          DecayValue(batch.Times[i], batch.StartValues[i], batch.Velocities[i], batch.Decelerations[i]),
+          batch.Values[i],
+          1e-9);
+    }
+  }
+};
+
+} // namespace Microsoft::React::Test
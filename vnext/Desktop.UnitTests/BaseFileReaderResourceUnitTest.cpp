@@ -25,7 +25,7 @@ TEST_CLASS (BaseFileReaderResourceUnitTest) {
      public:
 #pragma region IBlobPersistor
 
-      array_view<uint8_t const> ResolveMessage(string &&blobId, int64_t offset, int64_t size) override {
+      BlobContent ResolveMessage(string &&blobId, int64_t offset, int64_t size) override {
         auto dataItr = m_blobs.find(std::move(blobId));
         // Not found.
         if (dataItr == m_blobs.cend())
@@ -37,7 +37,8 @@ TEST_CLASS (BaseFileReaderResourceUnitTest) {
         if (endBound > bytes.size() || offset >= static_cast<int64_t>(bytes.size()) || offset < 0)
           throw std::out_of_range("Offset or size out of range");
 
-        return array_view<uint8_t const>(bytes.data() + offset, bytes.data() + endBound);
+        // The blobs are never removed, so the content does not need an owner.
+        return BlobContent{nullptr, array_view<uint8_t const>(bytes.data() + offset, bytes.data() + endBound)};
       }
 
       void RemoveMessage(string && /*blobId*/) noexcept override {
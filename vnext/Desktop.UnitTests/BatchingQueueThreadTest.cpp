@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Threading/BatchingQueueThread.h>
+
+#include <chrono>
+#include <deque>
+#include <thread>
+#include <vector>
+
+using Microsoft::ReactNative::BatchingQueueCallInvoker;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+
+namespace {
+
+// Message queue thread that runs the posted tasks only when the test asks for it.
+struct ManualQueueThread : facebook::react::MessageQueueThread {
+  void runOnQueue(std::function<void()> &&func) override {
+    Tasks.push_back(std::move(func));
+  }
+
+  void runOnQueueSync(std::function<void()> &&func) override {
+    func();
+  }
+
+  void quitSynchronous() override {
+    RunAll();
+  }
+
+  // Runs the posted tasks including the tasks posted while running them. Returns the number of run tasks.
+  size_t RunAll() {
+    size_t taskCount = 0;
+    while (!Tasks.empty()) {
+      auto task = std::move(Tasks.front());
+      Tasks.pop_front();
+      task();
+      ++taskCount;
+    }
+
+    return taskCount;
+  }
+
+  std::deque<std::function<void()>> Tasks;
+};
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (BatchingQueueThreadTest) {
+  TEST_METHOD(BatchingQueueCallInvoker_RunsBatchOnBatchComplete) {
+    auto queueThread = std::make_shared<ManualQueueThread>();
+    auto invoker = std::make_shared<BatchingQueueCallInvoker>(queueThread);
+    std::vector<int> order;
+    for (int i = 0; i < 100; ++i) {
+      invoker->invokeAsync("test", [&order, i] { order.push_back(i); });
+    }
+
+    Assert::AreEqual(size_t{0}, queueThread->Tasks.size());
+
+    invoker->onBatchComplete();
+    Assert::AreEqual(size_t{1}, queueThread->RunAll());
+    Assert::AreEqual(size_t{100}, order.size());
+    for (int i = 0; i < 100; ++i) {
+      Assert::AreEqual(i, order[i]);
+    }
+  }
+
+  TEST_METHOD(BatchingQueueCallInvoker_PostsBatchWhenMaxBatchSizeReached) {
+    auto queueThread = std::make_shared<ManualQueueThread>();
+    auto invoker =
+        std::make_shared<BatchingQueueCallInvoker>(queueThread, BatchingQueueCallInvoker::DefaultSliceTimeBudget, 4);
+    int callCount = 0;
+    for (int i = 0; i < 10; ++i) {
+      invoker->invokeAsync("test", [&callCount] { ++callCount; });
+    }
+
+    queueThread->RunAll();
+    Assert::AreEqual(8, callCount);
+
+    invoker->onBatchComplete();
+    queueThread->RunAll();
+    Assert::AreEqual(10, callCount);
+  }
+
+  TEST_METHOD(BatchingQueueCallInvoker_YieldsBetweenSlices) {
+    auto queueThread = std::make_shared<ManualQueueThread>();
+    auto invoker = std::make_shared<BatchingQueueCallInvoker>(queueThread, std::chrono::milliseconds(1));
+    std::vector<int> order;
+    for (int i = 0; i < 10; ++i) {
+      invoker->invokeAsync("test", [&order, i] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        order.push_back(i);
+      });
+    }
+
+    invoker->onBatchComplete();
+
+    // The next batch must run after the remaining slices of the previous one.
+    for (int i = 10; i < 20; ++i) {
+      invoker->invokeAsync("test", [&order, i] { order.push_back(i); });
+    }
+
+    invoker->onBatchComplete();
+
+    // Each task of the first batch exceeds the time budget and must run in its own slice.
+    // The second batch runs in the next slice.
+    Assert::AreEqual(size_t{11}, queueThread->RunAll());
+    Assert::AreEqual(size_t{20}, order.size());
+    for (int i = 0; i < 20; ++i) {
+      Assert::AreEqual(i, order[i]);
+    }
+  }
+
+  TEST_METHOD(BatchingQueueCallInvoker_QuitRunsRemainingTasks) {
+    auto queueThread = std::make_shared<ManualQueueThread>();
+    auto invoker = std::make_shared<BatchingQueueCallInvoker>(queueThread, std::chrono::milliseconds(1));
+    int callCount = 0;
+    for (int i = 0; i < 10; ++i) {
+      invoker->invokeAsync("test", [&callCount] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        ++callCount;
+      });
+    }
+
+    invoker->quitSynchronous();
+    Assert::AreEqual(10, callCount);
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,214 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Executors/BinaryBridgeFraming.h>
+
+#include <folly/json.h>
+
+// Standard Library
+#include <cstdint>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::ReactNative::BinaryFrame;
+using Microsoft::ReactNative::BinaryFrameKind;
+using Microsoft::ReactNative::BinaryFrameReader;
+using Microsoft::ReactNative::BinaryFrameWriter;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (BinaryBridgeFramingTest) {
+  // Stands in for the debugger proxy on the other end of the WebSocket: answers each request with a flushed queue of
+  // native calls, in the framing of the request, as the proxy does once it accepted binary framing.
+  class LoopbackDebuggerProxy {
+   public:
+    std::string HandleJson(const std::string &message) {
+      auto request = folly::parseJson(message);
+      auto reply = folly::dynamic::object("replyID", request["id"])("result", folly::toJson(FlushedQueue(request)));
+      return folly::toJson(reply);
+    }
+
+    std::string HandleBinary(std::string_view message) {
+      std::string reply;
+      BinaryFrame frame;
+      size_t offset = 0;
+      while (m_reader.ReadFrame(message, offset, frame)) {
+        m_writer.WriteReply(reply, frame.Id, FlushedQueue(frame.Value));
+      }
+      return reply;
+    }
+
+   private:
+    // A typical reply to a timer or event call: one native call of module 3, method 7, with its arguments.
+    static folly::dynamic FlushedQueue(const folly::dynamic &request) {
+      return folly::dynamic::array(
+          folly::dynamic::array(3),
+          folly::dynamic::array(7),
+          folly::dynamic::array(folly::dynamic::array(42, "update", folly::dynamic::object("opacity", 0.5))),
+          request["arguments"].size());
+    }
+
+    BinaryFrameReader m_reader;
+    BinaryFrameWriter m_writer;
+  };
+
+  static folly::dynamic CallArguments(int i) {
+    return folly::dynamic::array(
+        "RCTEventEmitter",
+        "receiveEvent",
+        folly::dynamic::array(i, "topChange", folly::dynamic::object("value", i * 0.25)("target", i)));
+  }
+
+  TEST_METHOD(BinaryBridgeFramingTest_RoundTripsValues) {
+    folly::dynamic arguments = folly::dynamic::array(
+        nullptr,
+        true,
+        false,
+        0,
+        -1,
+        INT64_MAX,
+        INT64_MIN,
+        1.5,
+        -0.0,
+        "",
+        "text with \"quotes\" and \xC3\xA9",
+        folly::dynamic::array(folly::dynamic::array(), folly::dynamic::object()),
+        folly::dynamic::object("a", 1)("b", folly::dynamic::array("c", 2.5)));
+    folly::dynamic fields = folly::dynamic::object("arguments", arguments);
+
+    BinaryFrameWriter writer;
+    std::string buffer;
+    writer.WriteRequest(buffer, 12, "callFunctionReturnFlushedQueue", fields);
+    writer.WriteReply(buffer, 12, arguments);
+
+    BinaryFrameReader reader;
+    BinaryFrame frame;
+    size_t offset = 0;
+    Assert::IsTrue(reader.ReadFrame(buffer, offset, frame));
+    Assert::IsTrue(BinaryFrameKind::Request == frame.Kind);
+    Assert::AreEqual(12, frame.Id);
+    Assert::AreEqual(std::string("callFunctionReturnFlushedQueue"), frame.Method);
+    Assert::IsTrue(fields == frame.Value);
+    Assert::IsTrue(frame.Value["arguments"][5].isInt());
+    Assert::IsTrue(frame.Value["arguments"][7].isDouble());
+
+    Assert::IsTrue(reader.ReadFrame(buffer, offset, frame));
+    Assert::IsTrue(BinaryFrameKind::Reply == frame.Kind);
+    Assert::AreEqual(12, frame.Id);
+    Assert::IsTrue(frame.Method.empty());
+    Assert::IsTrue(arguments == frame.Value);
+
+    Assert::IsFalse(reader.ReadFrame(buffer, offset, frame));
+  }
+
+  TEST_METHOD(BinaryBridgeFramingTest_InternsModuleAndMethodNames) {
+    auto fields = folly::dynamic::object("arguments", CallArguments(1));
+    BinaryFrameWriter writer;
+    std::string first;
+    writer.WriteRequest(first, 1, "callFunctionReturnFlushedQueue", fields);
+    std::string second;
+    writer.WriteRequest(second, 2, "callFunctionReturnFlushedQueue", fields);
+
+    // The second request refers to the strings the first one defined, apart from the event arguments.
+    Assert::IsTrue(second.size() < first.size() / 2);
+    Assert::IsTrue(first.find("RCTEventEmitter") != std::string::npos);
+    Assert::IsTrue(second.find("RCTEventEmitter") == std::string::npos);
+    Assert::IsTrue(second.find("topChange") != std::string::npos);
+
+    BinaryFrameReader reader;
+    BinaryFrame frame;
+    size_t offset = 0;
+    Assert::IsTrue(reader.ReadFrame(first, offset, frame));
+    offset = 0;
+    Assert::IsTrue(reader.ReadFrame(second, offset, frame));
+    Assert::AreEqual(std::string("callFunctionReturnFlushedQueue"), frame.Method);
+    Assert::IsTrue(CallArguments(1) == frame.Value["arguments"]);
+  }
+
+  TEST_METHOD(BinaryBridgeFramingTest_RejectsMalformedFrames) {
+    BinaryFrameWriter writer;
+    std::string buffer;
+    writer.WriteRequest(
+        buffer, 1, "callFunctionReturnFlushedQueue", folly::dynamic::object("arguments", CallArguments(1)));
+
+    // Every truncation of the frame is rejected rather than read past its end.
+    for (size_t length = 1; length < buffer.size(); ++length) {
+      BinaryFrameReader reader;
+      BinaryFrame frame;
+      size_t offset = 0;
+      Assert::ExpectException<std::runtime_error>(
+          [&]() { reader.ReadFrame(std::string_view(buffer.data(), length), offset, frame); });
+    }
+
+    // A reference to a string that was never defined.
+    std::string unknownString("\x04\x00\x00\x00\x01\x01\x07\x00", 8);
+    BinaryFrameReader reader;
+    BinaryFrame frame;
+    size_t offset = 0;
+    Assert::ExpectException<std::runtime_error>([&]() { reader.ReadFrame(unknownString, offset, frame); });
+  }
+
+  TEST_METHOD(BinaryBridgeFramingTest_FailedFrameInternsNoStrings) {
+    BinaryFrameWriter writer;
+    std::string buffer;
+    writer.WriteRequest(buffer, 1, "callFunctionReturnFlushedQueue", folly::dynamic::object("arguments", 1));
+    auto written = buffer;
+
+    // The module name is interned before the object key that is not a string fails the frame.
+    auto arguments = folly::dynamic::array("NewModule", "update", folly::dynamic::object(1, "one"));
+    Assert::ExpectException<std::invalid_argument>([&]() {
+      writer.WriteRequest(buffer, 2, "callFunctionReturnFlushedQueue", folly::dynamic::object("arguments", arguments));
+    });
+    Assert::IsTrue(written == buffer);
+
+    arguments = CallArguments(3);
+    arguments[0] = "NewModule";
+    writer.WriteRequest(buffer, 3, "callFunctionReturnFlushedQueue", folly::dynamic::object("arguments", arguments));
+
+    BinaryFrameReader reader;
+    BinaryFrame frame;
+    size_t offset = 0;
+    Assert::IsTrue(reader.ReadFrame(buffer, offset, frame));
+    Assert::IsTrue(reader.ReadFrame(buffer, offset, frame));
+    Assert::AreEqual(3, frame.Id);
+    Assert::IsTrue(arguments == frame.Value["arguments"]);
+    Assert::IsFalse(reader.ReadFrame(buffer, offset, frame));
+  }
+
+  // Round trips callFunctionReturnFlushedQueue calls through the loopback proxy in both framings, as the executor
+  // encodes and decodes them.
+  TEST_METHOD(BinaryBridgeFramingTest_LoopbackRepliesMatchJsonFraming) {
+    constexpr int callCount = 100;
+    LoopbackDebuggerProxy jsonProxy;
+    LoopbackDebuggerProxy binaryProxy;
+    BinaryFrameWriter writer;
+    BinaryFrameReader reader;
+    size_t jsonBytes = 0;
+    size_t binaryBytes = 0;
+    for (int i = 0; i < callCount; ++i) {
+      folly::dynamic request = folly::dynamic::object("id", i)("method", "callFunctionReturnFlushedQueue")(
+          "arguments", CallArguments(i));
+      auto jsonMessage = folly::toJson(request);
+      auto jsonReply = jsonProxy.HandleJson(jsonMessage);
+      auto jsonCalls = folly::parseJson(folly::parseJson(jsonReply)["result"].getString());
+      jsonBytes += jsonMessage.size() + jsonReply.size();
+
+      std::string binaryMessage;
+      writer.WriteRequest(
+          binaryMessage, i, "callFunctionReturnFlushedQueue", folly::dynamic::object("arguments", CallArguments(i)));
+      auto binaryReply = binaryProxy.HandleBinary(binaryMessage);
+      BinaryFrame frame;
+      size_t offset = 0;
+      Assert::IsTrue(reader.ReadFrame(binaryReply, offset, frame));
+      Assert::AreEqual(i, frame.Id);
+      Assert::IsTrue(jsonCalls == frame.Value);
+      binaryBytes += binaryMessage.size() + binaryReply.size();
+    }
+
+    // Module and method names are only sent once in the binary framing.
+    Assert::IsTrue(binaryBytes < jsonBytes);
+  }
+};
+
+} // namespace Microsoft::React::Test
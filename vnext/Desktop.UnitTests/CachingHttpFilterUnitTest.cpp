@@ -0,0 +1,220 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/CachingHttpFilter.h>
+#include <Networking/HttpCachePolicy.h>
+#include <Networking/HttpDiskCache.h>
+#include <Networking/WinRTTypes.h>
+#include "WinRTNetworkingMocks.h"
+
+// Windows API
+#include <Windows.h>
+#include <winrt/Windows.Web.Http.Headers.h>
+
+// Standard Library
+#include <memory>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace winrt::Windows::Web::Http;
+
+using Microsoft::React::Networking::CachingHttpFilter;
+using Microsoft::React::Networking::HttpCacheEntry;
+using Microsoft::React::Networking::HttpCachePolicy;
+using Microsoft::React::Networking::HttpDiskCache;
+using Microsoft::React::Networking::ParseHttpDate;
+using Microsoft::React::Networking::ResponseOperation;
+using winrt::Windows::Foundation::Uri;
+using winrt::Windows::Web::Http::Filters::IHttpFilter;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (CachingHttpFilterUnitTest) {
+  // A cache directory of its own for each test, deleted with its content at the end of the test.
+  class TempCacheDirectory {
+   public:
+    TempCacheDirectory() {
+      wchar_t tempPath[MAX_PATH];
+      Assert::IsTrue(GetTempPathW(MAX_PATH, tempPath) != 0);
+      static int count = 0;
+      m_path = std::wstring(tempPath) + L"rnwhttp_test_" + std::to_wstring(GetCurrentProcessId()) + L"_" +
+          std::to_wstring(++count) + L"\\";
+    }
+
+    ~TempCacheDirectory() {
+      WIN32_FIND_DATAW findData;
+      HANDLE find = FindFirstFileW((m_path + L"*").c_str(), &findData);
+      if (find != INVALID_HANDLE_VALUE) {
+        do {
+          DeleteFileW((m_path + findData.cFileName).c_str());
+        } while (FindNextFileW(find, &findData));
+        FindClose(find);
+      }
+      RemoveDirectoryW(m_path.c_str());
+    }
+
+    const std::wstring &Path() const {
+      return m_path;
+    }
+
+   private:
+    std::wstring m_path;
+  };
+
+  struct Server {
+    IHttpFilter Filter{winrt::make<MockHttpBaseFilter>()};
+    int RequestCount{0};
+    int NotModifiedCount{0};
+  };
+
+  // A server that responds to every request with `body` and the `cacheControl` and ETag headers, or with a 304 Not
+  // Modified to requests for the ETag it has.
+  static std::shared_ptr<Server> MakeServer(std::wstring cacheControl, std::wstring body) {
+    auto server = std::make_shared<Server>();
+    server->Filter.as<MockHttpBaseFilter>()->Mocks.SendRequestAsync =
+        [server = server.get(), cacheControl, body](HttpRequestMessage const &request) -> ResponseOperation {
+      ++server->RequestCount;
+      HttpResponseMessage response;
+      response.RequestMessage(request);
+
+      if (request.Headers().HasKey(L"If-None-Match") && request.Headers().Lookup(L"If-None-Match") == L"\"v1\"") {
+        ++server->NotModifiedCount;
+        response.StatusCode(HttpStatusCode::NotModified);
+      } else {
+        response.StatusCode(HttpStatusCode::Ok);
+        HttpStringContent content{body};
+        content.Headers().ContentLength(winrt::to_string(body).size());
+        response.Content(content);
+      }
+      response.Headers().TryAppendWithoutValidation(L"Cache-Control", cacheControl);
+      response.Headers().TryAppendWithoutValidation(L"ETag", L"\"v1\"");
+
+      co_return response;
+    };
+    return server;
+  }
+
+  static HttpResponseMessage Send(IHttpFilter const &filter, std::wstring_view url = L"http://cachehost/image.png") {
+    HttpClient client{filter};
+    auto sendOp = client.SendRequestAsync(HttpRequestMessage{HttpMethod::Get(), Uri{url}});
+    sendOp.get();
+    return sendOp.GetResults();
+  }
+
+  static std::wstring ReadContent(HttpResponseMessage const &response) {
+    auto contentOp = response.Content().ReadAsStringAsync();
+    contentOp.get();
+    return std::wstring{contentOp.GetResults()};
+  }
+
+  TEST_CLASS_INITIALIZE(Initialize) {
+    winrt::uninit_apartment();
+  }
+
+  TEST_METHOD(CachePolicyFollowsResponseHeaders) {
+    Assert::AreEqual(int64_t{784111777}, ParseHttpDate("Sun, 06 Nov 1994 08:49:37 GMT").value());
+    Assert::IsFalse(ParseHttpDate("Sunday, 06-Nov-94 08:49:37 GMT").has_value());
+
+    auto policy = HttpCachePolicy::Parse({{"cache-control", "public, max-age=60"}});
+    Assert::IsTrue(policy.IsFresh(100, 159));
+    Assert::IsFalse(policy.IsFresh(100, 160));
+    Assert::IsTrue(policy.IsStorable(100));
+
+    policy = HttpCachePolicy::Parse(
+        {{"Date", "Sun, 06 Nov 1994 08:49:37 GMT"}, {"Expires", "Sun, 06 Nov 1994 08:50:37 GMT"}});
+    Assert::AreEqual(int64_t{60}, policy.FreshnessLifetime(0));
+
+    // Revalidated on every use.
+    policy = HttpCachePolicy::Parse({{"Cache-Control", "no-cache"}, {"ETag", "\"v1\""}});
+    Assert::IsFalse(policy.IsFresh(100, 100));
+    Assert::IsTrue(policy.IsStorable(100));
+
+    Assert::IsFalse(HttpCachePolicy::Parse({{"Cache-Control", "no-cache"}}).IsStorable(100));
+    Assert::IsFalse(HttpCachePolicy::Parse({{"Cache-Control", "max-age=60, no-store"}}).IsStorable(100));
+    Assert::IsFalse(HttpCachePolicy::Parse({{"Cache-Control", "max-age=60"}, {"Vary", "Cookie"}}).IsStorable(100));
+  }
+
+  TEST_METHOD(EntriesRoundTripAndEvictLeastRecentlyUsed) {
+    TempCacheDirectory directory;
+    HttpDiskCache cache{directory.Path(), 32 * 1024};
+    std::string body(4 * 1024, 'x');
+
+    for (int i = 0; i < 10; ++i) {
+      HttpCacheEntry entry{"http://cachehost/" + std::to_string(i), 1234, {{"ETag", "\"v1\""}}, {}};
+      Assert::IsTrue(cache.Store(entry, reinterpret_cast<const uint8_t *>(body.data()), body.size()));
+      Sleep(20);
+      // Keeps the first entry recently used.
+      Assert::IsTrue(cache.Lookup("http://cachehost/0").has_value());
+      Sleep(20);
+    }
+
+    auto entry = cache.Lookup("http://cachehost/9");
+    Assert::IsTrue(entry.has_value());
+    Assert::AreEqual(int64_t{1234}, entry->Response.GeneratedAt);
+    Assert::AreEqual(body, std::string(reinterpret_cast<const char *>(entry->Body), entry->BodySize));
+    Assert::IsTrue(cache.Lookup("http://cachehost/0").has_value());
+    Assert::IsFalse(cache.Lookup("http://cachehost/1").has_value());
+
+    // Larger than an eighth of the capacity.
+    std::string largeBody(5 * 1024, 'x');
+    Assert::IsFalse(cache.Store(
+        HttpCacheEntry{"http://cachehost/large", 0, {}, {}},
+        reinterpret_cast<const uint8_t *>(largeBody.data()),
+        largeBody.size()));
+  }
+
+  TEST_METHOD(FreshResponseIsServedFromDisk) {
+    TempCacheDirectory directory;
+    auto server = MakeServer(L"max-age=3600", L"Response Content");
+
+    auto first = Send(winrt::make<CachingHttpFilter>(
+        std::make_shared<HttpDiskCache>(directory.Path(), 1024 * 1024), server->Filter));
+    Assert::AreEqual(L"Response Content", ReadContent(first).c_str());
+
+    // Another cache over the same directory, as in the next run of the app.
+    auto cache = std::make_shared<HttpDiskCache>(directory.Path(), 1024 * 1024);
+    auto second = Send(winrt::make<CachingHttpFilter>(cache, server->Filter));
+    Assert::IsTrue(HttpStatusCode::Ok == second.StatusCode());
+    Assert::IsTrue(HttpResponseMessageSource::Cache == second.Source());
+    Assert::AreEqual(L"Response Content", ReadContent(second).c_str());
+    Assert::AreEqual(L"\"v1\"", second.Headers().Lookup(L"ETag").c_str());
+
+    Assert::AreEqual(1, server->RequestCount);
+    Assert::AreEqual(uint64_t{1}, cache->Stats().Hits);
+  }
+
+  TEST_METHOD(StaleResponseIsRevalidated) {
+    TempCacheDirectory directory;
+    auto cache = std::make_shared<HttpDiskCache>(directory.Path(), 1024 * 1024);
+    auto server = MakeServer(L"no-cache", L"Response Content");
+    auto filter = winrt::make<CachingHttpFilter>(cache, server->Filter);
+
+    Assert::AreEqual(L"Response Content", ReadContent(Send(filter)).c_str());
+    auto second = Send(filter);
+    Assert::IsTrue(HttpStatusCode::Ok == second.StatusCode());
+    Assert::AreEqual(L"Response Content", ReadContent(second).c_str());
+    Assert::AreEqual(L"Response Content", ReadContent(Send(filter)).c_str());
+
+    Assert::AreEqual(3, server->RequestCount);
+    Assert::AreEqual(2, server->NotModifiedCount);
+    Assert::AreEqual(uint64_t{2}, cache->Stats().NotModified);
+    Assert::AreEqual(uint64_t{1}, cache->Stats().Misses);
+  }
+
+  TEST_METHOD(UnstorableResponseIsNotCached) {
+    TempCacheDirectory directory;
+    auto cache = std::make_shared<HttpDiskCache>(directory.Path(), 1024 * 1024);
+    auto server = MakeServer(L"no-store", L"Response Content");
+    auto filter = winrt::make<CachingHttpFilter>(cache, server->Filter);
+
+    Assert::AreEqual(L"Response Content", ReadContent(Send(filter)).c_str());
+    Assert::AreEqual(L"Response Content", ReadContent(Send(filter)).c_str());
+
+    Assert::AreEqual(2, server->RequestCount);
+    Assert::AreEqual(0, server->NotModifiedCount);
+    Assert::AreEqual(uint64_t{0}, cache->Stats().Stores);
+  }
+};
+
+} // namespace Microsoft::React::Test
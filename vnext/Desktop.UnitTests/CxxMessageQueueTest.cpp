@@ -0,0 +1,141 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <CxxMessageQueue.h>
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+using facebook::react::CxxMessageQueue;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+
+namespace {
+
+// Runs the message queue runloop on its own thread for the lifetime of the object.
+struct MessageQueueRunner {
+  explicit MessageQueueRunner(std::chrono::milliseconds delayedTaskSlack = std::chrono::milliseconds::zero())
+      : Queue{std::make_shared<CxxMessageQueue>(delayedTaskSlack)}, Thread{CxxMessageQueue::getRunLoop(Queue)} {}
+
+  ~MessageQueueRunner() {
+    Queue->quitSynchronous();
+    Thread.join();
+  }
+
+  std::shared_ptr<CxxMessageQueue> Queue;
+  std::thread Thread;
+};
+
+// Posts timerCount delayed tasks with random delays within one second and returns the number of the queue
+// thread wakeups while they run.
+uint64_t CountTimerWakeups(std::chrono::milliseconds delayedTaskSlack, int timerCount) {
+  MessageQueueRunner runner{delayedTaskSlack};
+  std::atomic<int> callCount{0};
+  std::mt19937 random{42};
+  std::uniform_int_distribution<uint64_t> delayMs{1, 1000};
+
+  // Make sure that the runloop is started before counting.
+  runner.Queue->runOnQueueSync([] {});
+
+  uint64_t startWakeupCount = runner.Queue->wakeupCount();
+  for (int i = 0; i < timerCount; ++i) {
+    runner.Queue->runOnQueueDelayed([&callCount] { ++callCount; }, delayMs(random));
+  }
+
+  while (callCount < timerCount) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  return runner.Queue->wakeupCount() - startWakeupCount;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (CxxMessageQueueTest) {
+  TEST_METHOD(CxxMessageQueue_RunsTasksInOrder) {
+    MessageQueueRunner runner;
+    std::vector<int> order;
+    for (int i = 0; i < 100; ++i) {
+      runner.Queue->runOnQueue([&order, i] { order.push_back(i); });
+    }
+
+    runner.Queue->runOnQueueSync([] {});
+    Assert::AreEqual(size_t{100}, order.size());
+    for (int i = 0; i < 100; ++i) {
+      Assert::AreEqual(i, order[i]);
+    }
+  }
+
+  TEST_METHOD(CxxMessageQueue_DelayedTaskRunsAfterDelay) {
+    MessageQueueRunner runner{std::chrono::milliseconds(10)};
+    std::atomic<bool> done{false};
+    std::chrono::steady_clock::time_point runTime;
+
+    auto postTime = std::chrono::steady_clock::now();
+    runner.Queue->runOnQueueDelayed(
+        [&] {
+          runTime = std::chrono::steady_clock::now();
+          done = true;
+        },
+        50);
+
+    while (!done) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    Assert::IsTrue(runTime - postTime >= std::chrono::milliseconds(50));
+  }
+
+  TEST_METHOD(CxxMessageQueue_DelayedTasksDoNotWakeUpQueue) {
+    MessageQueueRunner runner;
+    runner.Queue->runOnQueueDelayed([] {}, 5000);
+    runner.Queue->runOnQueueSync([] {});
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // Tasks that are due after the task the queue thread already waits for must not wake it up.
+    uint64_t wakeupCount = runner.Queue->wakeupCount();
+    for (int i = 0; i < 100; ++i) {
+      runner.Queue->runOnQueueDelayed([] {}, 6000 + i);
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    Assert::AreEqual(wakeupCount, runner.Queue->wakeupCount());
+  }
+
+  TEST_METHOD(CxxMessageQueue_IdleTaskRunsAfterPostedTasks) {
+    MessageQueueRunner runner;
+    std::vector<int> order;
+    std::atomic<bool> done{false};
+
+    runner.Queue->runOnQueueSync([&] {
+      runner.Queue->runOnQueueIdle([&] {
+        order.push_back(3);
+        done = true;
+      });
+      runner.Queue->runOnQueue([&] { order.push_back(1); });
+      runner.Queue->runOnQueue([&] { order.push_back(2); });
+    });
+
+    while (!done) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    Assert::IsTrue(std::vector<int>{1, 2, 3} == order);
+  }
+
+  // Delayed tasks due within the slack of each other run in one wakeup of the queue thread.
+  TEST_METHOD(CxxMessageQueue_SlackCoalescesTimerWakeups) {
+    constexpr int timerCount = 200;
+    uint64_t exactWakeups = CountTimerWakeups(std::chrono::milliseconds::zero(), timerCount);
+    uint64_t coalescedWakeups = CountTimerWakeups(std::chrono::milliseconds(16), timerCount);
+
+    Assert::IsTrue(coalescedWakeups < exactWakeups);
+  }
+};
+
+} // namespace Microsoft::React::Test
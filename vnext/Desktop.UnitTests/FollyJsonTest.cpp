@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <folly/json.h>
+
+// Standard Library
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Microsoft::React::Test {
+
+// Covers the vectorized string and whitespace scans of the folly JSON parser and serializer patched in
+// Folly/TEMP_UntilFollyUpdate/json/json.cpp.
+TEST_CLASS (FollyJsonTest) {
+  // Payloads shaped like the JSON React Native exchanges: module constants, a batch of UIManager calls, and the
+  // pretty-printed JSON of packager messages and bundle configuration.
+  static std::vector<std::string> Corpus() {
+    folly::dynamic constants = folly::dynamic::object;
+    for (int i = 0; i < 200; ++i) {
+      auto name = std::to_string(i);
+      constants["Constant" + name] = folly::dynamic::object("name", "Module constant " + name)(
+          "description", "A longer description of the constant, with \"quotes\", \\ and \xC3\xA9 characters")(
+          "value", i * 1.5)("enabled", i % 2 == 0);
+    }
+
+    folly::dynamic batch = folly::dynamic::array;
+    for (int i = 0; i < 500; ++i) {
+      batch.push_back(folly::dynamic::array(
+          "createView",
+          folly::dynamic::array(
+              i,
+              "RCTText",
+              1,
+              folly::dynamic::object("text", "Item number " + std::to_string(i) + " of the list")("numberOfLines", 2)(
+                  "style", folly::dynamic::object("fontSize", 14)("color", 0xff333333)))));
+    }
+
+    return {folly::toJson(constants), folly::toJson(batch), folly::toPrettyJson(constants), folly::toPrettyJson(batch)};
+  }
+
+  TEST_METHOD(FollyJsonTest_StringsRoundTripAtEveryLength) {
+    // Escapes and non-ASCII characters on either side of each 16-byte boundary.
+    for (size_t length = 0; length < 70; ++length) {
+      for (auto special : {"\"", "\\", "\n", "\x01", "\xC3\xA9", "/"}) {
+        std::string value(length, 'a');
+        value.insert(length / 2, special);
+
+        auto json = folly::toJson(value);
+        Assert::AreEqual(value, folly::parseJson(json).getString());
+      }
+    }
+  }
+
+  TEST_METHOD(FollyJsonTest_SerializerOptionsStillApply) {
+    std::string value = "0123456789abcdef\xC3\xA9<tag>0123456789abcdef";
+
+    folly::json::serialization_opts opts;
+    opts.encode_non_ascii = true;
+    Assert::AreEqual(
+        std::string("\"0123456789abcdef\\u00e9<tag>0123456789abcdef\""), folly::json::serialize(value, opts));
+
+    opts = {};
+    opts.extra_ascii_to_escape_bitmap = folly::json::buildExtraAsciiToEscapeBitmap("<>");
+    Assert::AreEqual(
+        std::string("\"0123456789abcdef\xC3\xA9\\u003ctag\\u003e0123456789abcdef\""),
+        folly::json::serialize(value, opts));
+
+    opts = {};
+    opts.validate_utf8 = true;
+    Assert::ExpectException<std::exception>([&]() { folly::json::serialize(std::string(20, 'a') + "\xC3", opts); });
+  }
+
+  TEST_METHOD(FollyJsonTest_ErrorsReportLineNumbers) {
+    // Newlines inside long strings and long indentation runs are counted by the vectorized scans.
+    std::string json = "{\n  \"a\": \"" + std::string(20, 'x') + "\n" + std::string(20, 'x') + "\",\n" +
+        std::string(40, ' ') + "\n  \"b\": ]\n}";
+    try {
+      folly::parseJson(json);
+      Assert::Fail(L"Expected a parse error");
+    } catch (const folly::json::parse_error &e) {
+      Assert::IsTrue(std::string(e.what()).find("on line 4") != std::string::npos);
+    }
+  }
+
+  TEST_METHOD(FollyJsonTest_CorpusRoundTrips) {
+    for (const auto &json : Corpus()) {
+      auto parsed = folly::parseJson(json);
+      Assert::IsTrue(parsed == folly::parseJson(folly::toJson(parsed)));
+      Assert::IsTrue(parsed == folly::parseJson(folly::toPrettyJson(parsed)));
+    }
+  }
+};
+
+} // namespace Microsoft::React::Test
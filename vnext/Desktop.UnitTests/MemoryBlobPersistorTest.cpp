@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/DefaultBlobResource.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::BlobContent;
+using Microsoft::React::Networking::BlobSlice;
+using Microsoft::React::Networking::MemoryBlobPersistor;
+using std::string;
+using std::vector;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (MemoryBlobPersistorTest) {
+  static vector<uint8_t> MakeContent(size_t size, uint8_t seed) {
+    vector<uint8_t> result(size);
+    for (size_t i = 0; i < size; ++i) {
+      result[i] = static_cast<uint8_t>(seed + i);
+    }
+
+    return result;
+  }
+
+  static bool Equals(BlobContent const &actual, vector<uint8_t> const &expected) {
+    return actual.Data.size() == expected.size() &&
+        std::equal(actual.Data.begin(), actual.Data.end(), expected.begin());
+  }
+
+  TEST_METHOD(StoreAndResolveSucceeds) {
+    MemoryBlobPersistor persistor;
+    auto content = MakeContent(16, 0);
+    auto blobId = persistor.StoreMessage(vector<uint8_t>{content});
+
+    Assert::IsTrue(Equals(persistor.ResolveMessage(string{blobId}, 0, 16), content));
+    Assert::IsTrue(Equals(persistor.ResolveMessage(string{blobId}, 4, 8), {content.begin() + 4, content.begin() + 12}));
+    Assert::AreEqual(static_cast<size_t>(16), persistor.ResidentSize());
+
+    persistor.RemoveMessage(string{blobId});
+    Assert::AreEqual(static_cast<size_t>(0), persistor.ResidentSize());
+    Assert::ExpectException<std::invalid_argument>([&]() { persistor.ResolveMessage(string{blobId}, 0, 1); });
+  }
+
+  TEST_METHOD(ResolveOutOfRangeFails) {
+    MemoryBlobPersistor persistor;
+    auto blobId = persistor.StoreMessage(MakeContent(16, 0));
+
+    Assert::ExpectException<std::out_of_range>([&]() { persistor.ResolveMessage(string{blobId}, 8, 9); });
+    Assert::ExpectException<std::out_of_range>([&]() { persistor.ResolveSlices(string{blobId}, -1, 4); });
+  }
+
+  TEST_METHOD(ComposedBlobSharesContent) {
+    MemoryBlobPersistor persistor;
+    auto first = MakeContent(1024, 0);
+    auto second = MakeContent(1024, 100);
+    persistor.StoreMessage(vector<uint8_t>{first}, "first");
+    persistor.StoreMessage(vector<uint8_t>{second}, "second");
+
+    vector<BlobSlice> slices = persistor.ResolveSlices("first", 512, 512);
+    auto secondSlices = persistor.ResolveSlices("second", 0, 256);
+    slices.insert(slices.end(), secondSlices.begin(), secondSlices.end());
+    secondSlices.clear();
+    persistor.StoreSlices(std::move(slices), "composed");
+
+    // Slicing does not copy content.
+    Assert::AreEqual(static_cast<size_t>(2048), persistor.ResidentSize());
+    Assert::IsTrue(Equals(persistor.ResolveMessage("composed", 0, 512), {first.begin() + 512, first.end()}));
+
+    // Ranges across slices are copied into contiguous content, which the blob does not keep.
+    vector<uint8_t> expected{first.begin() + 1000, first.end()};
+    expected.insert(expected.end(), second.begin(), second.begin() + 100);
+    Assert::IsTrue(Equals(persistor.ResolveMessage("composed", 488, 124), expected));
+    Assert::AreEqual(static_cast<size_t>(2048), persistor.ResidentSize());
+
+    // Shared content is released with its last reference.
+    persistor.RemoveMessage("first");
+    persistor.RemoveMessage("second");
+    persistor.RemoveMessage("composed");
+    Assert::AreEqual(static_cast<size_t>(0), persistor.ResidentSize());
+  }
+
+  TEST_METHOD(OversizedBlobIsSpilled) {
+    MemoryBlobPersistor persistor{/*memoryBudget*/ 4 * 1024 * 1024, /*spillSize*/ 1024 * 1024};
+    auto content = MakeContent(2 * 1024 * 1024, 7);
+    persistor.StoreMessage(vector<uint8_t>{content}, "large");
+
+    Assert::AreEqual(static_cast<size_t>(0), persistor.ResidentSize());
+    Assert::IsTrue(Equals(persistor.ResolveMessage("large", 0, content.size()), content));
+  }
+
+  TEST_METHOD(MemoryBudgetIsEnforced) {
+    constexpr size_t budget = 2 * 1024 * 1024;
+    MemoryBlobPersistor persistor{budget, /*spillSize*/ 64 * 1024 * 1024};
+    for (uint8_t i = 0; i < 3; ++i) {
+      persistor.StoreMessage(MakeContent(1024 * 1024, i), std::to_string(i));
+    }
+
+    Assert::IsTrue(persistor.ResidentSize() <= budget);
+    for (uint8_t i = 0; i < 3; ++i) {
+      auto content = MakeContent(1024 * 1024, i);
+      Assert::IsTrue(Equals(persistor.ResolveMessage(std::to_string(i), 0, content.size()), content));
+    }
+  }
+
+  TEST_METHOD(ResolvedContentOutlivesBlob) {
+    constexpr size_t size = 1024 * 1024;
+    MemoryBlobPersistor persistor{/*memoryBudget*/ 2 * size, /*spillSize*/ 64 * 1024 * 1024};
+    auto first = MakeContent(size, 0);
+    auto second = MakeContent(size, 100);
+    persistor.StoreMessage(vector<uint8_t>{first}, "first");
+    persistor.StoreMessage(vector<uint8_t>{second}, "second");
+    vector<BlobSlice> slices = persistor.ResolveSlices("first", 0, size);
+    auto secondSlices = persistor.ResolveSlices("second", 0, size);
+    slices.insert(slices.end(), secondSlices.begin(), secondSlices.end());
+    secondSlices.clear();
+    persistor.StoreSlices(std::move(slices), "composed");
+
+    vector<uint8_t> expected{first.begin() + size / 2, first.end()};
+    expected.insert(expected.end(), second.begin(), second.begin() + size / 2);
+    auto whole = persistor.ResolveMessage("first", 0, size);
+    auto across = persistor.ResolveMessage("composed", size / 2, size);
+    Assert::AreEqual(static_cast<size_t>(2), persistor.ResolveSlices("composed", 0, 2 * size).size());
+
+    // Content that is still referenced is not spilled, as that would not release memory.
+    // Only "third" can be spilled: "composed" references "first" and "second", and "across" holds its own copy.
+    persistor.StoreMessage(MakeContent(size, 200), "third");
+    Assert::AreEqual(3 * size, persistor.ResidentSize());
+    Assert::IsTrue(Equals(persistor.ResolveMessage("second", 0, size), second));
+    Assert::IsTrue(Equals(persistor.ResolveMessage("third", 0, size), MakeContent(size, 200)));
+
+    persistor.RemoveMessage("first");
+    persistor.RemoveMessage("composed");
+    Assert::IsTrue(Equals(whole, first));
+    Assert::IsTrue(Equals(across, expected));
+
+    whole = {};
+    across = {};
+    persistor.RemoveMessage("second");
+    persistor.RemoveMessage("third");
+    Assert::AreEqual(static_cast<size_t>(0), persistor.ResidentSize());
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -12,10 +12,13 @@
 // Standard Library
 #include <cstdio>
 #include <cstdlib>
+#include <fstream>
+#include <iterator>
 
 using namespace facebook::jsi;
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
+using facebook::react::LruPreparedScriptStore;
 using std::make_shared;
 using std::make_unique;
 using std::unique_ptr;
@@ -69,4 +72,183 @@ TEST_CLASS (ScriptStoreIntegrationTest) {
     Assert::IsTrue(endWorkingSet - startWorkingSet < fileSize * 1.1);
   }
 };
+
+TEST_CLASS (LruPreparedScriptStoreTest) {
+  // A store directory of its own for each test, deleted with its content at the end of the test.
+  class TempStoreDirectory {
+   public:
+    TempStoreDirectory() {
+      char tempPath[MAX_PATH];
+      Assert::IsTrue(GetTempPathA(MAX_PATH, tempPath) != 0);
+      static int count = 0;
+      m_path = std::string(tempPath) + "rnwprep_test_" + std::to_string(GetCurrentProcessId()) + "_" +
+          std::to_string(++count) + "\\";
+      Assert::IsTrue(CreateDirectoryA(m_path.c_str(), nullptr) != FALSE);
+    }
+
+    ~TempStoreDirectory() {
+      WIN32_FIND_DATAA findData;
+      HANDLE find = FindFirstFileA((m_path + "*").c_str(), &findData);
+      if (find != INVALID_HANDLE_VALUE) {
+        do {
+          DeleteFileA((m_path + findData.cFileName).c_str());
+        } while (FindNextFileA(find, &findData));
+        FindClose(find);
+      }
+      RemoveDirectoryA(m_path.c_str());
+    }
+
+    const std::string &Path() const {
+      return m_path;
+    }
+
+   private:
+    std::string m_path;
+  };
+
+  static std::string ReadFile(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  }
+
+  static void WriteFile(const std::string &path, const std::string &content) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), content.size());
+  }
+
+  static std::shared_ptr<StringBuffer> PreparedScript(char fill, size_t size = 64 * 1024) {
+    return make_shared<StringBuffer>(std::string(size, fill));
+  }
+
+  static std::string ToString(const std::shared_ptr<const Buffer> &buffer) {
+    return std::string(reinterpret_cast<const char *>(buffer->data()), buffer->size());
+  }
+
+  const ScriptSignature m_script{"myscheme://my/path.js", 0x1234};
+  const JSRuntimeSignature m_runtime{"Hermes", 1};
+
+  TEST_METHOD(LruPreparedScriptStore_PersistedScriptRoundTrips) {
+    TempStoreDirectory directory;
+    LruPreparedScriptStore store(directory.Path());
+    store.persistPreparedScript(PreparedScript('a'), m_script, m_runtime, "tag");
+
+    auto prepared = store.tryGetPreparedScript(m_script, m_runtime, "tag");
+    Assert::IsNotNull(prepared.get());
+    Assert::AreEqual(ToString(PreparedScript('a')), ToString(prepared));
+
+    // Another script with the same version, such as the script of another app sharing the store, misses.
+    auto otherScript = ScriptSignature{"otherscheme://other/path.js", m_script.version};
+    Assert::IsNull(store.tryGetPreparedScript(otherScript, m_runtime, "tag").get());
+  }
+
+  TEST_METHOD(LruPreparedScriptStore_VersionChangeMisses) {
+    TempStoreDirectory directory;
+    LruPreparedScriptStore store(directory.Path());
+    store.persistPreparedScript(PreparedScript('a'), m_script, m_runtime, "tag");
+
+    Assert::IsNull(store.tryGetPreparedScript(ScriptSignature{m_script.url, 0x1235}, m_runtime, "tag").get());
+    Assert::IsNull(store.tryGetPreparedScript(m_script, JSRuntimeSignature{"Hermes", 2}, "tag").get());
+    Assert::IsNull(store.tryGetPreparedScript(m_script, m_runtime, "otherTag").get());
+    Assert::IsNull(store.tryGetPreparedScript(m_script, m_runtime, nullptr).get());
+
+    // An entry renamed to the name of another version is rejected by the version it records.
+    auto otherVersion = ScriptSignature{m_script.url, 0x1235};
+    auto entryName = LruPreparedScriptStore::getEntryName(m_script, m_runtime, "tag");
+    auto otherEntryName = LruPreparedScriptStore::getEntryName(otherVersion, m_runtime, "tag");
+    Assert::AreNotEqual(entryName, otherEntryName);
+    WriteFile(directory.Path() + otherEntryName, ReadFile(directory.Path() + entryName));
+    Assert::IsNull(store.tryGetPreparedScript(otherVersion, m_runtime, "tag").get());
+  }
+
+  TEST_METHOD(LruPreparedScriptStore_CrashMidWriteLeavesNoStaleEntry) {
+    TempStoreDirectory directory;
+    LruPreparedScriptStore store(directory.Path());
+    store.persistPreparedScript(PreparedScript('a'), m_script, m_runtime, "tag");
+    auto entryPath = directory.Path() + LruPreparedScriptStore::getEntryName(m_script, m_runtime, "tag");
+    auto entry = ReadFile(entryPath);
+
+    // A crash while writing the temporary file leaves it behind, next to the previous entry.
+    auto tempPath = entryPath.substr(0, entryPath.size() - 6) + "_1.tmp";
+    WriteFile(tempPath, entry.substr(0, entry.size() / 2));
+    Assert::AreEqual(ToString(PreparedScript('a')), ToString(store.tryGetPreparedScript(m_script, m_runtime, "tag")));
+
+    // Every truncation of an entry, as left by a store without the rename, is rejected.
+    for (size_t length : {size_t{0}, size_t{1}, size_t{16}, size_t{60}, entry.size() / 2, entry.size() - 1}) {
+      WriteFile(entryPath, entry.substr(0, length));
+      Assert::IsNull(store.tryGetPreparedScript(m_script, m_runtime, "tag").get());
+    }
+
+    // The next persist replaces the entry and deletes the temporary file.
+    store.persistPreparedScript(PreparedScript('b'), m_script, m_runtime, "tag");
+    Assert::AreEqual(ToString(PreparedScript('b')), ToString(store.tryGetPreparedScript(m_script, m_runtime, "tag")));
+    Assert::AreEqual(INVALID_FILE_ATTRIBUTES, GetFileAttributesA(tempPath.c_str()));
+  }
+
+  TEST_METHOD(LruPreparedScriptStore_CorruptedEntryMisses) {
+    TempStoreDirectory directory;
+    LruPreparedScriptStore store(directory.Path());
+    store.persistPreparedScript(PreparedScript('a'), m_script, m_runtime, "tag");
+    auto entryPath = directory.Path() + LruPreparedScriptStore::getEntryName(m_script, m_runtime, "tag");
+
+    auto entry = ReadFile(entryPath);
+    entry[entry.size() / 2] ^= 1;
+    WriteFile(entryPath, entry);
+    Assert::IsNull(store.tryGetPreparedScript(m_script, m_runtime, "tag").get());
+  }
+
+  TEST_METHOD(LruPreparedScriptStore_EvictsLeastRecentlyUsed) {
+    TempStoreDirectory directory;
+    constexpr size_t scriptSize = 64 * 1024;
+    LruPreparedScriptStore store(directory.Path(), scriptSize * 5 / 2);
+    auto script = [this](ScriptVersion_t version) { return ScriptSignature{m_script.url, version}; };
+
+    store.persistPreparedScript(PreparedScript('a', scriptSize), script(1), m_runtime, nullptr);
+    Sleep(20);
+    store.persistPreparedScript(PreparedScript('b', scriptSize), script(2), m_runtime, nullptr);
+    Sleep(20);
+    // Using the first entry makes the second one the least recently used.
+    Assert::IsNotNull(store.tryGetPreparedScript(script(1), m_runtime, nullptr).get());
+    Sleep(20);
+    store.persistPreparedScript(PreparedScript('c', scriptSize), script(3), m_runtime, nullptr);
+
+    Assert::IsNotNull(store.tryGetPreparedScript(script(1), m_runtime, nullptr).get());
+    Assert::IsNull(store.tryGetPreparedScript(script(2), m_runtime, nullptr).get());
+    Assert::IsNotNull(store.tryGetPreparedScript(script(3), m_runtime, nullptr).get());
+  }
+
+  TEST_METHOD(LruPreparedScriptStore_EvictsEntriesOfBaseStore) {
+    TempStoreDirectory directory;
+    constexpr size_t scriptSize = 64 * 1024;
+    LruPreparedScriptStore store(directory.Path(), scriptSize * 5 / 2);
+    auto baseEntryPath = directory.Path() + "prep_myscheme___my_path_js_Hermes_tag.cache";
+    WriteFile(baseEntryPath, std::string(scriptSize, 'x'));
+    Sleep(20);
+
+    store.persistPreparedScript(PreparedScript('a', scriptSize), m_script, m_runtime, "tag");
+    Assert::IsTrue(GetFileAttributesA(baseEntryPath.c_str()) != INVALID_FILE_ATTRIBUTES);
+    Sleep(20);
+    store.persistPreparedScript(PreparedScript('b', scriptSize), m_script, m_runtime, "other");
+
+    Assert::IsTrue(GetFileAttributesA(baseEntryPath.c_str()) == INVALID_FILE_ATTRIBUTES);
+    Assert::IsNotNull(store.tryGetPreparedScript(m_script, m_runtime, "tag").get());
+    Assert::IsNotNull(store.tryGetPreparedScript(m_script, m_runtime, "other").get());
+  }
+
+  TEST_METHOD(ContentHashScriptVersionProvider_VersionFollowsContent) {
+    TempStoreDirectory directory;
+    auto scriptPath = directory.Path() + "index.bundle";
+    facebook::react::ContentHashScriptVersionProvider versionProvider;
+
+    WriteFile(scriptPath, "var a = 1;");
+    auto version = versionProvider.getVersion(scriptPath);
+    Assert::AreNotEqual(ScriptVersion_t{0}, version);
+    Assert::AreEqual(version, versionProvider.getVersion(scriptPath));
+
+    // An edit keeping the size of the script, which a size based version would miss.
+    WriteFile(scriptPath, "var a = 2;");
+    Assert::AreNotEqual(version, versionProvider.getVersion(scriptPath));
+
+    Assert::AreEqual(ScriptVersion_t{0}, versionProvider.getVersion(directory.Path() + "missing.bundle"));
+  }
+};
 } // namespace Microsoft::JSI::Test
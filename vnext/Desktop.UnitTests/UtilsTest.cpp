@@ -3,13 +3,21 @@
 
 #include <CppUnitTest.h>
 #include <Utils.h>
+#include <Utils/WinRTConversions.h>
 #include <utilities.h>
 
 // Windows API
+#include <winrt/Windows.Security.Cryptography.h>
 #include <winrt/base.h>
 
+// Standard Library
+#include <algorithm>
+#include <random>
+
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
+using winrt::Windows::Security::Cryptography::CryptographicBuffer;
+
 using std::string;
 using std::string_view;
 
@@ -267,6 +275,70 @@ TEST_CLASS(UtilsTest)
     }
   }
 
+  TEST_METHOD(DecodeBase64SkipsWhitespaceAndOptionalPadding)
+  {
+    Assert::AreEqual(string("abcd"), Utilities::DecodeBase64(string_view("YWJjZA")));
+    Assert::AreEqual(string("abcde"), Utilities::DecodeBase64(string_view("YWJjZGU")));
+    Assert::AreEqual(string("abcde"), Utilities::DecodeBase64(string_view(" YWJj\r\nZGU =\n")));
+    Assert::AreEqual(string("abcd"), Utilities::DecodeBase64(string_view("YWJjZA =\t=")));
+
+    // Longer than the blocks decoded with vector instructions, with whitespace in the middle of a group.
+    string text(200, 'x');
+    auto base64 = Utilities::EncodeBase64(string_view(text));
+    base64.insert(70, "\r\n");
+    base64.insert(131, " ");
+    Assert::AreEqual(text, Utilities::DecodeBase64(string_view(base64)));
+  }
+
+  TEST_METHOD(DecodeBase64RejectsInvalidInput)
+  {
+    constexpr const char* messages[] =
+    {
+      "Y",
+      "YWJjZ",
+      "YQ=",
+      "YQ===",
+      "YWJj=",
+      "YW=J",
+      "YWJj-A==",
+      "YWJj_A==",
+      "YWJjZA==YQ==",
+      "YWJjZGVmZ2hpamtsbW5vcHFyc3R1dnd4eXo*MDEyMzQ1Njc4OQ=="
+    };
+
+    for (auto message : messages)
+    {
+      uint8_t output[64];
+      auto name = winrt::to_hstring(message);
+      Assert::IsFalse(Utilities::DecodeBase64(string_view(message), output).has_value(), name.c_str());
+      Assert::IsTrue(Utilities::DecodeBase64(string_view(message)).empty());
+    }
+  }
+
+  TEST_METHOD(Base64MatchesCryptographicBuffer)
+  {
+    std::mt19937 random(42);
+    for (size_t size = 0; size < 300; ++size)
+    {
+      std::vector<uint8_t> bytes(size);
+      for (auto& byte : bytes)
+      {
+        byte = static_cast<uint8_t>(random());
+      }
+
+      auto expected = winrt::to_string(CryptographicBuffer::EncodeToBase64String(
+        CryptographicBuffer::CreateFromByteArray(bytes)));
+      auto actual = Utilities::EncodeBase64(string_view(reinterpret_cast<const char*>(bytes.data()), size));
+      Assert::AreEqual(expected, actual);
+
+      auto buffer = Utilities::DecodeBase64ToBuffer(actual);
+      Assert::IsTrue(static_cast<bool>(buffer));
+      Assert::AreEqual(static_cast<uint32_t>(size), buffer.Length());
+      Assert::IsTrue(std::equal(bytes.begin(), bytes.end(), buffer.data()));
+      Assert::AreEqual(expected, Utilities::EncodeBase64(buffer));
+    }
+  }
+
 #pragma endregion Base64 Tests
 };
 
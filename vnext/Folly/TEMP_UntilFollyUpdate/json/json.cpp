@@ -33,6 +33,16 @@
 #include <folly/lang/Bits.h>
 #include <folly/portability/Constexpr.h>
 
+// [Windows - Scan strings and whitespace 16 bytes at a time where SSE2 is available. MSVC does not define __SSE2__,
+// so FOLLY_SSE is 0 there.
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define FOLLY_JSON_SSE2 1
+#include <emmintrin.h>
+#else
+#define FOLLY_JSON_SSE2 0
+#endif
+// Windows]
+
 namespace folly {
 
 //////////////////////////////////////////////////////////////////////
@@ -300,6 +310,37 @@ struct Printer {
 
 //////////////////////////////////////////////////////////////////////
 
+// [Windows - Vectorized scans
+#if FOLLY_JSON_SSE2
+// Returns the number of bytes before the first one marked by stopMask, which
+// maps 16 bytes to a 16-bit mask, and adds the newlines in them to lineNum.
+// Only whole 16-byte chunks are scanned: when no byte is marked, the result is
+// the size rounded down to 16, and the caller scans the rest byte by byte.
+template <class StopMask>
+std::size_t scanChunks(
+    const char* p,
+    std::size_t size,
+    unsigned& lineNum,
+    const StopMask& stopMask) {
+  const __m128i newline = _mm_set1_epi8('\n');
+  std::size_t scanned = 0;
+  for (; scanned + 16 <= size; scanned += 16) {
+    auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + scanned));
+    auto stops = static_cast<unsigned>(stopMask(chunk));
+    auto newlines = static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline)));
+    if (stops) {
+      auto prefix = static_cast<unsigned>(findFirstSet(stops) - 1);
+      lineNum += popcount(newlines & ((1u << prefix) - 1));
+      return scanned + prefix;
+    }
+    lineNum += popcount(newlines);
+  }
+  return scanned;
+}
+#endif
+// Windows]
+
 // Wraps our input buffer with some helper functions.
 struct Input {
   explicit Input(StringPiece range, json::serialization_opts const* opts)
@@ -333,6 +374,26 @@ struct Input {
     return ret;
   }
 
+  // [Windows - Vectorized scans
+  // Skips the characters of a string up to the next quote or backslash.
+  StringPiece skipStringChars() {
+#if FOLLY_JSON_SSE2
+    std::size_t skipped = scanChunks(
+        range_.data(), range_.size(), lineNum_, [](__m128i chunk) {
+          return _mm_movemask_epi8(_mm_or_si128(
+              _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\"')),
+              _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'))));
+        });
+    auto ret = range_.subpiece(0, skipped);
+    range_.advance(skipped);
+    auto rest = skipWhile([](char c) { return c != '\"' && c != '\\'; });
+    return StringPiece(ret.begin(), rest.end());
+#else
+    return skipWhile([](char c) { return c != '\"' && c != '\\'; });
+#endif
+  }
+  // Windows]
+
   StringPiece skipDigits() {
     return skipWhile([](char c) { return c >= '0' && c <= '9'; });
   }
@@ -349,6 +410,23 @@ struct Input {
   void skipWhitespace() {
     // [Windows #12703 - CodeQL patch]
     std::size_t index = 0;
+    // [Windows - Vectorized scans: skip runs of indentation 16 bytes at a time.
+#if FOLLY_JSON_SSE2
+    if (range_.size() >= 16 && (range_[0] == ' ' || range_[0] == '\n')) {
+      index = scanChunks(
+          range_.data(), range_.size(), lineNum_, [](__m128i chunk) {
+            auto whitespace = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')),
+                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'))),
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t')),
+                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r'))));
+            return ~_mm_movemask_epi8(whitespace) & 0xffff;
+          });
+    }
+#endif
+    // Windows]
     while (true) {
       while (index < range_.size() && range_[index] == ' ') {
         index++;
@@ -674,7 +752,7 @@ std::string parseString(Input& in) {
 
   std::string ret;
   for (;;) {
-    auto range = in.skipWhile([](char c) { return c != '\"' && c != '\\'; });
+    auto range = in.skipStringChars(); // [Windows - Vectorized scans]
     ret.append(range.begin(), range.end());
 
     if (*in == '\"') {
@@ -839,10 +917,47 @@ void escapeStringImpl(
   auto* q = reinterpret_cast<const unsigned char*>(input.begin());
   auto* e = reinterpret_cast<const unsigned char*>(input.end());
 
+  // [Windows - Vectorized scans
+#if FOLLY_JSON_SSE2
+  // Without utf8 validation or non-ascii encoding, bytes >= 0x80 are copied
+  // as they are, so the vectorized scan does not stop at them.
+  const bool copyNonAscii = !opts.encode_non_ascii && !opts.validate_utf8 &&
+      !opts.skip_invalid_utf8;
+#endif
+  // Windows]
+
   while (p < e) {
     // Find the longest prefix that does not need escaping, and copy
     // it literally into the output string.
     auto firstEsc = p;
+    // [Windows - Vectorized scans
+#if FOLLY_JSON_SSE2
+    if /* constexpr */ (!EnableExtraAsciiEscapes) {
+      // An unsigned compare with 0x1f marks the bytes < 0x20. A signed
+      // compare with 0x20 marks them along with the bytes >= 0x80.
+      const __m128i controlMax = _mm_set1_epi8(0x1f);
+      const __m128i space = _mm_set1_epi8(0x20);
+      while (e - firstEsc >= 16) {
+        auto chunk =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(firstEsc));
+        auto escape = _mm_or_si128(
+            _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\"')),
+            _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')));
+        escape = _mm_or_si128(
+            escape,
+            copyNonAscii
+                ? _mm_cmpeq_epi8(_mm_max_epu8(chunk, controlMax), controlMax)
+                : _mm_cmplt_epi8(chunk, space));
+        auto mask = static_cast<unsigned>(_mm_movemask_epi8(escape));
+        if (mask) {
+          firstEsc += findFirstSet(mask) - 1;
+          break;
+        }
+        firstEsc += 16;
+      }
+    }
+#endif
+    // Windows]
     while (firstEsc < e) {
       auto avail = to_unsigned(e - firstEsc);
       uint64_t word = 0;
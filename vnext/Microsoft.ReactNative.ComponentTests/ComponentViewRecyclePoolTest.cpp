@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Fabric/Composition/ComponentViewRecyclePool.h>
+#include <memory>
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (ComponentViewRecyclePoolTest) {
+  // Stands in for a component view, with the methods ComponentViewRegistry recycles views through.
+  struct TestView {
+    explicit TestView(int64_t tag, bool recyclable = true) : Tag(tag), Recyclable(recyclable) {}
+
+    bool isRecyclable() const noexcept {
+      return Recyclable;
+    }
+
+    void recycle(int64_t tag) noexcept {
+      Tag = tag;
+      ++RecycleCount;
+    }
+
+    void onDestroying() noexcept {
+      ++DestroyingCount;
+    }
+
+    int64_t Tag;
+    bool Recyclable;
+    int RecycleCount{0};
+    int DestroyingCount{0};
+  };
+
+  using TestPool = ComponentViewRecyclePool<int64_t, std::shared_ptr<TestView>>;
+
+  TEST_METHOD(ComponentViewRecyclePool_TakeFromEmptyPoolMisses) {
+    TestPool pool;
+    TestCheck(!pool.take(1));
+    TestCheckEqual(0u, pool.stats().hits);
+    TestCheckEqual(1u, pool.stats().misses);
+  }
+
+  TEST_METHOD(ComponentViewRecyclePool_ReusesMostRecentViewOfSameType) {
+    TestPool pool;
+    auto first = std::make_shared<TestView>(1);
+    auto second = std::make_shared<TestView>(2);
+    auto other = std::make_shared<TestView>(3);
+    TestCheck(pool.put(10, first));
+    TestCheck(pool.put(10, second));
+    TestCheck(pool.put(20, other));
+    TestCheck(!first);
+    TestCheckEqual(2u, pool.size(10));
+
+    TestCheckEqual(2, (*pool.take(10))->Tag);
+    TestCheckEqual(1, (*pool.take(10))->Tag);
+    TestCheck(!pool.take(10));
+    TestCheckEqual(3, (*pool.take(20))->Tag);
+
+    TestCheckEqual(3u, pool.stats().hits);
+    TestCheckEqual(1u, pool.stats().misses);
+    TestCheckEqual(3u, pool.stats().recycled);
+  }
+
+  TEST_METHOD(ComponentViewRecyclePool_CapacityIsPerType) {
+    TestPool pool{2};
+    for (int64_t tag = 1; tag <= 3; ++tag) {
+      auto view = std::make_shared<TestView>(tag);
+      auto otherView = std::make_shared<TestView>(tag);
+      TestCheckEqual(tag <= 2, pool.put(10, view));
+      TestCheckEqual(tag <= 2, pool.put(20, otherView));
+      // A view the pool did not take is left to the caller.
+      TestCheckEqual(tag > 2, static_cast<bool>(view));
+    }
+    TestCheckEqual(2u, pool.size(10));
+    TestCheckEqual(2u, pool.size(20));
+    TestCheckEqual(2u, pool.stats().dropped);
+
+    pool.capacity(1);
+    TestCheckEqual(1u, pool.size(10));
+    TestCheckEqual(2, (*pool.take(10))->Tag);
+  }
+
+  TEST_METHOD(ComponentViewRecyclePool_ZeroCapacityDisablesRecycling) {
+    TestPool pool{0};
+    auto view = std::make_shared<TestView>(1);
+    TestCheck(!pool.put(10, view));
+    TestCheck(view);
+    TestCheck(!pool.take(10));
+  }
+
+  TEST_METHOD(ComponentViewRecyclePool_DequeueReusesEnqueuedView) {
+    TestPool pool;
+    int createCount = 0;
+    auto createView = [&](int64_t tag) {
+      ++createCount;
+      return std::make_shared<TestView>(tag);
+    };
+
+    auto view = pool.dequeue(10, 1, [&]() { return createView(1); });
+    TestCheckEqual(1, createCount);
+    TestCheckEqual(0, view->RecycleCount);
+
+    TestView *viewImpl = view.get();
+    pool.enqueue(10, std::move(view));
+    TestCheckEqual(1u, pool.size(10));
+    TestCheckEqual(0, viewImpl->DestroyingCount);
+
+    // Only a view of the same component type is reused, under the new tag.
+    auto otherView = pool.dequeue(20, 2, [&]() { return createView(2); });
+    TestCheckEqual(2, createCount);
+    TestCheck(otherView.get() != viewImpl);
+
+    auto reusedView = pool.dequeue(10, 3, [&]() { return createView(3); });
+    TestCheckEqual(2, createCount);
+    TestCheck(reusedView.get() == viewImpl);
+    TestCheckEqual(3, reusedView->Tag);
+    TestCheckEqual(1, reusedView->RecycleCount);
+    TestCheckEqual(0u, pool.size(10));
+  }
+
+  TEST_METHOD(ComponentViewRecyclePool_EnqueueDestroysViewsItCannotKeep) {
+    TestPool pool{1};
+    auto observedView = std::make_shared<TestView>(1, /*recyclable*/ false);
+    pool.enqueue(10, observedView);
+    TestCheckEqual(1, observedView->DestroyingCount);
+    TestCheckEqual(0u, pool.size(10));
+
+    auto keptView = std::make_shared<TestView>(2);
+    auto droppedView = std::make_shared<TestView>(3);
+    pool.enqueue(10, keptView);
+    pool.enqueue(10, droppedView);
+    TestCheckEqual(0, keptView->DestroyingCount);
+    TestCheckEqual(1, droppedView->DestroyingCount);
+    TestCheckEqual(1u, pool.size(10));
+    TestCheckEqual(1u, pool.stats().dropped);
+  }
+};
+
+} // namespace Microsoft::ReactNative
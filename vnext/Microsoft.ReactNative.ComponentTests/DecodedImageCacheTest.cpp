@@ -0,0 +1,251 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Fabric/DecodedImageCache.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (DecodedImageCacheTest) {
+  // Results are image sizes in bytes, with 0 standing for a failed decode.
+  using Cache = DecodedImageCache<size_t>;
+
+  static Cache::Waiter Ignore() {
+    return [](size_t) {};
+  }
+
+  // Decodes an image of `sizeInBytes` bytes, counting the decodes.
+  static auto Decode(size_t sizeInBytes, int &decodeCount) {
+    return [sizeInBytes, &decodeCount]() {
+      ++decodeCount;
+      return std::make_pair(sizeInBytes, sizeInBytes);
+    };
+  }
+
+  // Requests an image as WindowsImageManager does, loading content identified by `validator` unless a request for the
+  // same image is in flight.
+  static size_t Request(Cache &cache, const DecodedImageKey &key, const std::string &validator, size_t sizeInBytes) {
+    int decodeCount = 0;
+    TestCheck(Cache::Lookup::Started == cache.Acquire(key, Ignore()));
+    return cache.Complete(key, validator, Decode(sizeInBytes, decodeCount));
+  }
+
+  TEST_METHOD(DecodedImageCache_CachesBySourceAndSize) {
+    Cache cache{1000};
+    int decodeCount = 0;
+    TestCheck(Cache::Lookup::Started == cache.Acquire({"a.png", 100, 50}, Ignore()));
+    TestCheckEqual(200u, cache.Complete({"a.png", 100, 50}, "v1", Decode(200, decodeCount)));
+
+    // The content is loaded again, but not decoded again while it is unchanged.
+    TestCheck(Cache::Lookup::Started == cache.Acquire({"a.png", 100, 50}, Ignore()));
+    TestCheckEqual(200u, cache.Complete({"a.png", 100, 50}, "v1", Decode(300, decodeCount)));
+    TestCheckEqual(1, decodeCount);
+
+    TestCheckEqual(100u, Request(cache, {"a.png", 50, 25}, "v1", 100));
+    TestCheckEqual(200u, Request(cache, {"b.png", 100, 50}, "v1", 200));
+
+    auto stats = cache.Stats();
+    TestCheckEqual(1u, stats.Hits);
+    TestCheckEqual(3u, stats.Decodes);
+    TestCheckEqual(3u, stats.Count);
+    TestCheckEqual(500u, stats.Bytes);
+  }
+
+  TEST_METHOD(DecodedImageCache_ChangedContentIsDecodedAgain) {
+    Cache cache{1000};
+    int decodeCount = 0;
+    Request(cache, {"a.png"}, "v1", 200);
+
+    cache.Acquire({"a.png"}, Ignore());
+    TestCheckEqual(300u, cache.Complete({"a.png"}, "v2", Decode(300, decodeCount)));
+    TestCheckEqual(1, decodeCount);
+    TestCheckEqual(300u, cache.Stats().Bytes);
+
+    // Only the image of the latest content is kept.
+    cache.Acquire({"a.png"}, Ignore());
+    TestCheckEqual(200u, cache.Complete({"a.png"}, "v1", Decode(200, decodeCount)));
+    TestCheckEqual(2, decodeCount);
+    TestCheckEqual(1u, cache.Stats().Count);
+    TestCheckEqual(0u, cache.Stats().Hits);
+  }
+
+  TEST_METHOD(DecodedImageCache_ContentWithoutValidatorIsNotCached) {
+    Cache cache{1000};
+    int decodeCount = 0;
+    Request(cache, {"a.png"}, "v1", 200);
+
+    // A response without a validator may differ from the cached content, which is dropped.
+    cache.Acquire({"a.png"}, Ignore());
+    TestCheckEqual(300u, cache.Complete({"a.png"}, "", Decode(300, decodeCount)));
+    cache.Acquire({"a.png"}, Ignore());
+    TestCheckEqual(300u, cache.Complete({"a.png"}, "", Decode(300, decodeCount)));
+
+    TestCheckEqual(2, decodeCount);
+    TestCheckEqual(0u, cache.Stats().Count);
+  }
+
+  TEST_METHOD(DecodedImageCache_RequestsInFlightShareOneLoad) {
+    Cache cache{1000};
+    int decodeCount = 0;
+    std::vector<size_t> received;
+    auto waiter = [&received](size_t image) { received.push_back(image); };
+
+    TestCheck(Cache::Lookup::Started == cache.Acquire({"a.png"}, waiter));
+    TestCheck(Cache::Lookup::Joined == cache.Acquire({"a.png"}, waiter));
+    TestCheck(Cache::Lookup::Joined == cache.Acquire({"a.png"}, waiter));
+    TestCheck(received.empty());
+
+    // The request that loads the image is not called back: it receives the result itself.
+    TestCheckEqual(300u, cache.Complete({"a.png"}, "v1", Decode(300, decodeCount)));
+    TestCheckEqual(1, decodeCount);
+    TestCheckEqual(2u, received.size());
+    TestCheckEqual(300u, received[0]);
+    TestCheckEqual(300u, received[1]);
+
+    // Requests that join a request served by the cache receive the cached image.
+    TestCheck(Cache::Lookup::Started == cache.Acquire({"a.png"}, waiter));
+    TestCheck(Cache::Lookup::Joined == cache.Acquire({"a.png"}, waiter));
+    TestCheckEqual(300u, cache.Complete({"a.png"}, "v1", Decode(400, decodeCount)));
+    TestCheckEqual(1, decodeCount);
+    TestCheckEqual(3u, received.size());
+    TestCheckEqual(300u, received[2]);
+
+    auto stats = cache.Stats();
+    TestCheckEqual(3u, stats.Joins);
+    TestCheckEqual(1u, stats.Hits);
+    TestCheckEqual(1u, stats.Decodes);
+  }
+
+  TEST_METHOD(DecodedImageCache_FailedDecodesAreNotCached) {
+    Cache cache{1000};
+    int decodeCount = 0;
+    std::vector<size_t> received;
+    TestCheck(Cache::Lookup::Started == cache.Acquire({"a.png"}, Ignore()));
+    TestCheck(Cache::Lookup::Joined == cache.Acquire({"a.png"}, [&received](size_t image) {
+      received.push_back(image);
+    }));
+    TestCheckEqual(0u, cache.Complete({"a.png"}, "v1", Decode(0, decodeCount)));
+
+    TestCheckEqual(1u, received.size());
+    TestCheckEqual(0u, received[0]);
+    TestCheckEqual(200u, Request(cache, {"a.png"}, "v1", 200));
+    TestCheckEqual(0u, cache.Stats().Hits);
+    TestCheckEqual(1u, cache.Stats().Count);
+  }
+
+  TEST_METHOD(DecodedImageCache_EvictsLeastRecentlyUsedBytes) {
+    Cache cache{1000};
+    int decodeCount = 0;
+    for (auto uri : {"a.png", "b.png", "c.png"}) {
+      Request(cache, {uri}, "v1", 400);
+    }
+
+    // a.png was dropped to make room for c.png.
+    cache.Acquire({"a.png"}, Ignore());
+    cache.Acquire({"b.png"}, Ignore());
+    cache.Complete({"b.png"}, "v1", Decode(400, decodeCount));
+    TestCheckEqual(0, decodeCount);
+    cache.Complete({"a.png"}, "v1", Decode(400, decodeCount));
+    TestCheckEqual(1, decodeCount);
+
+    // c.png was used less recently than b.png. Images larger than the capacity are returned, but not cached.
+    cache.Acquire({"c.png"}, Ignore());
+    TestCheckEqual(2000u, cache.Complete({"c.png"}, "v1", Decode(2000, decodeCount)));
+    TestCheckEqual(2, decodeCount);
+
+    auto stats = cache.Stats();
+    TestCheckEqual(2u, stats.Evictions);
+    TestCheckEqual(2u, stats.Count);
+    TestCheckEqual(800u, stats.Bytes);
+    TestCheckEqual(800u, stats.PeakBytes);
+  }
+
+  TEST_METHOD(DecodedImageCache_TrimsOnRequest) {
+    Cache cache{1000};
+    int decodeCount = 0;
+    for (auto uri : {"a.png", "b.png", "c.png", "d.png"}) {
+      Request(cache, {uri}, "v1", 250);
+    }
+
+    cache.Trim(cache.Stats().Bytes / 2);
+    TestCheckEqual(500u, cache.Stats().Bytes);
+    cache.Acquire({"d.png"}, Ignore());
+    cache.Complete({"d.png"}, "v1", Decode(250, decodeCount));
+    TestCheckEqual(0, decodeCount);
+    cache.Acquire({"a.png"}, Ignore());
+    cache.Complete({"a.png"}, "v1", Decode(250, decodeCount));
+    TestCheckEqual(1, decodeCount);
+
+    cache.Capacity(250);
+    TestCheckEqual(1u, cache.Stats().Count);
+    cache.Acquire({"a.png"}, Ignore());
+    cache.Complete({"a.png"}, "v1", Decode(250, decodeCount));
+    TestCheckEqual(1, decodeCount);
+
+    cache.Clear();
+    TestCheckEqual(0u, cache.Stats().Bytes);
+    TestCheckEqual(250u, cache.Capacity());
+  }
+
+  TEST_METHOD(DecodedImageCache_DecodedSizeCoversTarget) {
+    // Scaled keeping the aspect ratio, covering the target in both directions.
+    auto [width, height] = DecodedImageSize(1024, 768, 128, 128);
+    TestCheckEqual(171u, width);
+    TestCheckEqual(128u, height);
+    std::tie(width, height) = DecodedImageSize(1024, 768, 100, 20);
+    TestCheckEqual(100u, width);
+    TestCheckEqual(75u, height);
+
+    // Never scaled up.
+    std::tie(width, height) = DecodedImageSize(64, 48, 128, 128);
+    TestCheckEqual(64u, width);
+    TestCheckEqual(48u, height);
+    std::tie(width, height) = DecodedImageSize(1024, 768, 2048, 10);
+    TestCheckEqual(1024u, width);
+    TestCheckEqual(768u, height);
+
+    // Without a target, the full size.
+    std::tie(width, height) = DecodedImageSize(1024, 768, 0, 0);
+    TestCheckEqual(1024u, width);
+    TestCheckEqual(768u, height);
+  }
+
+  TEST_METHOD(DecodedImageCache_DownsamplesToLayoutSize) {
+    // Without the option, every layout size shares the image decoded to its full size.
+    auto key = MakeDecodedImageKey("photo.jpg", 64, 48, 2, false);
+    TestCheck(key == MakeDecodedImageKey("photo.jpg", 320, 240, 1.5f, false));
+    TestCheckEqual(0u, key.Width);
+    TestCheckEqual(0u, key.Height);
+
+    // With it, the layout size in pixels, rounded up.
+    key = MakeDecodedImageKey("photo.jpg", 64, 48, 2, true);
+    TestCheckEqual(128u, key.Width);
+    TestCheckEqual(96u, key.Height);
+    auto other = MakeDecodedImageKey("photo.jpg", 33.3f, 25, 1.5f, true);
+    TestCheckEqual(50u, other.Width);
+    TestCheckEqual(38u, other.Height);
+
+    // Images laid out at other sizes are decoded to their own size, rather than joining the request in flight.
+    Cache cache{1024 * 1024};
+    int decodeCount = 0;
+    auto decodeTo = [&decodeCount](const DecodedImageKey &key) {
+      return [&decodeCount, key]() {
+        ++decodeCount;
+        auto [width, height] = DecodedImageSize(1024, 768, key.Width, key.Height);
+        size_t sizeInBytes = static_cast<size_t>(width) * height * 4;
+        return std::make_pair(sizeInBytes, sizeInBytes);
+      };
+    };
+    TestCheck(Cache::Lookup::Started == cache.Acquire(key, Ignore()));
+    TestCheck(Cache::Lookup::Started == cache.Acquire(other, Ignore()));
+    TestCheckEqual(128u * 96u * 4u, cache.Complete(key, "v1", decodeTo(key)));
+    TestCheckEqual(51u * 38u * 4u, cache.Complete(other, "v1", decodeTo(other)));
+    TestCheckEqual(2, decodeCount);
+    TestCheckEqual(2u, cache.Stats().Count);
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,233 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Fabric/Composition/HitTestIndex.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (HitTestIndexTest) {
+  // Stands in for a component view, hit testing its children and its frame as ViewComponentView::hitTest does, or
+  // only within its frame and offset by the scroll position as ScrollViewComponentView::hitTest does.
+  struct TestView {
+    TestView(int64_t tag, float x, float y, float width, float height, bool isScrollView = false)
+        : Tag(tag), Frame(HitTestBounds::fromFrame(x, y, width, height)), IsScrollView(isScrollView) {}
+
+    TestView *mount(std::unique_ptr<TestView> child) {
+      child->Parent = this;
+      Children.push_back(std::move(child));
+      invalidate();
+      return Children.back().get();
+    }
+
+    void setFrame(float x, float y, float width, float height) {
+      Frame = HitTestBounds::fromFrame(x, y, width, height);
+      invalidate();
+    }
+
+    void invalidate() {
+      for (auto view = this; view && view->Index.invalidate(); view = view->Parent) {
+      }
+    }
+
+    const HitTestBounds &bounds() const {
+      return Index.bounds(
+          Frame, IsScrollView, Children.size(), [this](size_t index) { return Children[index]->bounds(); });
+    }
+
+    int64_t hitTest(float x, float y, bool useIndex) const {
+      float localX = x - Frame.left;
+      float localY = y - Frame.top;
+      bool inFrame =
+          localX >= 0 && localX <= Frame.right - Frame.left && localY >= 0 && localY <= Frame.bottom - Frame.top;
+      if (IsScrollView && !inFrame) {
+        return -1;
+      }
+
+      float contentX = localX;
+      float contentY = localY + ScrollY;
+      int64_t targetTag = -1;
+      if (useIndex) {
+        bounds();
+        Index.visitChildrenAt(contentX, contentY, [&](size_t index) {
+          targetTag = Children[index]->hitTest(contentX, contentY, true);
+          return targetTag != -1;
+        });
+      } else {
+        for (auto index = Children.size(); index-- > 0 && targetTag == -1;) {
+          targetTag = Children[index]->hitTest(contentX, contentY, false);
+        }
+      }
+      if (targetTag != -1) {
+        return targetTag;
+      }
+      return inFrame ? Tag : -1;
+    }
+
+    int64_t Tag;
+    HitTestBounds Frame;
+    bool IsScrollView;
+    float ScrollY{0};
+    TestView *Parent{nullptr};
+    std::vector<std::unique_ptr<TestView>> Children;
+    mutable HitTestIndex Index;
+  };
+
+  // Collects the children that visitChildrenAt visits at a point, all of them.
+  static std::vector<size_t> VisitAll(const HitTestIndex &index, float x, float y) {
+    std::vector<size_t> visited;
+    index.visitChildrenAt(x, y, [&](size_t child) {
+      visited.push_back(child);
+      return false;
+    });
+    return visited;
+  }
+
+  static std::vector<size_t> VisitAllLinearly(const std::vector<HitTestBounds> &childBounds, float x, float y) {
+    std::vector<size_t> visited;
+    for (auto index = childBounds.size(); index-- > 0;) {
+      if (childBounds[index].contains(x, y)) {
+        visited.push_back(index);
+      }
+    }
+    return visited;
+  }
+
+  // A window with a list of 500 cards in a scroll view, each card with an image, text, a row of 4 buttons and a badge
+  // that overflows the card: 5003 views.
+  static std::unique_ptr<TestView> MakeListTree(TestView *&scrollView) {
+    int64_t tag = 0;
+    auto root = std::make_unique<TestView>(tag++, 0.0f, 0.0f, 1280.0f, 800.0f);
+    scrollView = root->mount(std::make_unique<TestView>(tag++, 0.0f, 0.0f, 1280.0f, 800.0f, true));
+    auto content = scrollView->mount(std::make_unique<TestView>(tag++, 0.0f, 0.0f, 1280.0f, 7900.0f));
+    for (int card = 0; card < 500; ++card) {
+      auto cardView = content->mount(
+          std::make_unique<TestView>(tag++, 8.0f + (card % 10) * 127.0f, 8.0f + (card / 10) * 158.0f, 120.0f, 150.0f));
+      cardView->mount(std::make_unique<TestView>(tag++, 0.0f, 0.0f, 120.0f, 80.0f));
+      cardView->mount(std::make_unique<TestView>(tag++, 4.0f, 84.0f, 112.0f, 16.0f));
+      cardView->mount(std::make_unique<TestView>(tag++, 4.0f, 102.0f, 112.0f, 14.0f));
+      auto row = cardView->mount(std::make_unique<TestView>(tag++, 4.0f, 120.0f, 112.0f, 24.0f));
+      for (int button = 0; button < 4; ++button) {
+        row->mount(std::make_unique<TestView>(tag++, button * 28.0f, 0.0f, 24.0f, 24.0f));
+      }
+      cardView->mount(std::make_unique<TestView>(tag++, 108.0f, -6.0f, 18.0f, 18.0f));
+    }
+    TestCheckEqual(int64_t{5003}, tag);
+    return root;
+  }
+
+  TEST_METHOD(HitTestIndex_BoundsIncludeChildrenOutsideFrame) {
+    TestView view{1, 10.0f, 10.0f, 100.0f, 100.0f};
+    view.mount(std::make_unique<TestView>(2, 90.0f, -20.0f, 50.0f, 50.0f));
+    auto bounds = view.bounds();
+    TestCheckEqual(10.0f, bounds.left);
+    TestCheckEqual(-10.0f, bounds.top);
+    TestCheckEqual(150.0f, bounds.right);
+    TestCheckEqual(110.0f, bounds.bottom);
+    TestCheckEqual(2, view.hitTest(145.0f, -5.0f, true));
+
+    // Scroll views only hit test their children within their frame.
+    TestView scrollView{3, 0.0f, 0.0f, 100.0f, 100.0f, true};
+    scrollView.mount(std::make_unique<TestView>(4, 0.0f, 0.0f, 100.0f, 1000.0f));
+    TestCheckEqual(100.0f, scrollView.bounds().bottom);
+    scrollView.ScrollY = 500.0f;
+    TestCheckEqual(4, scrollView.hitTest(50.0f, 50.0f, true));
+    TestCheckEqual(-1, scrollView.hitTest(50.0f, 150.0f, true));
+  }
+
+  TEST_METHOD(HitTestIndex_LastChildIsHitFirst) {
+    for (int childCount : {4, 64}) {
+      TestView view{0, 0.0f, 0.0f, 1000.0f, 1000.0f};
+      for (int child = 1; child <= childCount; ++child) {
+        view.mount(std::make_unique<TestView>(child, child * 10.0f, 0.0f, 100.0f, 100.0f));
+      }
+      // Edges are included.
+      TestCheckEqual(std::min(childCount, 10), view.hitTest(100.0f, 100.0f, true));
+      TestCheckEqual(1, view.hitTest(10.0f, 50.0f, true));
+      TestCheckEqual(0, view.hitTest(5.0f, 50.0f, true));
+      TestCheckEqual(0, view.hitTest(5.0f, 500.0f, true));
+      TestCheckEqual(-1, view.hitTest(5.0f, 1001.0f, true));
+    }
+  }
+
+  TEST_METHOD(HitTestIndex_GridVisitsChildrenLikeLinearScan) {
+    std::mt19937 random{7};
+    std::uniform_real_distribution<float> position{-100.0f, 1100.0f};
+    std::uniform_real_distribution<float> size{0.0f, 150.0f};
+    for (size_t childCount : {size_t{32}, size_t{100}, size_t{1000}}) {
+      std::vector<HitTestBounds> childBounds;
+      for (size_t child = 0; child < childCount; ++child) {
+        childBounds.push_back(HitTestBounds::fromFrame(position(random), position(random), size(random), size(random)));
+      }
+      // Empty and huge children.
+      childBounds[1] = {};
+      childBounds[2] = HitTestBounds::fromFrame(-5000.0f, -5000.0f, 10000.0f, 10000.0f);
+
+      HitTestIndex index;
+      index.bounds(HitTestBounds::fromFrame(0.0f, 0.0f, 1000.0f, 1000.0f), false, childCount, [&](size_t child) {
+        return childBounds[child];
+      });
+      for (int point = 0; point < 2000; ++point) {
+        float x = position(random);
+        float y = position(random);
+        TestCheck(VisitAll(index, x, y) == VisitAllLinearly(childBounds, x, y));
+      }
+      const auto &bounds = childBounds[childCount - 1];
+      TestCheck(
+          VisitAll(index, bounds.right, bounds.bottom) == VisitAllLinearly(childBounds, bounds.right, bounds.bottom));
+    }
+  }
+
+  TEST_METHOD(HitTestIndex_ChangesInvalidateAncestors) {
+    TestView *scrollView = nullptr;
+    auto root = MakeListTree(scrollView);
+    auto content = scrollView->Children[0].get();
+    auto card = content->Children[0].get();
+    auto button = card->Children[3]->Children[0].get();
+    TestCheckEqual(int64_t{8}, button->Tag);
+    TestCheckEqual(button->Tag, root->hitTest(20.0f, 140.0f, true));
+    TestCheckEqual(content->Tag, root->hitTest(2.0f, 140.0f, true));
+    TestCheck(root->Index.isValid() && button->Index.isValid());
+
+    // Moves the button out of its card, into the margin left of the cards.
+    button->setFrame(-30.0f, 0.0f, 24.0f, 24.0f);
+    TestCheck(!button->Index.isValid() && !card->Index.isValid() && !content->Index.isValid());
+    TestCheck(!root->Index.isValid());
+    TestCheck(content->Children[1]->Index.isValid());
+    TestCheckEqual(card->Children[3]->Tag, root->hitTest(20.0f, 140.0f, true));
+    TestCheckEqual(button->Tag, root->hitTest(2.0f, 140.0f, true));
+    TestCheckEqual(-18.0f, card->bounds().left);
+
+    // Unmounting the last card makes the content under it hit.
+    scrollView->ScrollY = 7100.0f;
+    auto lastCard = content->Children.back().get();
+    TestCheckEqual(lastCard->Tag, root->hitTest(1211.0f, 732.0f, true));
+    content->Children.pop_back();
+    content->invalidate();
+    TestCheckEqual(content->Tag, root->hitTest(1211.0f, 732.0f, true));
+  }
+
+  // Replays pointer moves, a random walk over the window that scrolls now and then, over a tree of 5k views, and checks
+  // that hit testing with the index hits the views that hit testing every view does.
+  TEST_METHOD(HitTestIndex_HitsTheViewsThatHitTestingEveryViewHits) {
+    constexpr int moveCount = 2000;
+    TestView *scrollView = nullptr;
+    auto root = MakeListTree(scrollView);
+
+    std::mt19937 random{42};
+    std::uniform_real_distribution<float> step{-24.0f, 24.0f};
+    float x = 640.0f;
+    float y = 400.0f;
+    for (int move = 0; move < moveCount; ++move) {
+      x = std::clamp(x + step(random), 0.0f, 1280.0f);
+      y = std::clamp(y + step(random), 0.0f, 800.0f);
+      scrollView->ScrollY = static_cast<float>((move / 100) * 350);
+      TestCheckEqual(root->hitTest(x, y, false), root->hitTest(x, y, true));
+    }
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,179 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/IncrementalLayout.h>
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (IncrementalLayoutTest) {
+  // A Yoga tree of rows of fixed size leaves, with the tags of the children of each node, as NativeUIManager keeps
+  // them in its shadow nodes.
+  struct TestTree {
+    TestTree(int rowCount, int leafCount) {
+      m_config = YGConfigNew();
+      m_root = AddNode();
+      YGNodeStyleSetFlexDirection(m_root, YGFlexDirectionColumn);
+      for (int row = 0; row < rowCount; ++row) {
+        auto rowNode = AddNode();
+        YGNodeStyleSetFlexDirection(rowNode, YGFlexDirectionRow);
+        AddChild(0, rowNode);
+        for (int leaf = 0; leaf < leafCount; ++leaf) {
+          auto leafNode = AddNode();
+          YGNodeStyleSetWidth(leafNode, 10);
+          YGNodeStyleSetHeight(leafNode, 10);
+          AddChild(static_cast<int64_t>(m_nodes.size()) - leaf - 2, leafNode);
+        }
+      }
+    }
+
+    ~TestTree() {
+      YGNodeFreeRecursive(m_root);
+      YGConfigFree(m_config);
+    }
+
+    YGNodeRef AddNode() {
+      auto node = YGNodeNewWithConfig(m_config);
+      m_nodes.push_back(node);
+      m_children.emplace_back();
+      m_frames.push_back({-1, -1, -1, -1});
+      return node;
+    }
+
+    void AddChild(int64_t parentTag, YGNodeRef child) {
+      auto parent = m_nodes[parentTag];
+      YGNodeInsertChild(parent, child, YGNodeGetChildCount(parent));
+      m_children[parentTag].push_back(static_cast<int64_t>(m_nodes.size()) - 1);
+    }
+
+    static std::array<float, 4> Frame(YGNodeRef node) {
+      return {
+          YGNodeLayoutGetLeft(node), YGNodeLayoutGetTop(node), YGNodeLayoutGetWidth(node), YGNodeLayoutGetHeight(node)};
+    }
+
+    // Lays out the tree as NativeUIManager::ApplyLayout does, keeping the frame of each visited node as the frame set
+    // on its view, and returns the tags of the visited nodes.
+    std::vector<int64_t> Layout(LayoutBatchStats &stats) {
+      YGNodeCalculateLayout(m_root, m_width, YGUndefined, YGDirectionLTR);
+
+      std::vector<int64_t> visited;
+      VisitNewLayouts(
+          0,
+          [this](int64_t tag) { return m_nodes[tag]; },
+          [this](int64_t tag, auto const &visitChild) {
+            for (auto child : m_children[tag]) {
+              visitChild(child);
+            }
+          },
+          [this, &visited](int64_t tag, YGNodeRef node) {
+            visited.push_back(tag);
+            m_frames[tag] = Frame(node);
+          },
+          stats);
+      return visited;
+    }
+
+    bool FramesMatchLayout() const {
+      for (size_t tag = 0; tag < m_nodes.size(); ++tag) {
+        if (m_frames[tag] != Frame(m_nodes[tag])) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    float m_width{2000};
+    YGConfigRef m_config;
+    YGNodeRef m_root;
+    std::vector<YGNodeRef> m_nodes;
+    std::vector<std::vector<int64_t>> m_children;
+    std::vector<std::array<float, 4>> m_frames;
+  };
+
+  TEST_METHOD(IncrementalLayout_FirstLayoutVisitsEveryNode) {
+    TestTree tree{10, 10};
+    LayoutBatchStats stats;
+    auto visited = tree.Layout(stats);
+
+    TestCheckEqual(tree.m_nodes.size(), visited.size());
+    // Children are visited before their parent.
+    TestCheckEqual(0, visited.back());
+    TestCheck(tree.FramesMatchLayout());
+  }
+
+  TEST_METHOD(IncrementalLayout_LeafChangeVisitsItsAncestorsAndTheirChildren) {
+    TestTree tree{10, 10};
+    LayoutBatchStats stats;
+    tree.Layout(stats);
+
+    // The first leaf of the third row.
+    const int64_t leafTag = 2 * 11 + 2;
+    YGNodeStyleSetWidth(tree.m_nodes[leafTag], 20);
+    stats = {};
+    auto visited = tree.Layout(stats);
+
+    TestCheck(std::find(visited.begin(), visited.end(), leafTag) != visited.end());
+    // The root, its 10 rows and the 10 leaves of the changed row.
+    TestCheckEqual(21u, visited.size());
+    // The leaves of the other rows are reached, but not visited through.
+    TestCheckEqual(111u, stats.NodesVisited);
+    TestCheck(tree.FramesMatchLayout());
+  }
+
+  TEST_METHOD(IncrementalLayout_FramesMatchFullLayoutAfterChanges) {
+    TestTree tree{20, 20};
+    LayoutBatchStats stats;
+    tree.Layout(stats);
+
+    std::mt19937 random{11};
+    for (int pass = 0; pass < 200; ++pass) {
+      const auto tag = std::uniform_int_distribution<size_t>{1, tree.m_nodes.size() - 1}(random);
+      const auto size = static_cast<float>(std::uniform_int_distribution<int>{0, 30}(random));
+      if (tree.m_children[tag].empty()) {
+        YGNodeStyleSetWidth(tree.m_nodes[tag], size);
+      } else {
+        // Moves the leaves of a row, without changing the size of the row.
+        YGNodeStyleSetPadding(tree.m_nodes[tag], YGEdgeLeft, size);
+      }
+      tree.Layout(stats);
+      TestCheck(tree.FramesMatchLayout());
+    }
+  }
+
+  TEST_METHOD(IncrementalLayout_CleanTreeOnlyVisitsRoot) {
+    TestTree tree{10, 10};
+    LayoutBatchStats stats;
+    tree.Layout(stats);
+
+    stats = {};
+    auto visited = tree.Layout(stats);
+    TestCheckEqual(1u, visited.size());
+    // The rows are reached, but not visited through, as Yoga takes the layout of the root from its cache.
+    TestCheckEqual(11u, stats.NodesVisited);
+  }
+
+  TEST_METHOD(IncrementalLayout_RootResizeMovesChildrenOfNodesThatKeepTheirSize) {
+    TestTree tree{10, 10};
+    // The rows keep their width when the root gets narrower, but their padding follows the root width.
+    for (auto rowTag : tree.m_children[0]) {
+      YGNodeStyleSetMaxWidth(tree.m_nodes[rowTag], 500);
+      YGNodeStyleSetPaddingPercent(tree.m_nodes[rowTag], YGEdgeLeft, 10);
+    }
+    LayoutBatchStats stats;
+    tree.Layout(stats);
+    TestCheckEqual(200.0f, YGNodeLayoutGetLeft(tree.m_nodes[2]));
+
+    tree.m_width = 1000;
+    auto visited = tree.Layout(stats);
+    TestCheckEqual(500.0f, YGNodeLayoutGetWidth(tree.m_nodes[1]));
+    TestCheckEqual(100.0f, YGNodeLayoutGetLeft(tree.m_nodes[2]));
+    TestCheck(std::find(visited.begin(), visited.end(), 2) != visited.end());
+    TestCheck(tree.FramesMatchLayout());
+  }
+};
+
+} // namespace Microsoft::ReactNative
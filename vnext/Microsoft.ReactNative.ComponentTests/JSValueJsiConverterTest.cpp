@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <JSI/ChakraRuntimeArgs.h>
+#include <JSI/ChakraRuntimeFactory.h>
+#include <JSValueJsiConverter.h>
+#include <JsiReader.h>
+#include <JsiWriter.h>
+
+namespace winrt::Microsoft::ReactNative {
+
+TEST_CLASS (JSValueJsiConverterTest) {
+  std::unique_ptr<::facebook::jsi::Runtime> m_runtime;
+
+  JSValueJsiConverterTest()
+      : m_runtime(::Microsoft::JSI::makeChakraRuntime(::Microsoft::JSI::ChakraRuntimeArgs{})) {}
+
+  static JSValue MakeMixedValue() {
+    return JSValueObject{
+        {"null", nullptr},
+        {"bool", true},
+        {"int", 42},
+        {"negative", -7},
+        {"double", 4.5},
+        {"string", "Hello \xD0\x9C\xD0\xB8\xD1\x80"},
+        {"empty", ""},
+        {"array", JSValueArray{1, "two", 3.25, false, nullptr, JSValueArray{}, JSValueObject{}}},
+        {"object", JSValueObject{{"nested", JSValueObject{{"x", 1}, {"y", JSValueArray{2, 3}}}}}}};
+  }
+
+  static JSValue MakeLargeArray(size_t size) {
+    JSValueArray result;
+    result.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+      result.push_back(JSValueObject{
+          {"id", static_cast<int64_t>(i)},
+          {"title", "Item " + std::to_string(i)},
+          {"score", static_cast<double>(i) + 0.5},
+          {"visible", (i % 2) == 0}});
+    }
+
+    return JSValue{std::move(result)};
+  }
+
+  static JSValue MakeDeepObject(size_t depth) {
+    JSValue result = JSValueArray{1, 2, 3};
+    for (size_t i = 0; i < depth; ++i) {
+      result = JSValueObject{{"level", static_cast<int64_t>(i)}, {"name", "node"}, {"child", std::move(result)}};
+    }
+
+    return result;
+  }
+
+  facebook::jsi::Value WriteWithJsiWriter(JSValue const &value) {
+    IJSValueWriter writer = winrt::make<JsiWriter>(*m_runtime);
+    value.WriteTo(writer);
+    return writer.as<JsiWriter>()->MoveResult();
+  }
+
+  JSValue ReadWithJsiReader(facebook::jsi::Value const &value) {
+    IJSValueReader reader = winrt::make<JsiReader>(*m_runtime, value);
+    return JSValue::ReadFrom(reader);
+  }
+
+  TEST_METHOD(JsiValueFromJSValue_MatchesJsiWriter) {
+    for (JSValue const &expected : {MakeMixedValue(), MakeLargeArray(10), MakeDeepObject(10)}) {
+      facebook::jsi::Value directValue = JsiValueFromJSValue(*m_runtime, expected);
+      facebook::jsi::Value writerValue = WriteWithJsiWriter(expected);
+      TestCheck(ReadWithJsiReader(directValue).Equals(ReadWithJsiReader(writerValue)));
+      TestCheck(ReadWithJsiReader(directValue).Equals(expected));
+    }
+  }
+
+  TEST_METHOD(JsiValueFromJSValue_Scalars) {
+    TestCheck(JsiValueFromJSValue(*m_runtime, JSValue{}).isNull());
+    TestCheckEqual(3.0, JsiValueFromJSValue(*m_runtime, JSValue{3}).getNumber());
+    TestCheckEqual(3.5, JsiValueFromJSValue(*m_runtime, JSValue{3.5}).getNumber());
+    TestCheckEqual(true, JsiValueFromJSValue(*m_runtime, JSValue{true}).getBool());
+    TestCheckEqual("abc", JsiValueFromJSValue(*m_runtime, JSValue{"abc"}).getString(*m_runtime).utf8(*m_runtime));
+  }
+
+  TEST_METHOD(JSValueJsiConverter_LargeValuesMatchAbiPath) {
+    for (JSValue const &payload : {MakeLargeArray(10000), MakeDeepObject(200)}) {
+      JSValue directValue = ReadWithJsiReader(JsiValueFromJSValue(*m_runtime, payload));
+      TestCheck(directValue.Equals(ReadWithJsiReader(WriteWithJsiWriter(payload))));
+      TestCheck(directValue.Equals(payload));
+    }
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,120 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <ModuleConstantsSnapshot.h>
+#include <chrono>
+#include <string>
+
+using winrt::Microsoft::ReactNative::ModuleConstantsSnapshot;
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (ModuleConstantsSnapshotTest) {
+  static ModuleConstantsSnapshot MakeSnapshot(std::string key = "1.0|42") {
+    return ModuleConstantsSnapshot(std::move(key), {"DeviceInfo", "PlatformConstants", "Line\nBreak"});
+  }
+
+  TEST_METHOD(ModuleConstantsSnapshot_RoundTrips) {
+    auto snapshot = MakeSnapshot();
+    snapshot.Record("DeviceInfo", R"({"Dimensions":{"window":{"width":800,"height":600}}})");
+    snapshot.Record("PlatformConstants", "{}");
+    TestCheck(snapshot.IsDirty());
+
+    // The snapshot stays dirty until the serialized content is saved.
+    uint64_t revision = 0;
+    auto content = snapshot.Serialize(&revision);
+    TestCheck(snapshot.IsDirty());
+    snapshot.MarkSaved(revision);
+    TestCheck(!snapshot.IsDirty());
+
+    auto loaded = MakeSnapshot();
+    TestCheck(loaded.Load(content));
+    TestCheck(!loaded.IsDirty());
+    TestCheckEqual(
+        std::string(R"({"Dimensions":{"window":{"width":800,"height":600}}})"), *loaded.TryGet("DeviceInfo"));
+    TestCheckEqual(std::string("{}"), *loaded.TryGet("PlatformConstants"));
+    TestCheck(!loaded.TryGet("Other"));
+  }
+
+  TEST_METHOD(ModuleConstantsSnapshot_IgnoresOtherKeys) {
+    auto snapshot = MakeSnapshot("1.0|42");
+    snapshot.Record("DeviceInfo", "{}");
+
+    auto loaded = MakeSnapshot("1.1|43");
+    TestCheck(!loaded.Load(snapshot.Serialize()));
+    TestCheck(!loaded.TryGet("DeviceInfo"));
+  }
+
+  TEST_METHOD(ModuleConstantsSnapshot_RejectsMalformedContent) {
+    auto snapshot = MakeSnapshot();
+    snapshot.Record("DeviceInfo", R"({"a":"\n"})");
+    auto content = snapshot.Serialize();
+
+    // Every truncation of the snapshot is rejected, apart from the one ending after the key.
+    auto headerSize = content.find("DeviceInfo");
+    for (size_t length = 0; length < content.size(); ++length) {
+      auto loaded = MakeSnapshot();
+      TestCheckEqual(length == headerSize, loaded.Load(std::string_view(content.data(), length)));
+      TestCheck(!loaded.TryGet("DeviceInfo"));
+    }
+
+    auto loaded = MakeSnapshot();
+    TestCheck(!loaded.Load(content + "x"));
+    TestCheck(!loaded.Load("RNWModuleConstants1\n1.0|42\nDeviceInfo\n-1\n{}\n"));
+    TestCheck(!loaded.Load("RNWModuleConstants1\n1.0|42\nDeviceInfo\n9999999999\n{}\n"));
+    TestCheck(!loaded.Load("RNWModuleConstants0\n1.0|42\n"));
+  }
+
+  TEST_METHOD(ModuleConstantsSnapshot_OnlyRecordsStableModules) {
+    auto snapshot = MakeSnapshot();
+    snapshot.Record("Other", "{}");
+    snapshot.Record("Line\nBreak", "{}");
+    TestCheck(!snapshot.IsDirty());
+    TestCheck(!snapshot.TryGet("Other"));
+
+    snapshot.Record("DeviceInfo", "{}");
+    TestCheck(snapshot.IsDirty());
+    uint64_t revision = 0;
+    snapshot.Serialize(&revision);
+    snapshot.MarkSaved(revision);
+
+    // Recording the same constants again does not make the snapshot worth saving.
+    snapshot.Record("DeviceInfo", "{}");
+    TestCheck(!snapshot.IsDirty());
+    snapshot.Record("DeviceInfo", R"({"a":1})");
+    TestCheck(snapshot.IsDirty());
+  }
+
+  TEST_METHOD(ModuleConstantsSnapshot_ConstantsRecordedWhileSavingStayDirty) {
+    auto snapshot = MakeSnapshot();
+    snapshot.Record("DeviceInfo", "{}");
+    uint64_t revision = 0;
+    snapshot.Serialize(&revision);
+
+    snapshot.Record("PlatformConstants", "{}");
+    snapshot.MarkSaved(revision);
+    TestCheck(snapshot.IsDirty());
+
+    snapshot.Serialize(&revision);
+    snapshot.MarkSaved(revision);
+    TestCheck(!snapshot.IsDirty());
+  }
+
+  TEST_METHOD(ModuleConstantsSnapshot_RecordsTimingsPerModule) {
+    auto snapshot = MakeSnapshot();
+    snapshot.RecordTiming("DeviceInfo", std::chrono::microseconds(50), false);
+    snapshot.RecordTiming("Other", std::chrono::microseconds(10), false);
+    snapshot.RecordTiming("DeviceInfo", std::chrono::microseconds(5), true);
+
+    auto timings = snapshot.Timings();
+    TestCheckEqual(2u, timings.size());
+    TestCheckEqual(std::string("DeviceInfo"), timings[0].ModuleName);
+    TestCheckEqual(5, static_cast<int>(timings[0].Duration.count()));
+    TestCheck(timings[0].FromSnapshot);
+    TestCheckEqual(std::string("Other"), timings[1].ModuleName);
+    TestCheck(!timings[1].FromSnapshot);
+  }
+};
+
+} // namespace Microsoft::ReactNative
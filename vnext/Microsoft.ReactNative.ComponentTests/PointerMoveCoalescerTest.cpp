@@ -0,0 +1,133 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Fabric/Composition/PointerMoveCoalescer.h>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (PointerMoveCoalescerTest) {
+  // An input event as the OS delivers it: a move of a pointer, or another event of it, such as a press.
+  struct InputEvent {
+    double time;
+    int32_t pointerId;
+    bool isMove;
+  };
+
+  struct DispatchedEvent {
+    int32_t pointerId;
+    bool isMove;
+    // The index of the input event dispatched.
+    int payload;
+  };
+
+  // Replays `events` as CompositionEventHandler dispatches them to JS: moves are queued and dispatched at the next
+  // frame, every `frameInterval` milliseconds, and other events dispatch the queued moves first.
+  static std::vector<DispatchedEvent>
+  Replay(PointerMoveCoalescer<int> &coalescer, const std::vector<InputEvent> &events, double frameInterval) {
+    std::vector<DispatchedEvent> dispatched;
+    auto flush = [&]() {
+      for (auto &move : coalescer.takeAll()) {
+        dispatched.push_back({move.pointerId, true, move.payload});
+      }
+    };
+
+    double nextFrame = frameInterval;
+    for (int index = 0; index < static_cast<int>(events.size()); ++index) {
+      const auto &event = events[index];
+      for (; nextFrame <= event.time; nextFrame += frameInterval) {
+        flush();
+      }
+      if (event.isMove) {
+        coalescer.add(event.pointerId, index);
+      } else {
+        flush();
+        dispatched.push_back({event.pointerId, false, index});
+      }
+    }
+    flush();
+    return dispatched;
+  }
+
+  // A mouse reporting at 1000 Hz for a second.
+  static std::vector<InputEvent> MakeMouseTrace() {
+    std::vector<InputEvent> events;
+    for (int sample = 0; sample < 1000; ++sample) {
+      events.push_back({sample + 0.5, 1, true});
+    }
+    return events;
+  }
+
+  TEST_METHOD(PointerMoveCoalescer_DispatchesLatestMovePerFrame) {
+    PointerMoveCoalescer<int> coalescer;
+    TestCheck(coalescer.add(1, 0));
+    TestCheck(!coalescer.add(2, 1));
+    TestCheck(!coalescer.add(1, 2));
+    TestCheck(!coalescer.empty());
+
+    // In the order the pointers started moving, each with its latest move.
+    auto moves = coalescer.takeAll();
+    TestCheckEqual(size_t{2}, moves.size());
+    TestCheckEqual(1, moves[0].pointerId);
+    TestCheckEqual(2, moves[0].payload);
+    TestCheckEqual(2, moves[1].pointerId);
+    TestCheckEqual(1, moves[1].payload);
+    TestCheck(coalescer.empty());
+    TestCheck(coalescer.takeAll().empty());
+
+    TestCheck(coalescer.add(1, 3));
+    coalescer.takeAll();
+    TestCheckEqual(uint64_t{4}, coalescer.stats().rawMoves);
+    TestCheckEqual(uint64_t{3}, coalescer.stats().dispatchedMoves);
+    TestCheckEqual(uint64_t{2}, coalescer.stats().frames);
+  }
+
+  TEST_METHOD(PointerMoveCoalescer_TimeToNextFrame) {
+    TestCheckEqual(int64_t{6}, TimeToNextFrame(110, 100, 16));
+    TestCheckEqual(int64_t{16}, TimeToNextFrame(116, 100, 16));
+    TestCheckEqual(int64_t{1}, TimeToNextFrame(131, 100, 16));
+    // A frame that is yet to start, as DWM can report.
+    TestCheckEqual(int64_t{4}, TimeToNextFrame(96, 100, 16));
+    TestCheckEqual(int64_t{0}, TimeToNextFrame(110, 100, 0));
+  }
+
+  TEST_METHOD(PointerMoveCoalescer_ReplayKeepsEventOrder) {
+    // Two pointers moving, one of them pressed between frames.
+    std::vector<InputEvent> events{
+        {1.0, 1, true},
+        {2.0, 2, true},
+        {3.0, 1, true},
+        {4.0, 1, false},
+        {5.0, 1, true},
+        {6.0, 2, true},
+        {20.0, 1, true},
+    };
+    PointerMoveCoalescer<int> coalescer;
+    auto dispatched = Replay(coalescer, events, 16.0);
+
+    std::vector<std::pair<bool, int>> expected{{true, 2}, {true, 1}, {false, 3}, {true, 4}, {true, 5}, {true, 6}};
+    TestCheckEqual(expected.size(), dispatched.size());
+    for (size_t index = 0; index < expected.size(); ++index) {
+      TestCheckEqual(expected[index].first, dispatched[index].isMove);
+      TestCheckEqual(expected[index].second, dispatched[index].payload);
+    }
+  }
+
+  // Replays a second of a 1000 Hz mouse with 60 Hz frames: a move is dispatched to JS per frame.
+  TEST_METHOD(PointerMoveCoalescer_ReplayDispatchesOneMovePerFrame) {
+    auto events = MakeMouseTrace();
+    PointerMoveCoalescer<int> coalescer;
+    auto dispatched = Replay(coalescer, events, 1000.0 / 60);
+
+    const auto &stats = coalescer.stats();
+    TestCheckEqual(uint64_t{1000}, stats.rawMoves);
+    TestCheckEqual(static_cast<uint64_t>(dispatched.size()), stats.dispatchedMoves);
+    TestCheck(stats.dispatchedMoves >= 60 && stats.dispatchedMoves <= 61);
+    TestCheckEqual(stats.dispatchedMoves, stats.frames);
+    // The last move of the trace is dispatched.
+    TestCheckEqual(999, dispatched.back().payload);
+  }
+};
+
+} // namespace Microsoft::ReactNative
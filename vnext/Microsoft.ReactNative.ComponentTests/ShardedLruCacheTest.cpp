@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Fabric/ShardedLruCache.h>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (ShardedLruCacheTest) {
+  using SingleShardCache = ShardedLruCache<int, int, std::hash<int>, std::equal_to<int>, 1>;
+
+  TEST_METHOD(ShardedLruCache_GetGeneratesMissingValuesOnce) {
+    ShardedLruCache<std::string, size_t> cache{64};
+    int generatedCount = 0;
+    auto generator = [&](std::string const &key) {
+      ++generatedCount;
+      return key.size();
+    };
+
+    TestCheckEqual(5u, cache.get("Hello", generator));
+    TestCheckEqual(5u, cache.get("Hello", generator));
+    TestCheckEqual(3u, cache.get("abc", generator));
+    TestCheckEqual(2, generatedCount);
+
+    auto stats = cache.stats();
+    TestCheckEqual(1u, stats.hits);
+    TestCheckEqual(2u, stats.misses);
+    TestCheckEqual(2u, stats.size);
+  }
+
+  TEST_METHOD(ShardedLruCache_EvictsLeastRecentlyUsed) {
+    SingleShardCache cache{2};
+    cache.put(1, 10);
+    cache.put(2, 20);
+    TestCheckEqual(10, *cache.find(1));
+    cache.put(3, 30);
+
+    TestCheck(!cache.find(2));
+    TestCheckEqual(10, *cache.find(1));
+    TestCheckEqual(30, *cache.find(3));
+    TestCheckEqual(1u, cache.stats().evictions);
+
+    cache.put(3, 31);
+    TestCheckEqual(31, *cache.find(3));
+    TestCheckEqual(2u, cache.stats().size);
+  }
+
+  TEST_METHOD(ShardedLruCache_CapacityChangesTrim) {
+    SingleShardCache cache{4};
+    for (int i = 0; i < 4; ++i) {
+      cache.put(i, i);
+    }
+    cache.capacity(1);
+    TestCheckEqual(1u, cache.stats().size);
+    TestCheckEqual(3, *cache.find(3));
+
+    cache.capacity(0);
+    cache.put(5, 5);
+    TestCheck(!cache.find(5));
+    TestCheckEqual(0u, cache.stats().size);
+  }
+
+  TEST_METHOD(ShardedLruCache_SharedAcrossThreads) {
+    ShardedLruCache<int, int> cache{256};
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread) {
+      threads.emplace_back([&cache]() {
+        for (int i = 0; i < 10000; ++i) {
+          auto key = i % 512;
+          TestCheckEqual(key * 2, cache.get(key, [](int k) { return k * 2; }));
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    auto stats = cache.stats();
+    TestCheckEqual(40000u, stats.hits + stats.misses);
+    TestCheck(stats.size <= 256u);
+  }
+
+  // Keys that are equal by their text only, as TextMeasureCacheKey compares attributed strings by what affects their
+  // layout.
+  struct LabelKey {
+    std::string Text;
+    std::shared_ptr<int> Owner;
+  };
+
+  struct LabelKeyHash {
+    size_t operator()(LabelKey const &key) const noexcept {
+      return std::hash<std::string>{}(key.Text);
+    }
+  };
+
+  struct LabelKeyEqual {
+    bool operator()(LabelKey const &lhs, LabelKey const &rhs) const noexcept {
+      return lhs.Text == rhs.Text;
+    }
+  };
+
+  TEST_METHOD(ShardedLruCache_FindsValuesStoredUnderEquivalentKey) {
+    ShardedLruCache<LabelKey, float, LabelKeyHash, LabelKeyEqual> cache{16};
+    auto owner = std::make_shared<int>(0);
+    TestCheck(!cache.find({"OK", owner}));
+
+    // As TextLayoutManager does, the stored key does not keep what the value does not depend on.
+    cache.put({"OK", nullptr}, 2.5f);
+    TestCheckEqual(2.5f, *cache.find({"OK", owner}));
+    TestCheckEqual(1, owner.use_count());
+  }
+};
+
+} // namespace Microsoft::ReactNative
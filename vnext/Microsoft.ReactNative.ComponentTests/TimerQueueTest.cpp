@@ -0,0 +1,136 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/TimerQueue.h>
+#include <chrono>
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (TimerQueueTest) {
+  static std::vector<uint32_t> PopExpiredIds(TimerQueue &queue, TDateTime now) {
+    std::vector<Timer> expiredTimers;
+    queue.PopExpired(now, expiredTimers);
+    std::vector<uint32_t> ids;
+    for (const auto &timer : expiredTimers) {
+      ids.push_back(timer.Id);
+    }
+    return ids;
+  }
+
+  TEST_METHOD(TimerQueue_IsEmpty) {
+    TimerQueue queue;
+    TestCheck(queue.IsEmpty());
+    TestCheck(queue.NextTargetTime() == TDateTime::max());
+
+    queue.Push(1, TDateTime::clock::now() + std::chrono::milliseconds(10), TTimeSpan::zero(), false);
+    TestCheck(!queue.IsEmpty());
+    TestCheckEqual(1u, queue.Size());
+  }
+
+  TEST_METHOD(TimerQueue_PopExpired_InTargetTimeOrder) {
+    TimerQueue queue;
+    auto now = TDateTime::clock::now();
+    queue.Push(1, now + std::chrono::milliseconds(30), TTimeSpan::zero(), false);
+    queue.Push(2, now + std::chrono::milliseconds(10), TTimeSpan::zero(), false);
+    queue.Push(3, now + std::chrono::seconds(100), TTimeSpan::zero(), false);
+    queue.Push(4, now + std::chrono::milliseconds(20), TTimeSpan::zero(), false);
+
+    TestCheck(PopExpiredIds(queue, now).empty());
+    TestCheckEqual((std::vector<uint32_t>{2, 4}), PopExpiredIds(queue, now + std::chrono::milliseconds(25)));
+    TestCheckEqual((std::vector<uint32_t>{1}), PopExpiredIds(queue, now + std::chrono::milliseconds(50)));
+    TestCheckEqual((std::vector<uint32_t>{3}), PopExpiredIds(queue, now + std::chrono::seconds(101)));
+    TestCheck(queue.IsEmpty());
+  }
+
+  TEST_METHOD(TimerQueue_PopExpired_AfterLongDelay) {
+    // Timers from the upper levels must be cascaded and returned in one batch.
+    TimerQueue queue;
+    auto now = TDateTime::clock::now();
+    queue.Push(1, now + std::chrono::hours(5), TTimeSpan::zero(), false);
+    queue.Push(2, now + std::chrono::minutes(3), TTimeSpan::zero(), false);
+    queue.Push(3, now + std::chrono::milliseconds(5), TTimeSpan::zero(), false);
+
+    TestCheckEqual((std::vector<uint32_t>{3, 2, 1}), PopExpiredIds(queue, now + std::chrono::hours(6)));
+    TestCheck(queue.IsEmpty());
+  }
+
+  TEST_METHOD(TimerQueue_Remove) {
+    TimerQueue queue;
+    auto now = TDateTime::clock::now();
+    queue.Push(1, now + std::chrono::milliseconds(10), TTimeSpan::zero(), false);
+    queue.Push(2, now + std::chrono::milliseconds(10), TTimeSpan::zero(), false);
+    queue.Push(3, now + std::chrono::milliseconds(10), TTimeSpan::zero(), false);
+    queue.Remove(2);
+    queue.Remove(42); // Removing unknown timer is ignored.
+
+    TestCheckEqual(2u, queue.Size());
+    TestCheckEqual((std::vector<uint32_t>{1, 3}), PopExpiredIds(queue, now + std::chrono::milliseconds(20)));
+  }
+
+  TEST_METHOD(TimerQueue_Push_ReplacesTimerWithSameId) {
+    TimerQueue queue;
+    auto now = TDateTime::clock::now();
+    queue.Push(1, now + std::chrono::milliseconds(10), TTimeSpan::zero(), false);
+    queue.Push(1, now + std::chrono::milliseconds(100), TTimeSpan::zero(), false);
+
+    TestCheckEqual(1u, queue.Size());
+    TestCheck(PopExpiredIds(queue, now + std::chrono::milliseconds(20)).empty());
+    TestCheckEqual((std::vector<uint32_t>{1}), PopExpiredIds(queue, now + std::chrono::milliseconds(200)));
+  }
+
+  TEST_METHOD(TimerQueue_Push_TargetTimeInPast) {
+    TimerQueue queue;
+    auto now = TDateTime::clock::now();
+    queue.Push(1, now + std::chrono::milliseconds(10), TTimeSpan::zero(), false);
+    TestCheck(PopExpiredIds(queue, now + std::chrono::milliseconds(5)).empty());
+
+    queue.Push(2, now - std::chrono::milliseconds(10), TTimeSpan::zero(), false);
+    TestCheck(queue.NextTargetTime() <= now + std::chrono::milliseconds(5));
+    TestCheckEqual((std::vector<uint32_t>{2, 1}), PopExpiredIds(queue, now + std::chrono::milliseconds(20)));
+  }
+
+  TEST_METHOD(TimerQueue_NextTargetTime) {
+    TimerQueue queue;
+    auto now = TDateTime::clock::now();
+    auto targetTime = now + std::chrono::seconds(10);
+    queue.Push(1, targetTime, TTimeSpan::zero(), false);
+
+    // The next target time is a lower bound of the time when the timer expires.
+    for (int i = 0; i < 10 && !queue.IsEmpty(); ++i) {
+      auto nextTargetTime = queue.NextTargetTime();
+      TestCheck(nextTargetTime <= targetTime + std::chrono::milliseconds(1));
+      PopExpiredIds(queue, std::max(nextTargetTime, now));
+    }
+
+    TestCheck(queue.IsEmpty());
+  }
+
+  // Drives 100k timers with 50% cancellation through the queue at 60 FPS ticks.
+  TEST_METHOD(TimerQueue_ManyTimersWithCancellation) {
+    constexpr uint32_t timerCount = 100000;
+    TimerQueue queue;
+    auto now = TDateTime::clock::now();
+
+    for (uint32_t id = 0; id < timerCount; ++id) {
+      queue.Push(id, now + std::chrono::milliseconds(1 + (id * 7919) % 30000), TTimeSpan::zero(), false);
+    }
+
+    for (uint32_t id = 0; id < timerCount; id += 2) {
+      queue.Remove(id);
+    }
+
+    size_t expiredCount = 0;
+    std::vector<Timer> expiredTimers;
+    for (int ms = 0; ms <= 30016; ms += 16) {
+      expiredTimers.clear();
+      queue.PopExpired(now + std::chrono::milliseconds(ms), expiredTimers);
+      expiredCount += expiredTimers.size();
+    }
+
+    TestCheckEqual(timerCount / 2, expiredCount);
+    TestCheck(queue.IsEmpty());
+  }
+};
+
+} // namespace Microsoft::ReactNative
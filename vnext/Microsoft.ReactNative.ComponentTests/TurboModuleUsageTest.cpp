@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <TurboModuleUsage.h>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+using winrt::Microsoft::ReactNative::JsThreadInitializers;
+using winrt::Microsoft::ReactNative::TurboModuleUsageLog;
+using winrt::Microsoft::ReactNative::TurboModuleWarmUp;
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (TurboModuleUsageTest) {
+  TEST_METHOD(TurboModuleUsage_CountsCreationsAndCalls) {
+    TurboModuleUsageLog log;
+    log.RecordCreation("UIManager", std::chrono::microseconds(120), false);
+    auto deviceInfoCalls = log.CallCounter("DeviceInfo");
+    log.RecordCreation("DeviceInfo", std::chrono::microseconds(30), true);
+    auto uiManagerCalls = log.CallCounter("UIManager");
+    deviceInfoCalls->fetch_add(2);
+    uiManagerCalls->fetch_add(5);
+
+    auto usage = log.Usage();
+    TestCheckEqual(2u, usage.size());
+    TestCheckEqual(std::string("UIManager"), usage[0].ModuleName);
+    TestCheckEqual(120, static_cast<int>(usage[0].CreationTime.count()));
+    TestCheck(!usage[0].WarmedUp);
+    TestCheckEqual(5u, usage[0].CallCount);
+    TestCheckEqual(std::string("DeviceInfo"), usage[1].ModuleName);
+    TestCheck(usage[1].WarmedUp);
+    TestCheckEqual(2u, usage[1].CallCount);
+  }
+
+  TEST_METHOD(TurboModuleUsage_WarmUpListKeepsCalledModulesInCreationOrder) {
+    TurboModuleUsageLog log;
+    for (auto name : {"UIManager", "Unused", "DeviceInfo", "AppState"}) {
+      log.RecordCreation(name, std::chrono::microseconds(10), false);
+      if (std::string(name) != "Unused") {
+        log.CallCounter(name)->fetch_add(1);
+      }
+    }
+
+    auto content = log.Serialize();
+    auto modules = TurboModuleUsageLog::WarmUpList(content, 8);
+    TestCheckEqual(3u, modules.size());
+    TestCheckEqual(std::string("UIManager"), modules[0]);
+    TestCheckEqual(std::string("DeviceInfo"), modules[1]);
+    TestCheckEqual(std::string("AppState"), modules[2]);
+
+    TestCheckEqual(2u, TurboModuleUsageLog::WarmUpList(content, 2).size());
+  }
+
+  TEST_METHOD(TurboModuleUsage_WarmUpListSkipsMalformedLines) {
+    TestCheck(TurboModuleUsageLog::WarmUpList("", 8).empty());
+    TestCheck(TurboModuleUsageLog::WarmUpList("RNWTurboModuleUsage0\nUIManager\t1\n", 8).empty());
+
+    auto modules = TurboModuleUsageLog::WarmUpList(
+        "RNWTurboModuleUsage1\nUIManager\t1\nNoCount\n\t3\nBadCount\tx\nEmptyCount\t\nUIManager\t2\nAppState\t4", 8);
+    TestCheckEqual(2u, modules.size());
+    TestCheckEqual(std::string("UIManager"), modules[0]);
+    TestCheckEqual(std::string("AppState"), modules[1]);
+  }
+
+  // Stands in for the modules of TurboModulesProvider: a module provider returns the name of the module it creates.
+  using TestWarmUp = TurboModuleWarmUp<std::function<std::string()>, std::string>;
+
+  static std::vector<std::pair<std::string, std::function<std::string()>>> MakeModules(
+      std::initializer_list<const char *> names) {
+    std::vector<std::pair<std::string, std::function<std::string()>>> modules;
+    for (auto name : names) {
+      modules.emplace_back(name, [name]() { return std::string(name); });
+    }
+    return modules;
+  }
+
+  TEST_METHOD(TurboModuleWarmUp_HandsOverModulesCreatedAhead) {
+    std::vector<std::string> created;
+    std::promise<void> allCreated;
+    {
+      TestWarmUp warmUp{
+          MakeModules({"UIManager", "DeviceInfo", "AppState"}),
+          [&](const std::string &moduleName, const std::function<std::string()> &moduleProvider) {
+            created.push_back(moduleProvider());
+            if (moduleName == "AppState") {
+              allCreated.set_value();
+            }
+            return moduleName;
+          }};
+      allCreated.get_future().wait();
+
+      TestCheckEqual(std::string("DeviceInfo"), *warmUp.Take("DeviceInfo"));
+      TestCheckEqual(std::string("UIManager"), *warmUp.Take("UIManager"));
+      // A module is only handed over once. JS creates the modules that were not queued.
+      TestCheck(!warmUp.Take("DeviceInfo"));
+      TestCheck(!warmUp.Take("Other"));
+    }
+
+    TestCheckEqual(3u, created.size());
+    TestCheckEqual(std::string("UIManager"), created[0]);
+    TestCheckEqual(std::string("DeviceInfo"), created[1]);
+    TestCheckEqual(std::string("AppState"), created[2]);
+  }
+
+  TEST_METHOD(TurboModuleWarmUp_TakeWaitsForCreatingAndDequeuesPending) {
+    std::vector<std::string> created;
+    std::promise<void> creating;
+    std::promise<void> finishCreating;
+    auto finishCreatingFuture = finishCreating.get_future();
+    {
+      TestWarmUp warmUp{
+          MakeModules({"UIManager", "DeviceInfo"}),
+          [&](const std::string &moduleName, const std::function<std::string()> &moduleProvider) {
+            if (moduleName == "UIManager") {
+              creating.set_value();
+              finishCreatingFuture.wait();
+            }
+            created.push_back(moduleProvider());
+            return moduleName;
+          }};
+      creating.get_future().wait();
+
+      // JS creates a queued module itself rather than wait for the modules queued before it.
+      TestCheck(!warmUp.Take("DeviceInfo"));
+      std::thread finisher{[&]() { finishCreating.set_value(); }};
+      // JS waits for the module being created.
+      TestCheckEqual(std::string("UIManager"), *warmUp.Take("UIManager"));
+      finisher.join();
+    }
+
+    TestCheckEqual(1u, created.size());
+    TestCheckEqual(std::string("UIManager"), created[0]);
+  }
+
+  TEST_METHOD(TurboModuleWarmUp_WithoutModulesHandsOverNothing) {
+    auto createModule = [](const std::string &, const std::function<std::string()> &moduleProvider) {
+      return moduleProvider();
+    };
+    TestWarmUp warmUp{MakeModules({}), createModule};
+    TestCheck(!warmUp.Take("UIManager"));
+  }
+
+  TEST_METHOD(JsThreadInitializers_RunWhenTheModuleIsHandedToJs) {
+    std::vector<int> ran;
+    auto run = [&ran](int initializer) { ran.push_back(initializer); };
+
+    JsThreadInitializers<int> deferred{/*defer*/ true};
+    deferred.Add(1, run);
+    deferred.Add(2, run);
+    TestCheck(ran.empty());
+    deferred.RunDeferred(run);
+    TestCheck((std::vector<int>{1, 2}) == ran);
+    deferred.Add(3, run);
+    TestCheck((std::vector<int>{1, 2, 3}) == ran);
+
+    ran.clear();
+    JsThreadInitializers<int> immediate{/*defer*/ false};
+    immediate.Add(4, run);
+    TestCheck((std::vector<int>{4}) == ran);
+  }
+};
+
+} // namespace Microsoft::ReactNative
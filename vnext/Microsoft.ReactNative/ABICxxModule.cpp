@@ -4,6 +4,9 @@
 #include "pch.h"
 #include "ABICxxModule.h"
 #include "DynamicWriter.h"
+#include "ModuleConstantsSnapshot.h"
+
+#include <folly/json.h>
 
 using namespace facebook::xplat::module;
 
@@ -26,14 +29,37 @@ std::string ABICxxModule::getName() noexcept {
 std::map<std::string, folly::dynamic> ABICxxModule::getConstants() noexcept {
   std::map<std::string, folly::dynamic> result;
 
-  IJSValueWriter argWriter = winrt::make<DynamicWriter>();
-  argWriter.WriteObjectBegin();
-  for (auto &constWriter : m_constantProviders) {
-    constWriter(argWriter);
+  auto &snapshot = GetModuleConstantsSnapshot();
+  auto start = std::chrono::steady_clock::now();
+  bool fromSnapshot = false;
+
+  folly::dynamic constants;
+  if (auto json = snapshot.IsStable(m_name) ? snapshot.TryGet(m_name) : std::nullopt) {
+    try {
+      constants = folly::parseJson(*json);
+      fromSnapshot = true;
+    } catch (const std::exception &) {
+      // Fall back to the constant providers, which also replaces the snapshot entry.
+    }
+  }
+
+  if (!fromSnapshot) {
+    IJSValueWriter argWriter = winrt::make<DynamicWriter>();
+    argWriter.WriteObjectBegin();
+    for (auto &constWriter : m_constantProviders) {
+      constWriter(argWriter);
+    }
+    argWriter.WriteObjectEnd();
+    constants = argWriter.as<DynamicWriter>()->TakeValue();
+
+    RecordModuleConstants(m_name, constants);
   }
-  argWriter.WriteObjectEnd();
 
-  folly::dynamic constants = argWriter.as<DynamicWriter>()->TakeValue();
+  snapshot.RecordTiming(
+      m_name,
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start),
+      fromSnapshot);
+
   if (constants.isObject()) {
     for (auto &item : constants.items()) {
       result[item.first.asString()] = std::move(item.second);
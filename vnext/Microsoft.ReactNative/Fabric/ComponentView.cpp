@@ -53,6 +53,7 @@ void ComponentView::MountChildComponentView(
     uint32_t index) noexcept {
   m_children.InsertAt(index, childComponentView);
   winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(childComponentView)->parent(*this);
+  invalidateHitTestBounds();
   if (m_builder && m_builder->MountChildComponentViewHandler()) {
     m_builder->MountChildComponentViewHandler()(
         *this, winrt::make<MountChildComponentViewArgs>(childComponentView, index));
@@ -93,6 +94,7 @@ void ComponentView::UnmountChildComponentView(
   }
   m_children.RemoveAt(index);
   winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(childComponentView)->parent(nullptr);
+  invalidateHitTestBounds();
   winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(childComponentView)->onUnmounted();
 }
 
@@ -204,6 +206,9 @@ void ComponentView::updateLayoutMetrics(
     m_builder->UpdateLayoutMetricsHandler()(*this, newMetrics, oldMetrics);
   }
 
+  if (layoutMetrics.frame != m_layoutMetrics.frame) {
+    invalidateHitTestBounds();
+  }
   m_layoutMetrics = layoutMetrics;
 
   m_layoutMetricsChangedEvent(*this, winrt::make<LayoutMetricsChangedArgs>(newMetrics, oldMetrics));
@@ -236,6 +241,23 @@ void ComponentView::FinalizeUpdates(winrt::Microsoft::ReactNative::ComponentView
 
 void ComponentView::prepareForRecycle() noexcept {}
 
+bool ComponentView::isRecyclable() const noexcept {
+  return false;
+}
+
+void ComponentView::recycle(facebook::react::Tag tag) noexcept {
+  assert(!m_mounted && !m_parent && m_children.Size() == 0);
+  m_tag = tag;
+}
+
+bool ComponentView::isObserved() const noexcept {
+  return m_userData || m_keyDownEvent || m_keyUpEvent || m_characterReceivedEvent || m_pointerPressedEvent ||
+      m_pointerReleasedEvent || m_pointerMovedEvent || m_pointerWheelChangedEvent || m_pointerEnteredEvent ||
+      m_pointerExitedEvent || m_pointerCaptureLostEvent || m_layoutMetricsChangedEvent || m_destroyingEvent ||
+      m_mountedEvent || m_unmountedEvent || m_losingFocusEvent || m_gettingFocusEvent || m_lostFocusEvent ||
+      m_gotFocusEvent;
+}
+
 facebook::react::Props::Shared ComponentView::props() noexcept {
   assert(false);
   return {};
@@ -641,6 +663,33 @@ facebook::react::Tag ComponentView::hitTest(
   return -1;
 }
 
+const ::Microsoft::ReactNative::HitTestBounds &ComponentView::hitTestBounds() const noexcept {
+  const auto &frame = m_layoutMetrics.frame;
+  return m_hitTestIndex.bounds(
+      ::Microsoft::ReactNative::HitTestBounds::fromFrame(
+          frame.origin.x, frame.origin.y, frame.size.width, frame.size.height),
+      hitTestClipsChildren(),
+      m_children.Size(),
+      [this](size_t index) {
+        return winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(
+                   m_children.GetAt(static_cast<uint32_t>(index)))
+            ->hitTestBounds();
+      });
+}
+
+bool ComponentView::hitTestClipsChildren() const noexcept {
+  return false;
+}
+
+void ComponentView::invalidateHitTestBounds() noexcept {
+  // Stops at the first view whose bounds are already out of date, as those of its ancestors are too.
+  for (auto view = this; view && view->m_hitTestIndex.invalidate();) {
+    view = view->m_parent
+        ? winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(view->m_parent)
+        : nullptr;
+  }
+}
+
 winrt::IInspectable ComponentView::EnsureUiaProvider() noexcept {
   return nullptr;
 }
@@ -12,6 +12,7 @@
 #include <react/renderer/core/LayoutMetrics.h>
 
 #include <ComponentView.Experimental.interop.h>
+#include <Fabric/Composition/HitTestIndex.h>
 #include <Fabric/Composition/ReactCompositionViewComponentBuilder.h>
 #include <Fabric/Composition/Theme.h>
 #include <uiautomationcore.h>
@@ -98,6 +99,10 @@ struct ComponentView
       facebook::react::LayoutMetrics const &layoutMetrics,
       facebook::react::LayoutMetrics const &oldLayoutMetrics) noexcept;
   virtual void prepareForRecycle() noexcept;
+  // Whether the view can be kept once it is deleted, to be reused for another component of the same type.
+  virtual bool isRecyclable() const noexcept;
+  // Reuses a deleted view, on which prepareForRecycle has been called, for the component with the given tag.
+  virtual void recycle(facebook::react::Tag tag) noexcept;
   virtual facebook::react::Props::Shared props() noexcept;
   virtual winrt::Microsoft::ReactNative::Composition::implementation::RootComponentView *rootComponentView()
       const noexcept;
@@ -206,6 +211,8 @@ struct ComponentView
   // If ignorePointerEvents = true, all Components are treated as valid targets
   virtual facebook::react::Tag
   hitTest(facebook::react::Point pt, facebook::react::Point &localPt, bool ignorePointerEvents = false) const noexcept;
+  // The area in which hitTest can hit the view or one of its descendants, in the coordinates of its parent.
+  const ::Microsoft::ReactNative::HitTestBounds &hitTestBounds() const noexcept;
   virtual winrt::IInspectable EnsureUiaProvider() noexcept;
   virtual std::optional<std::string> getAccessiblityValue() noexcept;
   virtual void setAcccessiblityValue(std::string &&value) noexcept;
@@ -253,9 +260,16 @@ struct ComponentView
       const winrt::Microsoft::ReactNative::Composition::Input::CharacterReceivedRoutedEventArgs &args) noexcept;
 
  protected:
+  // Whether anything outside of the view can observe it, through its events or user data.
+  bool isObserved() const noexcept;
+  // Whether hitTest only reaches the children of the view within its frame, as scroll views do.
+  virtual bool hitTestClipsChildren() const noexcept;
+  // Marks the hit test bounds of the view, and so those of its ancestors, as out of date.
+  void invalidateHitTestBounds() noexcept;
+
   winrt::com_ptr<winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder> m_builder;
   bool m_mounted : 1 {false};
-  const facebook::react::Tag m_tag;
+  facebook::react::Tag m_tag;
   winrt::IInspectable m_userData;
   mutable winrt::Microsoft::ReactNative::Composition::implementation::RootComponentView *m_rootView{nullptr};
   mutable winrt::Microsoft::ReactNative::Composition::implementation::Theme *m_theme{nullptr};
@@ -264,6 +278,7 @@ struct ComponentView
   facebook::react::LayoutMetrics m_layoutMetrics;
   winrt::Windows::Foundation::Collections::IVector<winrt::Microsoft::ReactNative::ComponentView> m_children{
       winrt::single_threaded_vector<winrt::Microsoft::ReactNative::ComponentView>()};
+  mutable ::Microsoft::ReactNative::HitTestIndex m_hitTestIndex;
 
   winrt::event<
       winrt::Windows::Foundation::EventHandler<winrt::Microsoft::ReactNative::Composition::Input::KeyRoutedEventArgs>>
@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+struct RecyclePoolStats {
+  // Views handed out from the pool.
+  uint64_t hits{0};
+  // Views that had to be created because the pool had none of the requested type.
+  uint64_t misses{0};
+  // Deleted views kept in the pool.
+  uint64_t recycled{0};
+  // Deleted views destroyed because the pool of their type was full.
+  uint64_t dropped{0};
+};
+
+// Returns the component view implementation of a pooled view.
+struct DereferenceComponentView {
+  template <typename TView>
+  auto operator()(TView const &view) const noexcept {
+    return &*view;
+  }
+};
+
+// Deleted component views kept for reuse, up to a capacity per component type, like the recycle pool of the iOS
+// RCTComponentViewRegistry. The most recently deleted view of a type is reused first, as it is the most likely to
+// still be in the processor caches.
+// dequeue and enqueue call the isRecyclable, recycle and onDestroying methods of the view implementation returned by
+// TGetView.
+template <typename TComponentHandle, typename TView, typename TGetView = DereferenceComponentView>
+class ComponentViewRecyclePool final {
+ public:
+  static constexpr size_t DefaultCapacity = 1024;
+
+  explicit ComponentViewRecyclePool(size_t capacity = DefaultCapacity) noexcept : m_capacity(capacity) {}
+
+  size_t capacity() const noexcept {
+    return m_capacity;
+  }
+
+  // Changes the number of views kept per component type. The least recently deleted views over the new capacity are
+  // released.
+  void capacity(size_t value) noexcept {
+    m_capacity = value;
+    for (auto &pool : m_pools) {
+      if (pool.second.size() > value) {
+        pool.second.erase(pool.second.begin(), pool.second.end() - static_cast<ptrdiff_t>(value));
+      }
+    }
+  }
+
+  // Returns the most recently deleted view of the component type, reused for the component with the given tag, or
+  // the view returned by create if there is none.
+  template <typename TTag, typename TCreate>
+  TView dequeue(TComponentHandle componentHandle, TTag tag, TCreate &&create) noexcept {
+    if (auto view = take(componentHandle)) {
+      TGetView{}(*view)->recycle(tag);
+      return std::move(*view);
+    }
+
+    return create();
+  }
+
+  // Keeps a deleted view, on which prepareForRecycle has been called, if it is recyclable and the pool of its
+  // component type is not full. Otherwise the view is destroyed.
+  void enqueue(TComponentHandle componentHandle, TView view) noexcept {
+    // Views kept in the pool have no Destroying handlers to notify.
+    auto viewImpl = TGetView{}(view);
+    if (viewImpl->isRecyclable() && put(componentHandle, view)) {
+      return;
+    }
+
+    viewImpl->onDestroying();
+  }
+
+  std::optional<TView> take(TComponentHandle componentHandle) noexcept {
+    auto pool = m_pools.find(componentHandle);
+    if (pool == m_pools.end() || pool->second.empty()) {
+      ++m_stats.misses;
+      return std::nullopt;
+    }
+
+    ++m_stats.hits;
+    std::optional<TView> view{std::move(pool->second.back())};
+    pool->second.pop_back();
+    return view;
+  }
+
+  // Returns false, leaving the view untouched, if the pool of the component type is full.
+  bool put(TComponentHandle componentHandle, TView &view) noexcept {
+    auto &pool = m_pools[componentHandle];
+    if (pool.size() >= m_capacity) {
+      ++m_stats.dropped;
+      return false;
+    }
+
+    ++m_stats.recycled;
+    pool.push_back(std::move(view));
+    return true;
+  }
+
+  size_t size(TComponentHandle componentHandle) const noexcept {
+    auto pool = m_pools.find(componentHandle);
+    return pool == m_pools.end() ? 0 : pool->second.size();
+  }
+
+  void clear() noexcept {
+    m_pools.clear();
+  }
+
+  RecyclePoolStats const &stats() const noexcept {
+    return m_stats;
+  }
+
+ private:
+  std::unordered_map<TComponentHandle, std::vector<TView>> m_pools;
+  size_t m_capacity;
+  RecyclePoolStats m_stats;
+};
+
+} // namespace Microsoft::ReactNative
@@ -5,6 +5,8 @@
 
 #include "ComponentViewRegistry.h"
 
+#include <CppRuntimeOptions.h>
+
 #pragma warning(push)
 #pragma warning(disable : 4305)
 #include <react/renderer/components/scrollview/ScrollViewShadowNode.h>
@@ -35,14 +37,31 @@ namespace Microsoft::ReactNative {
 
 void ComponentViewRegistry::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
   m_context = reactContext;
+
+  // A negative capacity disables recycling.
+  auto capacity = Microsoft::React::GetRuntimeOptionInt("Fabric.RecyclePoolCapacity");
+  if (capacity != 0) {
+    m_recyclePool.capacity(capacity > 0 ? static_cast<size_t>(capacity) : 0);
+  }
 }
 
 ComponentViewDescriptor const &ComponentViewRegistry::dequeueComponentViewWithComponentHandle(
     facebook::react::ComponentHandle componentHandle,
     facebook::react::Tag tag,
     const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext) noexcept {
-  // TODO implement recycled components like core does
+  auto view = isRecyclableComponent(componentHandle)
+      ? m_recyclePool.dequeue(
+            componentHandle, tag, [&]() { return createComponentView(componentHandle, tag, compContext); })
+      : createComponentView(componentHandle, tag, compContext);
 
+  auto it = m_registry.insert({tag, ComponentViewDescriptor{view}});
+  return it.first->second;
+}
+
+winrt::Microsoft::ReactNative::ComponentView ComponentViewRegistry::createComponentView(
+    facebook::react::ComponentHandle componentHandle,
+    facebook::react::Tag tag,
+    const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext) noexcept {
   winrt::Microsoft::ReactNative::ComponentView view{nullptr};
 
   if (componentHandle == facebook::react::ViewShadowNode::Handle()) {
@@ -89,8 +108,7 @@ ComponentViewDescriptor const &ComponentViewRegistry::dequeueComponentViewWithCo
                ->CreateView(m_context.Handle(), tag, compContext);
   }
 
-  auto it = m_registry.insert({tag, ComponentViewDescriptor{view}});
-  return it.first->second;
+  return view;
 }
 
 ComponentViewDescriptor const &ComponentViewRegistry::componentViewDescriptorWithTag(
@@ -115,12 +133,35 @@ void ComponentViewRegistry::enqueueComponentViewWithComponentHandle(
     ComponentViewDescriptor componentViewDescriptor) noexcept {
   assert(m_registry.find(tag) != m_registry.end());
 
-  winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(componentViewDescriptor.view)
-      ->prepareForRecycle();
+  auto componentView =
+      winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(componentViewDescriptor.view);
+  componentView->prepareForRecycle();
 
   m_registry.erase(tag);
 
-  winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(componentViewDescriptor.view)
-      ->onDestroying();
+  if (isRecyclableComponent(componentHandle)) {
+    m_recyclePool.enqueue(componentHandle, std::move(componentViewDescriptor.view));
+    return;
+  }
+
+  componentView->onDestroying();
+}
+
+winrt::Microsoft::ReactNative::implementation::ComponentView *ComponentViewRegistry::GetComponentView::operator()(
+    winrt::Microsoft::ReactNative::ComponentView const &view) const noexcept {
+  return winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(view);
+}
+
+RecyclePoolStats const &ComponentViewRegistry::recyclePoolStats() const noexcept {
+  return m_recyclePool.stats();
+}
+
+// The component types whose views are plain ViewComponentViews. The other views hold component specific state,
+// such as text layouts, image subscriptions or scroll positions, that is not reset between components yet.
+/*static*/ bool ComponentViewRegistry::isRecyclableComponent(
+    facebook::react::ComponentHandle componentHandle) noexcept {
+  return componentHandle == facebook::react::ViewShadowNode::Handle() ||
+      componentHandle == facebook::react::RawTextShadowNode::Handle() ||
+      componentHandle == facebook::react::TextShadowNode::Handle();
 }
 } // namespace Microsoft::ReactNative
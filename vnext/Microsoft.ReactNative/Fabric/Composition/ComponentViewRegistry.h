@@ -6,12 +6,13 @@
 
 #include <Fabric/IComponentViewRegistry.h>
 
+#include <Fabric/Composition/ComponentViewRecyclePool.h>
 #include <Fabric/Composition/CompositionHelpers.h>
 #include <winrt/Microsoft.ReactNative.h>
 
 namespace Microsoft::ReactNative {
 
-/* This could be expanded to have a pool of ComponentViewDescriptor's, like iOS does */
+/* Deleted views of the basic component types are kept in a recycle pool, like iOS does */
 class ComponentViewRegistry final : public IComponentViewRegistry {
  public:
   void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept override;
@@ -29,8 +30,26 @@ class ComponentViewRegistry final : public IComponentViewRegistry {
       facebook::react::Tag tag,
       ComponentViewDescriptor componentViewDescriptor) noexcept override;
 
+  RecyclePoolStats const &recyclePoolStats() const noexcept;
+
  private:
+  winrt::Microsoft::ReactNative::ComponentView createComponentView(
+      facebook::react::ComponentHandle componentHandle,
+      facebook::react::Tag tag,
+      const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext) noexcept;
+  static bool isRecyclableComponent(facebook::react::ComponentHandle componentHandle) noexcept;
+
+  struct GetComponentView {
+    winrt::Microsoft::ReactNative::implementation::ComponentView *operator()(
+        winrt::Microsoft::ReactNative::ComponentView const &view) const noexcept;
+  };
+
   std::unordered_map<facebook::react::Tag, ComponentViewDescriptor> m_registry;
+  ComponentViewRecyclePool<
+      facebook::react::ComponentHandle,
+      winrt::Microsoft::ReactNative::ComponentView,
+      GetComponentView>
+      m_recyclePool;
   winrt::Microsoft::ReactNative::ReactContext m_context;
 };
 
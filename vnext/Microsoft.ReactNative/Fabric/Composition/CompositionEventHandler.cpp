@@ -5,10 +5,12 @@
 
 #include "CompositionEventHandler.h"
 
+#include <CppRuntimeOptions.h>
 #include <Fabric/FabricUIManagerModule.h>
 #include <IReactContext.h>
 #include <React.h>
 #include <Views/DevMenu.h>
+#include <dwmapi.h>
 #include <windows.h>
 #include <windowsx.h>
 #include <winrt/Windows.UI.Core.h>
@@ -142,7 +144,9 @@ struct CompositionInputKeyboardSource : winrt::implements<
 CompositionEventHandler::CompositionEventHandler(
     const winrt::Microsoft::ReactNative::ReactContext &context,
     const winrt::Microsoft::ReactNative::ReactNativeIsland &reactNativeIsland)
-    : m_context(context), m_wkRootView(reactNativeIsland) {}
+    : m_context(context), m_wkRootView(reactNativeIsland) {
+  m_coalescePointerMoves = !Microsoft::React::GetRuntimeOptionBool("Fabric.DisablePointerMoveCoalescing");
+}
 
 void CompositionEventHandler::Initialize() noexcept {
 #ifdef USE_WINUI3
@@ -344,6 +348,10 @@ CompositionEventHandler::~CompositionEventHandler() {
   }
 #endif
 
+  if (m_pointerMoveTimer) {
+    m_pointerMoveTimer.Stop();
+  }
+
   if (m_hcursorOwned) {
     ::DestroyCursor(m_hcursor);
     m_hcursor = nullptr;
@@ -367,6 +375,8 @@ CompositionEventHandler::RootComponentView() const noexcept {
 void CompositionEventHandler::onPointerWheelChanged(
     const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
     winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept {
+  flushPointerMoves();
+
   if (std::shared_ptr<FabricUIManager> fabricuiManager =
           ::Microsoft::ReactNative::FabricUIManager::FromProperties(m_context.Properties())) {
     auto position = pointerPoint.Position();
@@ -538,6 +548,8 @@ int64_t CompositionEventHandler::SendMessage(HWND hwnd, uint32_t msg, uint64_t w
 
 void CompositionEventHandler::onKeyDown(
     const winrt::Microsoft::ReactNative::Composition::Input::KeyRoutedEventArgs &args) noexcept {
+  flushPointerMoves();
+
   if (auto focusedComponent = RootComponentView().GetFocusedComponent()) {
     winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(focusedComponent)->OnKeyDown(args);
 
@@ -571,6 +583,8 @@ void CompositionEventHandler::onKeyDown(
 
 void CompositionEventHandler::onKeyUp(
     const winrt::Microsoft::ReactNative::Composition::Input::KeyRoutedEventArgs &args) noexcept {
+  flushPointerMoves();
+
   if (auto focusedComponent = RootComponentView().GetFocusedComponent()) {
     winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(focusedComponent)->OnKeyUp(args);
 
@@ -581,6 +595,8 @@ void CompositionEventHandler::onKeyUp(
 
 void CompositionEventHandler::onCharacterReceived(
     const winrt::Microsoft::ReactNative::Composition::Input::CharacterReceivedRoutedEventArgs &args) noexcept {
+  flushPointerMoves();
+
   if (auto focusedComponent = RootComponentView().GetFocusedComponent()) {
     winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(focusedComponent)
         ->OnCharacterReceived(args);
@@ -1013,6 +1029,8 @@ void CompositionEventHandler::getTargetPointerArgs(
 void CompositionEventHandler::onPointerCaptureLost(
     const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
     winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept {
+  flushPointerMoves();
+
   if (SurfaceId() == -1)
     return;
 
@@ -1028,15 +1046,98 @@ void CompositionEventHandler::onPointerCaptureLost(
   }
 }
 
+// The time until the next vertical blank of the display, when the compositor starts a frame.
+static winrt::Windows::Foundation::TimeSpan TimeToNextVBlank() noexcept {
+  DWM_TIMING_INFO timingInfo{};
+  timingInfo.cbSize = sizeof(timingInfo);
+  LARGE_INTEGER frequency, now;
+  if (SUCCEEDED(DwmGetCompositionTimingInfo(nullptr, &timingInfo)) && QueryPerformanceFrequency(&frequency) &&
+      QueryPerformanceCounter(&now)) {
+    auto ticks = TimeToNextFrame(
+        now.QuadPart,
+        static_cast<int64_t>(timingInfo.qpcVBlank),
+        static_cast<int64_t>(timingInfo.qpcRefreshPeriod));
+    if (ticks > 0) {
+      return winrt::Windows::Foundation::TimeSpan{ticks * 10'000'000 / frequency.QuadPart};
+    }
+  }
+  return std::chrono::milliseconds(16);
+}
+
+const PointerMoveCoalescerStats &CompositionEventHandler::PointerMoveStats() const noexcept {
+  return m_pointerMoves.stats();
+}
+
 void CompositionEventHandler::onPointerMoved(
     const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
     winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept {
   if (SurfaceId() == -1)
     return;
 
-  int pointerId = pointerPoint.PointerId();
+  auto pointerId = static_cast<int32_t>(pointerPoint.PointerId());
+  bool firstPendingMove = m_pointerMoves.add(pointerId, PendingPointerMove{pointerPoint, keyModifiers});
 
-  auto position = pointerPoint.Position();
+  // Native views get every move, as views that draw with the pointer need all of its samples. Only the moves
+  // dispatched to JS are coalesced.
+  if (std::shared_ptr<FabricUIManager> fabricuiManager =
+          ::Microsoft::ReactNative::FabricUIManager::FromProperties(m_context.Properties())) {
+    facebook::react::Tag tag = -1;
+    facebook::react::Point ptLocal, ptScaled;
+    getTargetPointerArgs(fabricuiManager, pointerPoint, tag, ptScaled, ptLocal);
+
+    if (tag != -1) {
+      auto args =
+          winrt::make<winrt::Microsoft::ReactNative::Composition::Input::implementation::PointerRoutedEventArgs>(
+              m_context, tag, pointerPoint, keyModifiers);
+      auto targetComponentView = fabricuiManager->GetViewRegistry().componentViewDescriptorWithTag(tag).view;
+
+      winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(targetComponentView)
+          ->OnPointerMoved(args);
+    }
+  }
+
+  if (!m_coalescePointerMoves) {
+    flushPointerMoves();
+  } else if (firstPendingMove) {
+    schedulePointerMoveFlush();
+  }
+}
+
+void CompositionEventHandler::schedulePointerMoveFlush() noexcept {
+  if (!m_pointerMoveTimer) {
+    m_pointerMoveTimer = winrt::Microsoft::ReactNative::Timer::Create(m_context.Properties().Handle());
+    m_pointerMoveTimer.Tick([wkThis = weak_from_this()](auto &&...) {
+      if (auto strongThis = wkThis.lock()) {
+        strongThis->m_pointerMoveTimer.Stop();
+        strongThis->flushPointerMoves();
+      }
+    });
+  }
+
+  m_pointerMoveTimer.Interval(TimeToNextVBlank());
+  m_pointerMoveTimer.Start();
+}
+
+void CompositionEventHandler::flushPointerMoves() noexcept {
+  if (m_pointerMoves.empty())
+    return;
+
+  if (m_pointerMoveTimer) {
+    m_pointerMoveTimer.Stop();
+  }
+
+  for (auto &move : m_pointerMoves.takeAll()) {
+    dispatchPointerMoved(std::move(move));
+  }
+}
+
+void CompositionEventHandler::dispatchPointerMoved(PointerMoveCoalescer<PendingPointerMove>::Move &&move) noexcept {
+  if (SurfaceId() == -1)
+    return;
+
+  const auto &pointerPoint = move.payload.pointerPoint;
+  auto keyModifiers = move.payload.keyModifiers;
+  int pointerId = pointerPoint.PointerId();
 
   if (std::shared_ptr<FabricUIManager> fabricuiManager =
           ::Microsoft::ReactNative::FabricUIManager::FromProperties(m_context.Properties())) {
@@ -1047,13 +1148,6 @@ void CompositionEventHandler::onPointerMoved(
     if (tag == -1)
       return;
 
-    auto args = winrt::make<winrt::Microsoft::ReactNative::Composition::Input::implementation::PointerRoutedEventArgs>(
-        m_context, tag, pointerPoint, keyModifiers);
-    auto targetComponentView = fabricuiManager->GetViewRegistry().componentViewDescriptorWithTag(tag).view;
-
-    winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(targetComponentView)
-        ->OnPointerMoved(args);
-
     auto targetView = FindClosestFabricManagedTouchableView(
         fabricuiManager->GetViewRegistry().componentViewDescriptorWithTag(tag).view);
 
@@ -1092,6 +1186,8 @@ void CompositionEventHandler::onPointerMoved(
 void CompositionEventHandler::onPointerExited(
     const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
     winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept {
+  flushPointerMoves();
+
   if (SurfaceId() == -1)
     return;
 
@@ -1120,6 +1216,8 @@ void CompositionEventHandler::onPointerExited(
 void CompositionEventHandler::onPointerPressed(
     const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
     winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept {
+  flushPointerMoves();
+
   PointerId pointerId = pointerPoint.PointerId();
 
   auto staleTouch = std::find_if(m_activeTouches.begin(), m_activeTouches.end(), [pointerId](const auto &pair) {
@@ -1185,6 +1283,8 @@ void CompositionEventHandler::onPointerPressed(
 void CompositionEventHandler::onPointerReleased(
     const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
     winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept {
+  flushPointerMoves();
+
   int pointerId = pointerPoint.PointerId();
 
   auto activeTouch = std::find_if(m_activeTouches.begin(), m_activeTouches.end(), [pointerId](const auto &pair) {
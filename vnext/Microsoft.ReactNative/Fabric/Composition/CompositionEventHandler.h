@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <Fabric/Composition/PointerMoveCoalescer.h>
 #include <Fabric/Composition/RootComponentView.h>
 #include <Fabric/ReactTaggedView.h>
 #include <IReactInstance.h>
@@ -46,7 +47,15 @@ class CompositionEventHandler : public std::enable_shared_from_this<CompositionE
       facebook::react::Tag tag) noexcept;
   facebook::react::Tag PointerCapturingComponent() noexcept;
 
+  // The pointer moves received and dispatched to JS, which differ by the moves coalesced.
+  const PointerMoveCoalescerStats &PointerMoveStats() const noexcept;
+
  private:
+  struct PendingPointerMove {
+    winrt::Microsoft::ReactNative::Composition::Input::PointerPoint pointerPoint;
+    winrt::Windows::System::VirtualKeyModifiers keyModifiers;
+  };
+
   void onPointerPressed(
       const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
       winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept;
@@ -59,6 +68,10 @@ class CompositionEventHandler : public std::enable_shared_from_this<CompositionE
   void onPointerExited(
       const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
       winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept;
+  void dispatchPointerMoved(PointerMoveCoalescer<PendingPointerMove>::Move &&move) noexcept;
+  // Dispatches the pending pointer moves to JS, at the next frame or before any other pointer or key event.
+  void flushPointerMoves() noexcept;
+  void schedulePointerMoveFlush() noexcept;
   void onPointerWheelChanged(
       const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
       winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept;
@@ -155,6 +168,9 @@ class CompositionEventHandler : public std::enable_shared_from_this<CompositionE
   PointerId m_touchId = 0;
 
   std::map<PointerId, std::vector<ReactTaggedView>> m_currentlyHoveredViewsPerPointer;
+  PointerMoveCoalescer<PendingPointerMove> m_pointerMoves;
+  bool m_coalescePointerMoves{true};
+  winrt::Microsoft::ReactNative::ITimer m_pointerMoveTimer{nullptr};
   winrt::weak_ref<winrt::Microsoft::ReactNative::ReactNativeIsland> m_wkRootView;
   winrt::Microsoft::ReactNative::ReactContext m_context;
 
@@ -964,22 +964,25 @@ facebook::react::SharedViewEventEmitter ComponentView::eventEmitterAtPoint(faceb
   return m_eventEmitter;
 }
 
+bool ComponentView::canRecycle() const noexcept {
+  // A view that was handed to UI Automation, the tooltip service or custom component code could still be reached
+  // under its old tag.
+  return !m_parent && m_children.Size() == 0 && !m_builder && !m_uiaProvider && !m_tooltipTracked &&
+      !m_componentHostingFocusVisual && !m_themeChangedEvent && !isObserved();
+}
+
 bool ComponentView::anyHitTestHelper(
     facebook::react::Tag &targetTag,
     facebook::react::Point &ptContent,
     facebook::react::Point &localPt) const noexcept {
-  if (auto index = m_children.Size()) {
-    do {
-      index--;
-      targetTag = winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(m_children.GetAt(index))
-                      ->hitTest(ptContent, localPt);
-      if (targetTag != -1) {
-        return true;
-      }
-    } while (index != 0);
-  }
-
-  return false;
+  // Skips the children whose subtree cannot be hit at the point.
+  hitTestBounds();
+  return m_hitTestIndex.visitChildrenAt(ptContent.x, ptContent.y, [&](size_t index) {
+    targetTag = winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(
+                    m_children.GetAt(static_cast<uint32_t>(index)))
+                    ->hitTest(ptContent, localPt);
+    return targetTag != -1;
+  });
 }
 
 std::string ComponentView::DefaultControlType() const noexcept {
@@ -1287,6 +1290,18 @@ void ViewComponentView::updateLayoutMetrics(
 
 void ViewComponentView::prepareForRecycle() noexcept {}
 
+void ViewComponentView::recycle(facebook::react::Tag tag) noexcept {
+  // The emitter of the previous component must not receive the events of the new one. It is kept until then, as
+  // views that are destroyed rather than reused may still dispatch events while they are being torn down.
+  m_eventEmitter.reset();
+  ComponentView::recycle(tag);
+}
+
+bool ViewComponentView::isRecyclable() const noexcept {
+  // Views with custom visuals are left to their creator.
+  return !m_createInternalVisualHandler && canRecycle();
+}
+
 const facebook::react::SharedViewProps &ViewComponentView::viewProps() const noexcept {
   return m_props;
 }
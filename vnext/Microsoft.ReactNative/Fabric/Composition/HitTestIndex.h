@@ -0,0 +1,265 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// An axis-aligned rectangle that includes its edges, as ViewComponentView::hitTest tests frames. Empty by default.
+struct HitTestBounds {
+  float left{std::numeric_limits<float>::infinity()};
+  float top{std::numeric_limits<float>::infinity()};
+  float right{-std::numeric_limits<float>::infinity()};
+  float bottom{-std::numeric_limits<float>::infinity()};
+
+  static HitTestBounds fromFrame(float x, float y, float width, float height) noexcept {
+    return {x, y, x + width, y + height};
+  }
+
+  bool empty() const noexcept {
+    // Also true when a coordinate is NaN.
+    return !(left <= right && top <= bottom);
+  }
+
+  bool contains(float x, float y) const noexcept {
+    return x >= left && x <= right && y >= top && y <= bottom;
+  }
+
+  void unite(const HitTestBounds &other) noexcept {
+    if (!other.empty()) {
+      left = std::min(left, other.left);
+      top = std::min(top, other.top);
+      right = std::max(right, other.right);
+      bottom = std::max(bottom, other.bottom);
+    }
+  }
+
+  HitTestBounds offset(float dx, float dy) const noexcept {
+    return {left + dx, top + dy, right + dx, bottom + dy};
+  }
+};
+
+// Buckets the hit test bounds of the children of a view in a uniform grid, so that a hit test looks at the children in
+// the cell of the point rather than at all of them. The cells are about the average size of the children, so that a
+// child overlaps few of them.
+class ChildHitTestGrid final {
+ public:
+  // Views with fewer children look at all of them.
+  static constexpr size_t MinChildCount = 32;
+
+  // Indexes `childBounds`, or clears the grid when there are too few children, or when they overlap too much for a
+  // grid to help.
+  void build(const std::vector<HitTestBounds> &childBounds) noexcept {
+    clear();
+    if (childBounds.size() < MinChildCount || childBounds.size() > std::numeric_limits<uint32_t>::max()) {
+      return;
+    }
+
+    double averageWidth = 0;
+    double averageHeight = 0;
+    size_t count = 0;
+    for (const auto &bounds : childBounds) {
+      if (!bounds.empty()) {
+        m_bounds.unite(bounds);
+        averageWidth += static_cast<double>(bounds.right) - bounds.left;
+        averageHeight += static_cast<double>(bounds.bottom) - bounds.top;
+        ++count;
+      }
+    }
+
+    if (count == 0) {
+      // Nothing to hit.
+      m_columns = m_rows = 1;
+      m_cellStarts.assign(2, 0);
+      return;
+    }
+
+    double width = static_cast<double>(m_bounds.right) - m_bounds.left;
+    double height = static_cast<double>(m_bounds.bottom) - m_bounds.top;
+    if (!std::isfinite(width) || !std::isfinite(height)) {
+      return;
+    }
+    averageWidth /= count;
+    averageHeight /= count;
+
+    double columns = averageWidth > 0 ? std::clamp(width / averageWidth, 1.0, static_cast<double>(count)) : 1.0;
+    double rows = averageHeight > 0 ? std::clamp(height / averageHeight, 1.0, static_cast<double>(count)) : 1.0;
+    double maxCellCount = 4.0 * count;
+    if (columns * rows > maxCellCount) {
+      double scale = std::sqrt(maxCellCount / (columns * rows));
+      columns = std::max(1.0, columns * scale);
+      rows = std::max(1.0, rows * scale);
+    }
+    m_columns = static_cast<uint32_t>(columns);
+    m_rows = static_cast<uint32_t>(rows);
+    m_columnScale = width > 0 ? static_cast<float>(m_columns / width) : 0.0f;
+    m_rowScale = height > 0 ? static_cast<float>(m_rows / height) : 0.0f;
+
+    // Counts the children of each cell, then fills the cells from the last child to the first, the order of hit tests.
+    m_cellStarts.assign(static_cast<size_t>(m_columns) * m_rows + 1, 0);
+    size_t entryCount = 0;
+    for (const auto &bounds : childBounds) {
+      if (!bounds.empty()) {
+        forEachCell(bounds, [&](size_t cell) { ++m_cellStarts[cell + 1]; });
+        entryCount += cellCount(bounds);
+      }
+    }
+    if (entryCount > MaxEntriesPerChild * childBounds.size()) {
+      // Mostly children as large as the view, which every cell would list.
+      clear();
+      return;
+    }
+
+    for (size_t cell = 1; cell < m_cellStarts.size(); ++cell) {
+      m_cellStarts[cell] += m_cellStarts[cell - 1];
+    }
+    m_entries.resize(entryCount);
+    std::vector<uint32_t> next(m_cellStarts.begin(), m_cellStarts.end() - 1);
+    for (auto index = childBounds.size(); index-- > 0;) {
+      if (!childBounds[index].empty()) {
+        forEachCell(childBounds[index], [&](size_t cell) { m_entries[next[cell]++] = static_cast<uint32_t>(index); });
+      }
+    }
+  }
+
+  void clear() noexcept {
+    m_bounds = {};
+    m_columns = m_rows = 0;
+    m_cellStarts.clear();
+    m_entries.clear();
+  }
+
+  bool empty() const noexcept {
+    return m_cellStarts.empty();
+  }
+
+  // Calls `visit` with the index of each child whose bounds contain (x, y), from the last child to the first, until
+  // it returns true. Returns whether it did.
+  template <typename TVisit>
+  bool visit(const std::vector<HitTestBounds> &childBounds, float x, float y, TVisit &&visit) const {
+    if (!m_bounds.contains(x, y)) {
+      return false;
+    }
+
+    auto cell = static_cast<size_t>(row(y)) * m_columns + column(x);
+    for (auto entry = m_cellStarts[cell]; entry < m_cellStarts[cell + 1]; ++entry) {
+      auto index = m_entries[entry];
+      if (childBounds[index].contains(x, y) && visit(static_cast<size_t>(index))) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  static constexpr size_t MaxEntriesPerChild = 8;
+
+  static uint32_t cellOf(float offset, float scale, uint32_t count) noexcept {
+    auto cell = offset * scale;
+    // Also clamps NaN to the first cell.
+    return cell >= 1.0f ? std::min(static_cast<uint32_t>(cell), count - 1) : 0;
+  }
+
+  uint32_t column(float x) const noexcept {
+    return cellOf(x - m_bounds.left, m_columnScale, m_columns);
+  }
+
+  uint32_t row(float y) const noexcept {
+    return cellOf(y - m_bounds.top, m_rowScale, m_rows);
+  }
+
+  size_t cellCount(const HitTestBounds &bounds) const noexcept {
+    return (static_cast<size_t>(column(bounds.right)) - column(bounds.left) + 1) *
+        (static_cast<size_t>(row(bounds.bottom)) - row(bounds.top) + 1);
+  }
+
+  template <typename TCallback>
+  void forEachCell(const HitTestBounds &bounds, TCallback &&callback) const noexcept {
+    auto lastRow = row(bounds.bottom);
+    auto lastColumn = column(bounds.right);
+    for (auto r = row(bounds.top); r <= lastRow; ++r) {
+      for (auto c = column(bounds.left); c <= lastColumn; ++c) {
+        callback(static_cast<size_t>(r) * m_columns + c);
+      }
+    }
+  }
+
+  HitTestBounds m_bounds;
+  uint32_t m_columns{0};
+  uint32_t m_rows{0};
+  float m_columnScale{0};
+  float m_rowScale{0};
+  // The entries of cell i are m_entries[m_cellStarts[i]] to m_entries[m_cellStarts[i + 1] - 1].
+  std::vector<uint32_t> m_cellStarts;
+  std::vector<uint32_t> m_entries;
+};
+
+// The hit test bounds of a view: its frame united with the hit test bounds of its children, which hitTest can reach
+// outside of the frame. Together, the indexes of a tree of views form a bounding volume hierarchy, which lets a hit
+// test skip the subtrees that the point is outside of. The bounds are computed when first needed, and kept until the
+// view invalidates them, when its layout or children change, or those of one of its descendants.
+class HitTestIndex final {
+ public:
+  bool isValid() const noexcept {
+    return m_valid;
+  }
+
+  // Returns whether the bounds were valid, in which case those of the ancestors of the view need to be invalidated
+  // too. The bounds of the ancestors of a view with invalid bounds are always invalid.
+  bool invalidate() noexcept {
+    return std::exchange(m_valid, false);
+  }
+
+  // The bounds of the view with `frame`, in the coordinates of its parent, whose `childCount` children have the bounds
+  // `childBounds(index)`, in the coordinates of the view. The children are left out when `clipsChildren`, for views
+  // like scroll views that only hit test them within their frame.
+  template <typename TChildBounds>
+  const HitTestBounds &
+  bounds(const HitTestBounds &frame, bool clipsChildren, size_t childCount, TChildBounds &&childBounds) noexcept {
+    if (!m_valid) {
+      m_bounds = frame;
+      m_childBounds.resize(childCount);
+      for (size_t index = 0; index < childCount; ++index) {
+        m_childBounds[index] = childBounds(index);
+        if (!clipsChildren) {
+          m_bounds.unite(m_childBounds[index].offset(frame.left, frame.top));
+        }
+      }
+      m_grid.build(m_childBounds);
+      m_valid = true;
+    }
+    return m_bounds;
+  }
+
+  // Calls `visit` with the index of each child whose bounds contain (x, y), in the coordinates of the view, from the
+  // last child to the first, until it returns true. Returns whether it did. The bounds must be valid.
+  template <typename TVisit>
+  bool visitChildrenAt(float x, float y, TVisit &&visit) const {
+    if (!m_grid.empty()) {
+      return m_grid.visit(m_childBounds, x, y, visit);
+    }
+
+    for (auto index = m_childBounds.size(); index-- > 0;) {
+      if (m_childBounds[index].contains(x, y) && visit(index)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  bool m_valid{false};
+  HitTestBounds m_bounds;
+  std::vector<HitTestBounds> m_childBounds;
+  ChildHitTestGrid m_grid;
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+struct PointerMoveCoalescerStats {
+  // The moves received from the OS, each of them routed to the native views.
+  uint64_t rawMoves{0};
+  // The moves dispatched to JS: one per pointer and frame.
+  uint64_t dispatchedMoves{0};
+  // The frames in which moves were dispatched.
+  uint64_t frames{0};
+};
+
+// Keeps the latest move of each pointer until the next frame, so that a mouse or pen reporting at 1000 Hz dispatches
+// one move per frame to JS rather than one per sample. Any other event needs the pending moves dispatched first, so
+// that events keep their order.
+template <typename TPayload>
+class PointerMoveCoalescer final {
+ public:
+  struct Move {
+    int32_t pointerId;
+    // What the caller needs to dispatch the latest move.
+    TPayload payload;
+  };
+
+  // Queues a move of the pointer, replacing its pending move. Returns whether no move was pending, in which case the
+  // caller needs to take the moves at the next frame.
+  bool add(int32_t pointerId, TPayload payload) {
+    ++m_stats.rawMoves;
+    bool wasEmpty = m_pending.empty();
+
+    auto it = std::find_if(m_pending.begin(), m_pending.end(), [pointerId](const Move &move) {
+      return move.pointerId == pointerId;
+    });
+    if (it == m_pending.end()) {
+      m_pending.push_back(Move{pointerId, std::move(payload)});
+    } else {
+      it->payload = std::move(payload);
+    }
+    return wasEmpty;
+  }
+
+  // Removes the pending moves, in the order their pointers started moving since the last frame.
+  std::vector<Move> takeAll() noexcept {
+    if (!m_pending.empty()) {
+      m_stats.dispatchedMoves += m_pending.size();
+      ++m_stats.frames;
+    }
+    return std::exchange(m_pending, {});
+  }
+
+  bool empty() const noexcept {
+    return m_pending.empty();
+  }
+
+  const PointerMoveCoalescerStats &stats() const noexcept {
+    return m_stats;
+  }
+
+ private:
+  std::vector<Move> m_pending;
+  PointerMoveCoalescerStats m_stats;
+};
+
+// The time from `now` to the start of the next frame, for frames `frameInterval` apart from `lastFrame`, in the same
+// unit. A whole interval when `now` is the start of a frame.
+inline int64_t TimeToNextFrame(int64_t now, int64_t lastFrame, int64_t frameInterval) noexcept {
+  if (frameInterval <= 0) {
+    return 0;
+  }
+  if (now < lastFrame) {
+    return lastFrame - now;
+  }
+  return frameInterval - (now - lastFrame) % frameInterval;
+}
+
+} // namespace Microsoft::ReactNative
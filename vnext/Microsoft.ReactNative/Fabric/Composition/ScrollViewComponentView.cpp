@@ -1352,6 +1352,10 @@ facebook::react::Tag ScrollViewComponentView::hitTest(
   return -1;
 }
 
+bool ScrollViewComponentView::hitTestClipsChildren() const noexcept {
+  return true;
+}
+
 facebook::react::Point ScrollViewComponentView::getClientOffset() const noexcept {
   facebook::react::Point parentOffset{0};
   if (m_parent) {
@@ -123,6 +123,7 @@ struct ScrollInteractionTrackerOwner : public winrt::implements<
   void updateContentVisualSize() noexcept;
   bool scrollToEnd(bool animate) noexcept;
   bool scrollToStart(bool animate) noexcept;
+  bool hitTestClipsChildren() const noexcept override;
   bool scrollDown(float delta, bool animate) noexcept;
   bool scrollUp(float delta, bool animate) noexcept;
   bool scrollLeft(float delta, bool aniamte) noexcept;
@@ -14,11 +14,11 @@
 #include <IBlobPersistor.h>
 #include <Networking/NetworkPropertyIds.h>
 #include <ReactPropertyBag.h>
+#include <Utils/WinRTConversions.h>
 #include <d2d1_3.h>
 #include <shcore.h>
 #include <winrt/Microsoft.ReactNative.Composition.Experimental.h>
 #include <winrt/Microsoft.ReactNative.Composition.h>
-#include <winrt/Windows.Security.Cryptography.h>
 #include <winrt/Windows.Storage.Streams.h>
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
@@ -84,8 +84,11 @@ struct SvgDataImageHandler
       co_await winrt::resume_background();
 
       std::string_view base64String(path.c_str() + start + 1, path.length() - start - 1);
-      auto buffer = winrt::Windows::Security::Cryptography::CryptographicBuffer::DecodeFromBase64String(
-          winrt::to_hstring(base64String));
+      auto buffer = ::Microsoft::React::Utilities::DecodeBase64ToBuffer(base64String);
+      if (!buffer) {
+        co_return winrt::Microsoft::ReactNative::Composition::ImageFailedResponse(
+            L"Invalid base64 encoding in inline image data");
+      }
 
       winrt::Windows::Storage::Streams::InMemoryRandomAccessStream memoryStream;
       co_await memoryStream.WriteAsync(buffer);
@@ -172,18 +175,19 @@ struct DataImageHandler
       co_await winrt::resume_background();
 
       std::string_view base64String(path.c_str() + start + 1, path.length() - start - 1);
-      auto buffer = winrt::Windows::Security::Cryptography::CryptographicBuffer::DecodeFromBase64String(
-          winrt::to_hstring(base64String));
+      auto buffer = ::Microsoft::React::Utilities::DecodeBase64ToBuffer(base64String);
+      if (!buffer) {
+        co_return winrt::Microsoft::ReactNative::Composition::ImageFailedResponse(
+            L"Invalid base64 encoding in inline image data");
+      }
 
       winrt::Windows::Storage::Streams::InMemoryRandomAccessStream memoryStream;
       co_await memoryStream.WriteAsync(buffer);
       memoryStream.Seek(0);
 
       co_return winrt::Microsoft::ReactNative::Composition::StreamImageResponse(memoryStream);
-    } catch (winrt::hresult_error const &) {
-      // Base64 decode failed
-      co_return winrt::Microsoft::ReactNative::Composition::ImageFailedResponse(
-          L"Invalid base64 encoding in inline image data");
+    } catch (winrt::hresult_error const &ex) {
+      co_return winrt::Microsoft::ReactNative::Composition::ImageFailedResponse(ex.message());
     }
 
     winrt::throw_hresult(E_UNEXPECTED);
@@ -218,10 +222,10 @@ struct BlobImageHandler
         int64_t offset = _atoi64(winrt::to_string(queryParsed.GetFirstValueByName(L"offset")).c_str());
         int64_t size = _atoi64(winrt::to_string(queryParsed.GetFirstValueByName(L"size")).c_str());
 
-        auto arr = persistor->ResolveMessage(std::move(guid), offset, size);
+        auto content = persistor->ResolveMessage(std::move(guid), offset, size);
         winrt::Windows::Storage::Streams::InMemoryRandomAccessStream memoryStream;
         winrt::Windows::Storage::Streams::DataWriter dataWriter{memoryStream};
-        dataWriter.WriteBytes(arr);
+        dataWriter.WriteBytes(content.Data);
         co_await dataWriter.StoreAsync();
         memoryStream.Seek(0);
 
@@ -70,8 +70,26 @@ struct StreamImageResponse : StreamImageResponseT<StreamImageResponse, ImageResp
       : base_type(), m_stream(stream) {}
   virtual ImageResponseOrImageErrorInfo ResolveImage();
 
+  // Scales the image down while decoding it, so that it still covers `width` x `height` pixels.
+  void DecodeSize(uint32_t width, uint32_t height) noexcept {
+    m_decodeWidth = width;
+    m_decodeHeight = height;
+  }
+
+  // Identifies the content of the stream among the contents at its source, such as the ETag of a response or the
+  // modification time of a file. Empty when unknown.
+  const std::string &Validator() const noexcept {
+    return m_validator;
+  }
+  void Validator(std::string validator) noexcept {
+    m_validator = std::move(validator);
+  }
+
  private:
   const winrt::Windows::Storage::Streams::IRandomAccessStream m_stream;
+  std::string m_validator;
+  uint32_t m_decodeWidth{0};
+  uint32_t m_decodeHeight{0};
 };
 
 struct UriBrushFactoryImageResponse
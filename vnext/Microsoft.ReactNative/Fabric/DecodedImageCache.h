@@ -0,0 +1,245 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// Identifies a decoded image: the source it was decoded from and the size, in pixels, it was decoded to. A size of 0x0
+// stands for the full size of the image.
+struct DecodedImageKey {
+  std::string Uri;
+  uint32_t Width{0};
+  uint32_t Height{0};
+
+  bool operator==(const DecodedImageKey &other) const noexcept {
+    return Width == other.Width && Height == other.Height && Uri == other.Uri;
+  }
+};
+
+struct DecodedImageKeyHash {
+  size_t operator()(const DecodedImageKey &key) const noexcept {
+    auto hash = std::hash<std::string>{}(key.Uri);
+    hash ^= (static_cast<size_t>(key.Width) << 16 ^ key.Height) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+  }
+};
+
+// The size to decode an image of `width` x `height` pixels to, so that it still covers a target of `targetWidth` x
+// `targetHeight` pixels once scaled keeping its aspect ratio. Images are never scaled up: the full size is returned
+// when the image is not larger than the target, or when there is no target.
+inline std::pair<uint32_t, uint32_t>
+DecodedImageSize(uint32_t width, uint32_t height, uint32_t targetWidth, uint32_t targetHeight) noexcept {
+  if (width == 0 || height == 0 || targetWidth == 0 || targetHeight == 0 ||
+      (targetWidth >= width && targetHeight >= height)) {
+    return {width, height};
+  }
+
+  // The side that needs the larger scale is scaled to the target exactly, and the other one rounded up.
+  auto scaleRoundingUp = [](uint32_t size, uint32_t numerator, uint32_t denominator) {
+    return static_cast<uint32_t>(
+        (static_cast<uint64_t>(size) * numerator + denominator - 1) / static_cast<uint64_t>(denominator));
+  };
+  if (static_cast<uint64_t>(targetWidth) * height >= static_cast<uint64_t>(targetHeight) * width) {
+    if (targetWidth >= width) {
+      return {width, height};
+    }
+    return {targetWidth, scaleRoundingUp(height, targetWidth, width)};
+  }
+  if (targetHeight >= height) {
+    return {width, height};
+  }
+  return {scaleRoundingUp(width, targetHeight, height), targetHeight};
+}
+
+// The key of an image laid out at `width` x `height` points on a display of `scale` pixels per point. Unless
+// `downsampleToLayoutSize`, the image is decoded to its full size.
+inline DecodedImageKey
+MakeDecodedImageKey(std::string uri, float width, float height, float scale, bool downsampleToLayoutSize) noexcept {
+  DecodedImageKey key{std::move(uri)};
+  if (downsampleToLayoutSize) {
+    auto toPixels = [scale](float size) { return static_cast<uint32_t>(std::ceil(std::max(size * scale, 0.0f))); };
+    key.Width = toPixels(width);
+    key.Height = toPixels(height);
+  }
+  return key;
+}
+
+struct DecodedImageCacheStats {
+  // Requests served by an image decoded earlier from the same content.
+  uint64_t Hits{0};
+  // Requests that had to decode their image.
+  uint64_t Decodes{0};
+  // Requests that waited on another request for the same image, rather than loading and decoding it again.
+  uint64_t Joins{0};
+  // Least recently used images dropped to stay within the capacity, or to free memory.
+  uint64_t Evictions{0};
+  // Images and bytes currently in the cache.
+  size_t Count{0};
+  size_t Bytes{0};
+  // The most bytes the cache held at once.
+  size_t PeakBytes{0};
+};
+
+// A cache of decoded images that holds at most a number of bytes, dropping the least recently used images first, and
+// that lets requests for an image that is being loaded wait for it rather than loading it again.
+//
+// The content at a source may change, so every request that does not join another one loads its content again. The
+// cache only saves decoding it when a validator of the content, such as the ETag of a response or the modification
+// time of a file, matches the one of the cached image.
+//
+// TResult is what a request resolves to, such as an image or the error that prevented its decode. Results are copied
+// to every request, so they should be cheap, default constructible handles.
+template <typename TResult>
+class DecodedImageCache final {
+ public:
+  enum class Lookup {
+    // Another request is loading the image. The waiter is called with its result.
+    Joined,
+    // The caller must load the content of the image and pass it to Complete.
+    Started,
+  };
+
+  using Waiter = std::function<void(const TResult &result)>;
+
+  explicit DecodedImageCache(size_t capacityInBytes) noexcept : m_capacity(capacityInBytes) {}
+
+  size_t Capacity() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_capacity;
+  }
+
+  // Changes the number of bytes kept. The least recently used images over the new capacity are dropped.
+  void Capacity(size_t capacityInBytes) noexcept {
+    std::scoped_lock lock{m_mutex};
+    m_capacity = capacityInBytes;
+    TrimLocked(m_capacity);
+  }
+
+  Lookup Acquire(const DecodedImageKey &key, Waiter waiter) noexcept {
+    std::scoped_lock lock{m_mutex};
+    if (auto it = m_inFlight.find(key); it != m_inFlight.end()) {
+      it->second.push_back(std::move(waiter));
+      ++m_stats.Joins;
+      return Lookup::Joined;
+    }
+
+    m_inFlight.emplace(key, std::vector<Waiter>{});
+    return Lookup::Started;
+  }
+
+  // Completes a request that Acquire started once its content is loaded, returning its result and calling the requests
+  // that joined it. The image decoded earlier from content with the same `validator` is returned if it is cached.
+  // Otherwise `decode` is called, returning the result and its size in bytes, and the result is cached if it fits in
+  // the capacity. Content without a validator, and failed decodes, which have a size of 0, are not cached.
+  template <typename TDecode>
+  TResult Complete(const DecodedImageKey &key, const std::string &validator, TDecode &&decode) noexcept {
+    TResult result{};
+    bool isCached = false;
+    if (!validator.empty()) {
+      std::scoped_lock lock{m_mutex};
+      if (auto it = m_entries.find(key); it != m_entries.end() && it->second->Validator == validator) {
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+        result = it->second->Result;
+        isCached = true;
+        ++m_stats.Hits;
+      }
+    }
+
+    // Decoded outside of the lock, so that other requests are served meanwhile.
+    size_t sizeInBytes = 0;
+    if (!isCached) {
+      std::tie(result, sizeInBytes) = decode();
+    }
+
+    std::vector<Waiter> waiters;
+    {
+      std::scoped_lock lock{m_mutex};
+      if (auto it = m_inFlight.find(key); it != m_inFlight.end()) {
+        waiters = std::move(it->second);
+        m_inFlight.erase(it);
+      }
+
+      if (!isCached) {
+        ++m_stats.Decodes;
+        // An image decoded from other content at the same source is stale.
+        if (auto it = m_entries.find(key); it != m_entries.end()) {
+          m_stats.Bytes -= it->second->SizeInBytes;
+          m_lru.erase(it->second);
+          m_entries.erase(it);
+        }
+        if (!validator.empty() && sizeInBytes > 0 && sizeInBytes <= m_capacity) {
+          TrimLocked(m_capacity - sizeInBytes);
+          m_lru.push_front({key, validator, result, sizeInBytes});
+          m_entries.emplace(key, m_lru.begin());
+          m_stats.Bytes += sizeInBytes;
+          m_stats.PeakBytes = std::max(m_stats.PeakBytes, m_stats.Bytes);
+        }
+      }
+    }
+
+    for (auto &waiter : waiters) {
+      waiter(result);
+    }
+    return result;
+  }
+
+  // Drops the least recently used images until the cache holds at most `maxBytes` bytes, such as when the system runs
+  // low on memory. The capacity is unchanged.
+  void Trim(size_t maxBytes) noexcept {
+    std::scoped_lock lock{m_mutex};
+    TrimLocked(maxBytes);
+  }
+
+  void Clear() noexcept {
+    Trim(0);
+  }
+
+  DecodedImageCacheStats Stats() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    auto stats = m_stats;
+    stats.Count = m_entries.size();
+    return stats;
+  }
+
+ private:
+  struct Entry {
+    DecodedImageKey Key;
+    std::string Validator;
+    TResult Result;
+    size_t SizeInBytes;
+  };
+
+  void TrimLocked(size_t maxBytes) noexcept {
+    while (m_stats.Bytes > maxBytes && !m_lru.empty()) {
+      auto &entry = m_lru.back();
+      m_stats.Bytes -= entry.SizeInBytes;
+      m_entries.erase(entry.Key);
+      m_lru.pop_back();
+      ++m_stats.Evictions;
+    }
+  }
+
+  mutable std::mutex m_mutex;
+  size_t m_capacity;
+  // Most recently used first.
+  std::list<Entry> m_lru;
+  std::unordered_map<DecodedImageKey, typename std::list<Entry>::iterator, DecodedImageKeyHash> m_entries;
+  std::unordered_map<DecodedImageKey, std::vector<Waiter>, DecodedImageKeyHash> m_inFlight;
+  DecodedImageCacheStats m_stats;
+};
+
+} // namespace Microsoft::ReactNative
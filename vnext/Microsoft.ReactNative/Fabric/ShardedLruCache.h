@@ -0,0 +1,184 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace Microsoft::ReactNative {
+
+struct ShardedLruCacheStats {
+  // Lookups that found their value in the cache.
+  uint64_t hits{0};
+  // Lookups that had to generate their value.
+  uint64_t misses{0};
+  // Least recently used values dropped to stay within the capacity.
+  uint64_t evictions{0};
+  // Values currently in the cache.
+  size_t size{0};
+};
+
+// A size-bounded, least recently used cache that can be shared by several threads. Keys are spread over independently
+// locked shards by their hash, so that lookups from different layout threads rarely wait on each other. Each shard
+// holds an equal part of the capacity.
+template <
+    typename TKey,
+    typename TValue,
+    typename THash = std::hash<TKey>,
+    typename TKeyEqual = std::equal_to<TKey>,
+    size_t ShardCount = 16>
+class ShardedLruCache final {
+  static_assert(ShardCount > 0, "A cache needs at least one shard");
+
+ public:
+  explicit ShardedLruCache(size_t capacity) noexcept {
+    this->capacity(capacity);
+  }
+
+  size_t capacity() const noexcept {
+    return m_capacity;
+  }
+
+  // Changes the number of values kept. The least recently used values over the new capacity are dropped.
+  void capacity(size_t value) noexcept {
+    m_capacity = value;
+    m_shardCapacity = (value + ShardCount - 1) / ShardCount;
+    for (auto &shard : m_shards) {
+      std::scoped_lock lock{shard.mutex};
+      shard.trim(m_shardCapacity);
+    }
+  }
+
+  std::optional<TValue> find(TKey const &key) noexcept {
+    auto &shard = shardFor(key);
+    std::scoped_lock lock{shard.mutex};
+    if (auto value = shard.find(key)) {
+      ++shard.hits;
+      return *value;
+    }
+    ++shard.misses;
+    return std::nullopt;
+  }
+
+  void put(TKey const &key, TValue value) noexcept {
+    auto &shard = shardFor(key);
+    std::scoped_lock lock{shard.mutex};
+    shard.put(key, std::move(value), m_shardCapacity);
+  }
+
+  // Returns the cached value of `key`, or caches the value returned by `generator(key)`. The generator runs without
+  // holding the shard lock, so two threads missing on the same key at the same time may both generate it.
+  template <typename TGenerator>
+  TValue get(TKey const &key, TGenerator &&generator) {
+    if (auto value = find(key)) {
+      return std::move(*value);
+    }
+
+    TValue value = generator(key);
+    put(key, value);
+    return value;
+  }
+
+  void clear() noexcept {
+    for (auto &shard : m_shards) {
+      std::scoped_lock lock{shard.mutex};
+      shard.index.clear();
+      shard.entries.clear();
+    }
+  }
+
+  ShardedLruCacheStats stats() const noexcept {
+    ShardedLruCacheStats stats;
+    for (auto &shard : m_shards) {
+      std::scoped_lock lock{shard.mutex};
+      stats.hits += shard.hits;
+      stats.misses += shard.misses;
+      stats.evictions += shard.evictions;
+      stats.size += shard.entries.size();
+    }
+    return stats;
+  }
+
+ private:
+  // The index refers to the keys stored in the entries, which do not move, so that each key is only stored once.
+  using KeyReference = std::reference_wrapper<TKey const>;
+
+  struct KeyReferenceHash {
+    size_t operator()(KeyReference key) const noexcept {
+      return THash{}(key.get());
+    }
+  };
+
+  struct KeyReferenceEqual {
+    bool operator()(KeyReference lhs, KeyReference rhs) const noexcept {
+      return TKeyEqual{}(lhs.get(), rhs.get());
+    }
+  };
+
+  struct Shard {
+    // Most recently used first.
+    using Entries = std::list<std::pair<TKey const, TValue>>;
+
+    mutable std::mutex mutex;
+    Entries entries;
+    std::unordered_map<KeyReference, typename Entries::iterator, KeyReferenceHash, KeyReferenceEqual> index;
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t evictions{0};
+
+    TValue const *find(TKey const &key) noexcept {
+      auto it = index.find(std::cref(key));
+      if (it == index.end()) {
+        return nullptr;
+      }
+      entries.splice(entries.begin(), entries, it->second);
+      return &it->second->second;
+    }
+
+    void put(TKey const &key, TValue &&value, size_t capacity) noexcept {
+      if (capacity == 0) {
+        return;
+      }
+
+      auto it = index.find(std::cref(key));
+      if (it != index.end()) {
+        it->second->second = std::move(value);
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+      }
+
+      entries.emplace_front(key, std::move(value));
+      index.emplace(std::cref(entries.front().first), entries.begin());
+      trim(capacity);
+    }
+
+    void trim(size_t capacity) noexcept {
+      while (entries.size() > capacity) {
+        index.erase(std::cref(entries.back().first));
+        entries.pop_back();
+        ++evictions;
+      }
+    }
+  };
+
+  Shard &shardFor(TKey const &key) noexcept {
+    // The low bits of the hash pick the bucket within the shard's index, so use the high bits to pick the shard.
+    auto hash = static_cast<uint64_t>(THash{}(key));
+    return m_shards[((hash >> 32) ^ (hash >> 16)) % ShardCount];
+  }
+
+  std::array<Shard, ShardCount> m_shards;
+  std::atomic<size_t> m_capacity{0};
+  std::atomic<size_t> m_shardCapacity{0};
+};
+
+} // namespace Microsoft::ReactNative
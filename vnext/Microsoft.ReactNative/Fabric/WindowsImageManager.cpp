@@ -9,13 +9,18 @@
 #include <Fabric/Composition/CompositionContextHelper.h>
 #include <Fabric/Composition/ImageResponseImage.h>
 #include <Fabric/Composition/UriImageManager.h>
+#include <Fabric/DecodedImageCache.h>
+#include <Networking/CachingHttpFilter.h>
 #include <Networking/NetworkPropertyIds.h>
 #include <Utils/ImageUtils.h>
 #include <fmt/format.h>
 #include <functional/functor.h>
+#include <mutex>
+#include <optional>
 #include <shcore.h>
 #include <wincodec.h>
 #include <winrt/Microsoft.ReactNative.Composition.h>
+#include <winrt/Windows.Web.Http.Filters.h>
 #include <winrt/Windows.Web.Http.Headers.h>
 #include <winrt/Windows.Web.Http.h>
 
@@ -27,8 +32,125 @@ std::string FormatHResultError(winrt::hresult_error const &ex) {
   return fmt::format("[0x{:0>8x}] {}", static_cast<uint32_t>(ex.code()), winrt::to_string(ex.message()));
 }
 
+namespace {
+
+using ImageResponseOrImageErrorInfo =
+    winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseOrImageErrorInfo;
+
+size_t DecodedSizeInBytes(const ImageResponseOrImageErrorInfo &imageResultOrError) noexcept {
+  UINT width = 0, height = 0;
+  if (!imageResultOrError.image || !imageResultOrError.image->m_wicbmp ||
+      FAILED(imageResultOrError.image->m_wicbmp->GetSize(&width, &height))) {
+    return 0;
+  }
+  // Decoded images are 32bpp PBGRA.
+  return static_cast<size_t>(width) * height * 4;
+}
+
+void NotifyImageResponse(
+    const std::weak_ptr<const facebook::react::ImageResponseObserverCoordinator> &weakObserverCoordinator,
+    const ImageResponseOrImageErrorInfo &imageResultOrError) noexcept {
+  auto observerCoordinator = weakObserverCoordinator.lock();
+  if (!observerCoordinator) {
+    return;
+  }
+
+  if (imageResultOrError.image) {
+    observerCoordinator->nativeImageResponseComplete(
+        facebook::react::ImageResponse(imageResultOrError.image, nullptr /*metadata*/));
+  } else {
+    observerCoordinator->nativeImageResponseFailed(facebook::react::ImageLoadError(imageResultOrError.errorInfo));
+  }
+}
+
+} // namespace
+
+// The images decoded for an instance. Their total size, in bytes, is bounded by the "Image.DecodedCacheCapacity"
+// runtime option. A negative capacity keeps no images, but still lets requests for an image that is being loaded share
+// it. Half of the images are dropped when the system reports low memory, and before each image is added while memory
+// stays low.
+class DecodedImageStore final {
+ public:
+  DecodedImageStore() noexcept
+      : Images([]() -> size_t {
+          constexpr size_t cDefaultCapacity = 64 * 1024 * 1024;
+          auto capacity = Microsoft::React::GetRuntimeOptionInt("Image.DecodedCacheCapacity");
+          return capacity == 0 ? cDefaultCapacity : static_cast<size_t>(std::max(capacity, 0));
+        }()),
+        m_lowMemory(CreateMemoryResourceNotification(LowMemoryResourceNotification)),
+        m_highMemory(CreateMemoryResourceNotification(HighMemoryResourceNotification)) {
+    if (m_lowMemory && m_highMemory) {
+      m_memoryWait = CreateThreadpoolWait(OnMemoryNotification, this, nullptr);
+    }
+    if (m_memoryWait) {
+      SetThreadpoolWait(m_memoryWait, m_lowMemory, nullptr);
+    }
+  }
+
+  ~DecodedImageStore() noexcept {
+    if (m_memoryWait) {
+      {
+        std::scoped_lock lock{m_mutex};
+        m_closed = true;
+      }
+      SetThreadpoolWait(m_memoryWait, nullptr, nullptr);
+      WaitForThreadpoolWaitCallbacks(m_memoryWait, TRUE);
+      CloseThreadpoolWait(m_memoryWait);
+    }
+    if (m_lowMemory) {
+      CloseHandle(m_lowMemory);
+    }
+    if (m_highMemory) {
+      CloseHandle(m_highMemory);
+    }
+    Images.Clear();
+  }
+
+  DecodedImageStore(const DecodedImageStore &) = delete;
+  DecodedImageStore &operator=(const DecodedImageStore &) = delete;
+
+  void TrimIfLowOnMemory() noexcept {
+    BOOL isLow = FALSE;
+    if (m_lowMemory && QueryMemoryResourceNotification(m_lowMemory, &isLow) && isLow) {
+      Images.Trim(Images.Stats().Bytes / 2);
+    }
+  }
+
+  DecodedImageCache<ImageResponseOrImageErrorInfo> Images;
+
+ private:
+  // The low memory notification stays signaled while memory is low, so once it is handled the wait moves to the high
+  // memory notification, and back once memory is plentiful again.
+  static void CALLBACK OnMemoryNotification(
+      PTP_CALLBACK_INSTANCE /* instance */,
+      PVOID context,
+      PTP_WAIT wait,
+      TP_WAIT_RESULT /* waitResult */) noexcept {
+    auto store = static_cast<DecodedImageStore *>(context);
+    std::scoped_lock lock{store->m_mutex};
+    if (store->m_closed) {
+      return;
+    }
+    store->m_isLowOnMemory = !store->m_isLowOnMemory;
+    if (store->m_isLowOnMemory) {
+      store->Images.Trim(store->Images.Stats().Bytes / 2);
+    }
+    SetThreadpoolWait(wait, store->m_isLowOnMemory ? store->m_highMemory : store->m_lowMemory, nullptr);
+  }
+
+  const HANDLE m_lowMemory;
+  const HANDLE m_highMemory;
+  PTP_WAIT m_memoryWait{nullptr};
+  std::mutex m_mutex;
+  bool m_isLowOnMemory{false};
+  bool m_closed{false};
+};
+
 WindowsImageManager::WindowsImageManager(winrt::Microsoft::ReactNative::ReactContext reactContext)
-    : m_reactContext(reactContext) {
+    : m_httpClient(::Microsoft::React::Networking::MakeCachingHttpFilter(
+          winrt::Windows::Web::Http::Filters::HttpBaseProtocolFilter())),
+      m_reactContext(reactContext),
+      m_decodedImages(std::make_shared<DecodedImageStore>()) {
   m_uriImageManager =
       winrt::Microsoft::ReactNative::Composition::implementation::UriImageManager::Get(reactContext.Properties());
 
@@ -102,7 +224,11 @@ WindowsImageManager::GetImageRandomAccessStreamAsync(
       co_return winrt::Microsoft::ReactNative::Composition::ImageFailedResponse(L"Failed to get file.");
     }
 
-    co_return winrt::Microsoft::ReactNative::Composition::StreamImageResponse(co_await file.OpenReadAsync());
+    auto properties = co_await file.GetBasicPropertiesAsync();
+    winrt::Microsoft::ReactNative::Composition::StreamImageResponse fileResponse(co_await file.OpenReadAsync());
+    winrt::get_self<winrt::Microsoft::ReactNative::Composition::implementation::StreamImageResponse>(fileResponse)
+        ->Validator(fmt::format("{}:{}", properties.DateModified().time_since_epoch().count(), properties.Size()));
+    co_return fileResponse;
   }
 
   auto httpMethod{
@@ -163,7 +289,16 @@ WindowsImageManager::GetImageRandomAccessStreamAsync(
 
   memoryStream.Seek(0);
 
-  co_return winrt::Microsoft::ReactNative::Composition::StreamImageResponse(memoryStream.CloneStream());
+  winrt::Microsoft::ReactNative::Composition::StreamImageResponse streamResponse(memoryStream.CloneStream());
+  std::string validator;
+  if (auto eTag = response.Headers().TryLookup(L"ETag")) {
+    validator = winrt::to_string(*eTag);
+  } else if (auto lastModified = response.Content().Headers().LastModified()) {
+    validator = std::to_string(lastModified.Value().time_since_epoch().count());
+  }
+  winrt::get_self<winrt::Microsoft::ReactNative::Composition::implementation::StreamImageResponse>(streamResponse)
+      ->Validator(std::move(validator));
+  co_return streamResponse;
 }
 
 facebook::react::ImageRequest WindowsImageManager::requestImage(
@@ -180,6 +315,12 @@ facebook::react::ImageRequest WindowsImageManager::requestImage(
   winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::ReactNative::Composition::ImageResponse>
       imageResponseTask{nullptr};
 
+  // Images decoded from a file or a download are shared by the requests for the same source and size, and reused while
+  // their content is unchanged. Images of app providers are not, as the providers may not return the same image each
+  // time.
+  std::optional<DecodedImageKey> cacheKey;
+  std::weak_ptr<DecodedImageStore> weakDecodedImages;
+
   if (provider) {
     imageResponseTask = provider.GetImageResponseAsync(m_reactContext.Handle(), rnImageSource);
   } else {
@@ -190,6 +331,28 @@ facebook::react::ImageRequest WindowsImageManager::requestImage(
     source.sourceType = ImageSourceType::Download;
     source.body = imageSource.body;
 
+    // The body of a request may change its response.
+    if (source.body.empty()) {
+      // Decoding images to the size they are laid out at, in pixels, rather than to their full size saves memory and
+      // decode time, but changes how images shown with the center, repeat or none resize modes are drawn, hence the
+      // opt-in.
+      cacheKey = MakeDecodedImageKey(
+          imageSource.uri,
+          imageSource.size.width,
+          imageSource.size.height,
+          imageSource.scale,
+          Microsoft::React::GetRuntimeOptionBool("Image.DownsampleToLayoutSize"));
+      weakDecodedImages = m_decodedImages;
+
+      auto lookup = m_decodedImages->Images.Acquire(
+          *cacheKey, [weakObserverCoordinator](const ImageResponseOrImageErrorInfo &imageResultOrError) {
+            NotifyImageResponse(weakObserverCoordinator, imageResultOrError);
+          });
+      if (lookup == DecodedImageCache<ImageResponseOrImageErrorInfo>::Lookup::Joined) {
+        return imageRequest;
+      }
+    }
+
     auto progressCallback = [weakObserverCoordinator](int64_t loaded, int64_t total) {
       if (auto observerCoordinator = weakObserverCoordinator.lock()) {
         float progress = total > 0 ? static_cast<float>(loaded) / static_cast<float>(total) : 1.0f;
@@ -199,39 +362,52 @@ facebook::react::ImageRequest WindowsImageManager::requestImage(
     imageResponseTask = GetImageRandomAccessStreamAsync(source, progressCallback);
   }
 
-  imageResponseTask.Completed([weakObserverCoordinator](auto asyncOp, auto status) {
-    auto observerCoordinator = weakObserverCoordinator.lock();
-    if (!observerCoordinator) {
+  imageResponseTask.Completed([weakObserverCoordinator, cacheKey, weakDecodedImages](auto asyncOp, auto status) {
+    // Requests for the same image may be waiting on this one, even if its own observer is gone.
+    auto decodedImages = weakDecodedImages.lock();
+    if (!decodedImages && weakObserverCoordinator.expired()) {
       return;
     }
 
-    switch (status) {
-      case winrt::Windows::Foundation::AsyncStatus::Completed: {
-        auto imageResponse = asyncOp.GetResults();
-        auto selfImageResponse =
-            winrt::get_self<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponse>(imageResponse);
-        auto imageResultOrError = selfImageResponse->ResolveImage();
-        if (imageResultOrError.image) {
-          observerCoordinator->nativeImageResponseComplete(
-              facebook::react::ImageResponse(imageResultOrError.image, nullptr /*metadata*/));
-        } else {
-          observerCoordinator->nativeImageResponseFailed(facebook::react::ImageLoadError(imageResultOrError.errorInfo));
+    auto resolveImage = [&]() {
+      ImageResponseOrImageErrorInfo imageResultOrError;
+      switch (status) {
+        case winrt::Windows::Foundation::AsyncStatus::Completed: {
+          auto imageResponse = asyncOp.GetResults();
+          auto selfImageResponse =
+              winrt::get_self<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponse>(imageResponse);
+          imageResultOrError = selfImageResponse->ResolveImage();
+          break;
+        }
+        case winrt::Windows::Foundation::AsyncStatus::Canceled:
+        case winrt::Windows::Foundation::AsyncStatus::Error: {
+          imageResultOrError.errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
+          imageResultOrError.errorInfo->error = FormatHResultError(winrt::hresult_error(asyncOp.ErrorCode()));
+          break;
         }
-        break;
-      }
-      case winrt::Windows::Foundation::AsyncStatus::Canceled: {
-        auto errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
-        errorInfo->error = FormatHResultError(winrt::hresult_error(asyncOp.ErrorCode()));
-        observerCoordinator->nativeImageResponseFailed(facebook::react::ImageLoadError(errorInfo));
-        break;
       }
-      case winrt::Windows::Foundation::AsyncStatus::Error: {
-        auto errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
-        errorInfo->error = FormatHResultError(winrt::hresult_error(asyncOp.ErrorCode()));
-        observerCoordinator->nativeImageResponseFailed(facebook::react::ImageLoadError(errorInfo));
-        break;
+      return std::make_pair(imageResultOrError, DecodedSizeInBytes(imageResultOrError));
+    };
+
+    if (!decodedImages) {
+      NotifyImageResponse(weakObserverCoordinator, resolveImage().first);
+      return;
+    }
+
+    std::string validator;
+    if (status == winrt::Windows::Foundation::AsyncStatus::Completed) {
+      if (auto streamResponse =
+              asyncOp.GetResults().try_as<winrt::Microsoft::ReactNative::Composition::StreamImageResponse>()) {
+        auto selfStreamResponse =
+            winrt::get_self<winrt::Microsoft::ReactNative::Composition::implementation::StreamImageResponse>(
+                streamResponse);
+        selfStreamResponse->DecodeSize(cacheKey->Width, cacheKey->Height);
+        validator = selfStreamResponse->Validator();
       }
     }
+
+    decodedImages->TrimIfLowOnMemory();
+    NotifyImageResponse(weakObserverCoordinator, decodedImages->Images.Complete(*cacheKey, validator, resolveImage));
   });
   return imageRequest;
 }
@@ -261,6 +437,21 @@ ImageResponseOrImageErrorInfo StreamImageResponse::ResolveImage() {
     auto imagingFactory = std::get<winrt::com_ptr<IWICImagingFactory>>(result);
     auto decodedFrame = std::get<winrt::com_ptr<IWICBitmapSource>>(result);
 
+    if (m_decodeWidth > 0 && m_decodeHeight > 0) {
+      UINT width = 0, height = 0;
+      winrt::check_hresult(decodedFrame->GetSize(&width, &height));
+      auto [decodeWidth, decodeHeight] =
+          ::Microsoft::ReactNative::DecodedImageSize(width, height, m_decodeWidth, m_decodeHeight);
+      if (decodeWidth < width || decodeHeight < height) {
+        // Scale before converting the pixel format, so that only the pixels kept are converted.
+        winrt::com_ptr<IWICBitmapScaler> scaler;
+        winrt::check_hresult(imagingFactory->CreateBitmapScaler(scaler.put()));
+        winrt::check_hresult(
+            scaler->Initialize(decodedFrame.get(), decodeWidth, decodeHeight, WICBitmapInterpolationModeFant));
+        decodedFrame = scaler.as<IWICBitmapSource>();
+      }
+    }
+
     winrt::com_ptr<IWICFormatConverter> converter;
     winrt::check_hresult(imagingFactory->CreateFormatConverter(converter.put()));
 
@@ -14,6 +14,8 @@
 
 namespace Microsoft::ReactNative {
 
+class DecodedImageStore;
+
 struct WindowsImageManager {
   WindowsImageManager(winrt::Microsoft::ReactNative::ReactContext reactContext);
 
@@ -37,6 +39,8 @@ struct WindowsImageManager {
   winrt::Microsoft::ReactNative::ReactContext m_reactContext;
   winrt::hstring m_defaultUserAgent;
   std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::UriImageManager> m_uriImageManager;
+  // The images decoded for the instance, released with it. Requests still loading hold a weak reference.
+  std::shared_ptr<DecodedImageStore> m_decodedImages;
 };
 
 std::tuple<
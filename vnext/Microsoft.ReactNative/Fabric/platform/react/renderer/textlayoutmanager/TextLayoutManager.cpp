@@ -5,6 +5,7 @@
 
 #include "pch.h"
 
+#include <CppRuntimeOptions.h>
 #include <Fabric/DWriteHelpers.h>
 #include <Utils/TransformableText.h>
 #include <dwrite.h>
@@ -18,6 +19,34 @@ constexpr float cDefaultMaxFontSizeMultiplier = 0.0f;
 
 namespace facebook::react {
 
+// Measurements depend only on the attributed string, paragraph attributes and constraints, so surfaces of every
+// instance share one cache, and the same labels are measured once per process rather than once per TextLayoutManager.
+static Microsoft::ReactNative::ShardedLruCache<TextMeasureCacheKey, TextMeasurement> &SharedMeasureCache() noexcept {
+  static Microsoft::ReactNative::ShardedLruCache<TextMeasureCacheKey, TextMeasurement> cache{[]() -> size_t {
+    constexpr size_t cDefaultMeasureCacheCapacity = 4096;
+    // A negative capacity disables the cache.
+    auto capacity = Microsoft::React::GetRuntimeOptionInt("Fabric.TextMeasureCacheCapacity");
+    return capacity == 0 ? cDefaultMeasureCacheCapacity : static_cast<size_t>(std::max(capacity, 0));
+  }()};
+  return cache;
+}
+
+// Returns a copy of the attributed string with only what its measurement and cache key depend on. Cached keys outlive
+// the shadow nodes, whose props, state and event emitters would otherwise be kept alive by the parent shadow views of
+// the fragments.
+static AttributedString LayoutOnlyAttributedString(const AttributedString &attributedString) {
+  AttributedString result;
+  for (const auto &fragment : attributedString.getFragments()) {
+    AttributedString::Fragment layoutFragment;
+    layoutFragment.string = fragment.string;
+    layoutFragment.textAttributes = fragment.textAttributes;
+    layoutFragment.parentShadowView.tag = fragment.parentShadowView.tag;
+    layoutFragment.parentShadowView.layoutMetrics = fragment.parentShadowView.layoutMetrics;
+    result.appendFragment(std::move(layoutFragment));
+  }
+  return result;
+}
+
 // Creates an empty InlineObject since RN handles actually rendering the Inline object, this just reserves space for it.
 class AttachmentInlineObject : public winrt::implements<AttachmentInlineObject, IDWriteInlineObject> {
  public:
@@ -334,53 +363,56 @@ TextMeasurement TextLayoutManager::measure(
     const ParagraphAttributes &paragraphAttributes,
     const TextLayoutContext &layoutContext,
     LayoutConstraints layoutConstraints) const {
-  TextMeasurement measurement{};
   auto &attributedString = attributedStringBox.getValue();
+  if (auto cachedMeasurement = SharedMeasureCache().find({attributedString, paragraphAttributes, layoutConstraints})) {
+    return *cachedMeasurement;
+  }
+
+  TextMeasurement measurement{};
+  auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+  if (telemetry) {
+    telemetry->willMeasureText();
+  }
+
+  winrt::com_ptr<IDWriteTextLayout> spTextLayout;
 
-  measurement = m_measureCache.get(
-      {attributedString, paragraphAttributes, layoutConstraints}, [&](TextMeasureCacheKey const &key) {
-        auto telemetry = TransactionTelemetry::threadLocalTelemetry();
-        if (telemetry) {
-          telemetry->willMeasureText();
-        }
-
-        winrt::com_ptr<IDWriteTextLayout> spTextLayout;
-
-        TextMeasurement::Attachments attachments;
-        GetTextLayout(
-            attributedStringBox, paragraphAttributes, layoutConstraints.maximumSize, spTextLayout, attachments);
-
-        if (spTextLayout) {
-          auto maxHeight = std::numeric_limits<float>().max();
-          if (paragraphAttributes.maximumNumberOfLines > 0) {
-            std::vector<DWRITE_LINE_METRICS> lineMetrics;
-            uint32_t actualLineCount;
-            spTextLayout->GetLineMetrics(nullptr, 0, &actualLineCount);
-            lineMetrics.resize(static_cast<size_t>(actualLineCount));
-            winrt::check_hresult(spTextLayout->GetLineMetrics(lineMetrics.data(), actualLineCount, &actualLineCount));
-            maxHeight = 0;
-            const auto count =
-                std::min(static_cast<uint32_t>(paragraphAttributes.maximumNumberOfLines), actualLineCount);
-            for (uint32_t i = 0; i < count; ++i) {
-              maxHeight += lineMetrics[i].height;
-            }
-          }
-
-          DWRITE_TEXT_METRICS dtm{};
-          winrt::check_hresult(spTextLayout->GetMetrics(&dtm));
-          measurement.size = {dtm.width, std::min(dtm.height, maxHeight)};
-          measurement.attachments = attachments;
-        }
-
-        if (telemetry) {
-          telemetry->didMeasureText();
-        }
-
-        return measurement;
-      });
+  TextMeasurement::Attachments attachments;
+  GetTextLayout(attributedStringBox, paragraphAttributes, layoutConstraints.maximumSize, spTextLayout, attachments);
+
+  if (spTextLayout) {
+    auto maxHeight = std::numeric_limits<float>().max();
+    if (paragraphAttributes.maximumNumberOfLines > 0) {
+      std::vector<DWRITE_LINE_METRICS> lineMetrics;
+      uint32_t actualLineCount;
+      spTextLayout->GetLineMetrics(nullptr, 0, &actualLineCount);
+      lineMetrics.resize(static_cast<size_t>(actualLineCount));
+      winrt::check_hresult(spTextLayout->GetLineMetrics(lineMetrics.data(), actualLineCount, &actualLineCount));
+      maxHeight = 0;
+      const auto count = std::min(static_cast<uint32_t>(paragraphAttributes.maximumNumberOfLines), actualLineCount);
+      for (uint32_t i = 0; i < count; ++i) {
+        maxHeight += lineMetrics[i].height;
+      }
+    }
+
+    DWRITE_TEXT_METRICS dtm{};
+    winrt::check_hresult(spTextLayout->GetMetrics(&dtm));
+    measurement.size = {dtm.width, std::min(dtm.height, maxHeight)};
+    measurement.attachments = attachments;
+  }
+
+  if (telemetry) {
+    telemetry->didMeasureText();
+  }
+
+  SharedMeasureCache().put(
+      {LayoutOnlyAttributedString(attributedString), paragraphAttributes, layoutConstraints}, measurement);
   return measurement;
 }
 
+Microsoft::ReactNative::ShardedLruCacheStats TextLayoutManager::GetMeasureCacheStats() noexcept {
+  return SharedMeasureCache().stats();
+}
+
 /**
  * Measures an AttributedString on the platform, as identified by some
  * opaque cache ID.
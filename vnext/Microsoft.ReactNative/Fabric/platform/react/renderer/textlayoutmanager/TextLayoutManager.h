@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <Fabric/ShardedLruCache.h>
 #include <dwrite.h>
 #include <react/renderer/attributedstring/AttributedString.h>
 #include <react/renderer/attributedstring/AttributedStringBox.h>
@@ -98,6 +99,11 @@ class TextLayoutManager {
 
 #pragma endregion
 
+  /*
+   * Hit, miss and eviction counts of the text measurement cache shared by the TextLayoutManagers of all instances.
+   */
+  static Microsoft::ReactNative::ShardedLruCacheStats GetMeasureCacheStats() noexcept;
+
  private:
   static winrt::hstring GetTransformedText(const AttributedStringBox &attributedStringBox);
   static void GetTextLayout(
@@ -107,10 +113,6 @@ class TextLayoutManager {
       winrt::com_ptr<IDWriteTextLayout> &spTextLayout) noexcept;
 
   ContextContainer::Shared m_contextContainer;
-#pragma warning(push)
-#pragma warning(disable : 5028)
-  TextMeasureCache m_measureCache{};
-#pragma warning(pop)
 };
 
 } // namespace react
@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "JSValueJsiConverter.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+facebook::jsi::Value JsiValueFromJSValue(facebook::jsi::Runtime &runtime, JSValue const &value) noexcept {
+  switch (value.Type()) {
+    case JSValueType::Object: {
+      facebook::jsi::Object result{runtime};
+      for (auto const &property : value.AsObject()) {
+        result.setProperty(
+            runtime,
+            facebook::jsi::String::createFromUtf8(runtime, property.first),
+            JsiValueFromJSValue(runtime, property.second));
+      }
+
+      return result;
+    }
+    case JSValueType::Array: {
+      JSValueArray const &array = value.AsArray();
+      facebook::jsi::Array result{runtime, array.size()};
+      for (size_t i = 0; i < array.size(); ++i) {
+        result.setValueAtIndex(runtime, i, JsiValueFromJSValue(runtime, array[i]));
+      }
+
+      return result;
+    }
+    case JSValueType::String:
+      return facebook::jsi::String::createFromUtf8(runtime, *value.TryGetString());
+    case JSValueType::Boolean:
+      return facebook::jsi::Value{*value.TryGetBoolean()};
+    case JSValueType::Int64:
+      return facebook::jsi::Value{static_cast<double>(*value.TryGetInt64())};
+    case JSValueType::Double:
+      return facebook::jsi::Value{*value.TryGetDouble()};
+    default:
+      return facebook::jsi::Value::null();
+  }
+}
+
+} // namespace winrt::Microsoft::ReactNative
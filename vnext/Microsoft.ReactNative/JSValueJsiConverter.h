@@ -0,0 +1,18 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <JSValue.h>
+#include "jsi/jsi.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+// Direct conversion from JSValue to facebook::jsi::Value for the event emitters that run in the same binary.
+// The value tree is walked once without the IJSValueWriter ABI calls per token.
+// For folly::dynamic use jsi::valueFromDynamic.
+
+// Returns the same jsi::Value as JsiWriter::MoveResult after value.WriteTo(make<JsiWriter>(runtime)).
+facebook::jsi::Value JsiValueFromJSValue(facebook::jsi::Runtime &runtime, JSValue const &value) noexcept;
+
+} // namespace winrt::Microsoft::ReactNative
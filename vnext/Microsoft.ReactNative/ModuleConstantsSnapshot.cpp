@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ModuleConstantsSnapshot.h"
+
+#include <CppRuntimeOptions.h>
+#include <Utils/Helpers.h>
+#include <folly/json.h>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+
+namespace winrt::Microsoft::ReactNative {
+
+namespace {
+
+std::wstring SnapshotPath() noexcept {
+  return ::Microsoft::ReactNative::AppTempFilePath(L"rnw_module_constants", L".snapshot");
+}
+
+std::string SnapshotKey() noexcept {
+  std::ostringstream key;
+  key << ::Microsoft::React::GetRuntimeOptionString("ModuleConstants.SnapshotVersion");
+
+  wchar_t executablePath[MAX_PATH];
+  WIN32_FILE_ATTRIBUTE_DATA attributes{};
+  auto length = GetModuleFileNameW(nullptr, executablePath, static_cast<DWORD>(std::size(executablePath)));
+  if (length > 0 && length < std::size(executablePath) &&
+      GetFileAttributesExW(executablePath, GetFileExInfoStandard, &attributes)) {
+    key << '|' << attributes.ftLastWriteTime.dwHighDateTime << ':' << attributes.ftLastWriteTime.dwLowDateTime;
+  }
+  return key.str();
+}
+
+std::unordered_set<std::string> StableModules() noexcept {
+  std::unordered_set<std::string> modules;
+  std::istringstream names{::Microsoft::React::GetRuntimeOptionString("ModuleConstants.StableModules")};
+  std::string name;
+  while (std::getline(names, name, ',')) {
+    auto begin = name.find_first_not_of(' ');
+    if (begin != std::string::npos) {
+      modules.insert(name.substr(begin, name.find_last_not_of(' ') - begin + 1));
+    }
+  }
+  return modules;
+}
+
+} // namespace
+
+ModuleConstantsSnapshot &GetModuleConstantsSnapshot() noexcept {
+  static ModuleConstantsSnapshot *snapshot = []() noexcept {
+    auto stableModules = StableModules();
+    auto hasStableModules = !stableModules.empty();
+    auto result =
+        new ModuleConstantsSnapshot(hasStableModules ? SnapshotKey() : std::string(), std::move(stableModules));
+
+    if (hasStableModules) {
+      std::ifstream file(SnapshotPath(), std::ios::binary);
+      if (file) {
+        result->Load(std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+      }
+    }
+    return result;
+  }();
+  return *snapshot;
+}
+
+void RecordModuleConstants(const std::string &moduleName, const folly::dynamic &constants) noexcept {
+  auto &snapshot = GetModuleConstantsSnapshot();
+  if (!snapshot.IsStable(moduleName)) {
+    return;
+  }
+
+  std::string json;
+  try {
+    json = folly::toJson(constants);
+  } catch (const folly::json::print_error &) {
+    return;
+  }
+  snapshot.Record(moduleName, std::move(json));
+}
+
+void SaveModuleConstantsSnapshot() noexcept {
+  static std::mutex saveMutex;
+  std::scoped_lock lock{saveMutex};
+
+  auto &snapshot = GetModuleConstantsSnapshot();
+  auto path = SnapshotPath();
+  if (!snapshot.IsDirty() || path.empty()) {
+    return;
+  }
+
+  // Write to a temporary file first, so that a process ending while saving leaves the previous snapshot in place.
+  // Instances of the app running at the same time write their own temporary file.
+  uint64_t revision = 0;
+  auto content = snapshot.Serialize(&revision);
+  auto tempPath = path + L"." + std::to_wstring(GetCurrentProcessId()) + L".tmp";
+  std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+  file.write(content.data(), content.size());
+  file.close();
+
+  // The snapshot stays dirty unless it was saved, so that a later call tries again.
+  if (!file.fail() && MoveFileExW(tempPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+    snapshot.MarkSaved(revision);
+  } else {
+    DeleteFileW(tempPath.c_str());
+  }
+}
+
+} // namespace winrt::Microsoft::ReactNative
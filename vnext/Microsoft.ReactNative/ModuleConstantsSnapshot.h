@@ -0,0 +1,189 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace folly {
+struct dynamic;
+}
+
+namespace winrt::Microsoft::ReactNative {
+
+// How long it took to provide the constants of a module, to attribute startup time to modules.
+struct ModuleConstantsTiming {
+  std::string ModuleName;
+  std::chrono::microseconds Duration{0};
+  // The constants came from the snapshot rather than from the module's constant providers.
+  bool FromSnapshot{false};
+};
+
+// The constants of the modules an app declared stable, kept as JSON text from one run to the next, so that later runs
+// do not call their constant providers. The text of a module is only parsed when JS first asks for its constants.
+//
+// A snapshot is tied to a key: a snapshot saved with another key, such as by another version of the app, is ignored.
+//
+//   snapshot := "RNWModuleConstants1\n" key "\n" (name "\n" length "\n" json "\n")*
+class ModuleConstantsSnapshot final {
+ public:
+  ModuleConstantsSnapshot(std::string key, std::unordered_set<std::string> stableModules) noexcept
+      : m_key(std::move(key)), m_stableModules(std::move(stableModules)) {}
+
+  bool IsStable(const std::string &moduleName) const noexcept {
+    return m_stableModules.count(moduleName) != 0;
+  }
+
+  // Loads the constants saved by Serialize. Returns false, keeping the snapshot empty, if the content is malformed or
+  // was saved with another key.
+  bool Load(std::string_view content) noexcept {
+    auto readLine = [&content](std::string_view &line) {
+      auto end = content.find('\n');
+      if (end == std::string_view::npos) {
+        return false;
+      }
+      line = content.substr(0, end);
+      content.remove_prefix(end + 1);
+      return true;
+    };
+
+    std::string_view line;
+    if (!readLine(line) || line != Magic || !readLine(line) || line != m_key) {
+      return false;
+    }
+
+    std::unordered_map<std::string, std::string> constants;
+    std::string_view name;
+    while (readLine(name)) {
+      std::string_view length;
+      if (!readLine(length) || length.empty() || length.size() > 9 ||
+          length.find_first_not_of("0123456789") != std::string_view::npos) {
+        return false;
+      }
+      auto size = static_cast<size_t>(std::stoul(std::string(length)));
+      if (content.size() < size + 1 || content[size] != '\n') {
+        return false;
+      }
+      constants.emplace(name, content.substr(0, size));
+      content.remove_prefix(size + 1);
+    }
+    if (!content.empty()) {
+      return false;
+    }
+
+    std::scoped_lock lock{m_mutex};
+    m_constants = std::move(constants);
+    m_savedRevision = m_revision;
+    return true;
+  }
+
+  // Serializes the constants recorded or loaded so far. `revision`, if given, receives their revision, to pass to
+  // MarkSaved once the content is saved.
+  std::string Serialize(uint64_t *revision = nullptr) const noexcept {
+    std::scoped_lock lock{m_mutex};
+    std::string content;
+    content.append(Magic).append("\n").append(m_key).append("\n");
+    for (const auto &[name, json] : m_constants) {
+      content.append(name).append("\n").append(std::to_string(json.size())).append("\n").append(json).append("\n");
+    }
+    if (revision) {
+      *revision = m_revision;
+    }
+    return content;
+  }
+
+  // Marks the constants of a revision returned by Serialize saved. Constants recorded since keep the snapshot dirty.
+  void MarkSaved(uint64_t revision) noexcept {
+    std::scoped_lock lock{m_mutex};
+    m_savedRevision = std::max(m_savedRevision, revision);
+  }
+
+  // Returns the JSON text of the constants of a stable module, if the snapshot has them.
+  std::optional<std::string> TryGet(const std::string &moduleName) const noexcept {
+    std::scoped_lock lock{m_mutex};
+    auto it = m_constants.find(moduleName);
+    if (it == m_constants.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  // Records the constants a stable module provided, to be saved with the snapshot.
+  void Record(const std::string &moduleName, std::string constantsJson) noexcept {
+    if (!IsStable(moduleName) || moduleName.find('\n') != std::string::npos) {
+      return;
+    }
+
+    std::scoped_lock lock{m_mutex};
+    auto &json = m_constants[moduleName];
+    if (json != constantsJson) {
+      json = std::move(constantsJson);
+      ++m_revision;
+    }
+  }
+
+  // Whether constants were recorded since the snapshot was loaded or saved.
+  bool IsDirty() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_revision != m_savedRevision;
+  }
+
+  // Records the time taken to provide the constants of a module, replacing the time of a previous instance.
+  void RecordTiming(std::string moduleName, std::chrono::microseconds duration, bool fromSnapshot) noexcept {
+    std::scoped_lock lock{m_mutex};
+    for (auto &timing : m_timings) {
+      if (timing.ModuleName == moduleName) {
+        timing.Duration = duration;
+        timing.FromSnapshot = fromSnapshot;
+        return;
+      }
+    }
+    m_timings.push_back({std::move(moduleName), duration, fromSnapshot});
+  }
+
+  // The time taken to provide the constants of each module, in the order JS first asked for them.
+  std::vector<ModuleConstantsTiming> Timings() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_timings;
+  }
+
+ private:
+  static constexpr std::string_view Magic = "RNWModuleConstants1";
+
+  const std::string m_key;
+  const std::unordered_set<std::string> m_stableModules;
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, std::string> m_constants;
+  std::vector<ModuleConstantsTiming> m_timings;
+  // Counts the changes to the constants, to tell whether those saved are the latest.
+  uint64_t m_revision{0};
+  uint64_t m_savedRevision{0};
+};
+
+// The snapshot of the process. Apps opt in by declaring their stable modules through the
+// "ModuleConstants.StableModules" runtime option: a comma separated list of module names. Without it, the snapshot only
+// records timings. The snapshot is kept in the temp folder, in a file named after the app's executable, and keyed by
+// the "ModuleConstants.SnapshotVersion" runtime option and the time the executable was written, so that an updated app
+// does not read the constants of its previous version.
+ModuleConstantsSnapshot &GetModuleConstantsSnapshot() noexcept;
+
+// Records the constants a stable module provided in the process snapshot. Constants that JSON cannot represent, such as
+// NaN or infinite numbers, are not recorded, and the module keeps calling its constant providers.
+void RecordModuleConstants(const std::string &moduleName, const folly::dynamic &constants) noexcept;
+
+// Saves the process snapshot if stable modules provided constants that it did not have. It writes a file, so instances
+// call it off the JS thread once they loaded their bundle.
+void SaveModuleConstantsSnapshot() noexcept;
+
+} // namespace winrt::Microsoft::ReactNative
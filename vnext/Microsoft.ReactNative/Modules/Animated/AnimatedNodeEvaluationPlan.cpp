@@ -0,0 +1,181 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "AnimatedNodeEvaluationPlan.h"
+#include "InterpolationAnimatedNode.h"
+#include "PropsAnimatedNode.h"
+#include "ValueAnimatedNode.h"
+
+#include <algorithm>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+// States of the nodes in a pass.
+constexpr uint8_t s_idle = 0;
+constexpr uint8_t s_pending = 1;
+constexpr uint8_t s_queued = 2;
+} // namespace
+
+void AnimatedNodeEvaluationPlan::Invalidate() noexcept {
+  m_valid = false;
+}
+
+bool AnimatedNodeEvaluationPlan::IsValid() const noexcept {
+  return m_valid;
+}
+
+size_t AnimatedNodeEvaluationPlan::Size() const noexcept {
+  return m_nodes.size();
+}
+
+void AnimatedNodeEvaluationPlan::Build(std::vector<std::pair<AnimatedNode *, AnimatedNodeKind>> const &nodes) {
+  const auto count = static_cast<uint32_t>(nodes.size());
+
+  std::unordered_map<int64_t, uint32_t> indices{};
+  indices.reserve(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    indices.emplace(nodes[i].first->Tag(), i);
+  }
+
+  // Children that do not exist (yet) are skipped, as the manager does when updating nodes.
+  std::vector<std::vector<uint32_t>> children(count);
+  std::vector<uint32_t> incomingCounts(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    for (auto childTag : nodes[i].first->Children()) {
+      const auto child = indices.find(childTag);
+      if (child != indices.end()) {
+        children[i].push_back(child->second);
+        ++incomingCounts[child->second];
+      }
+    }
+  }
+
+  // Kahn's algorithm. Nodes without parents come first, every other node follows its last parent, one level
+  // below the deepest of its parents.
+  std::vector<uint32_t> order{};
+  std::vector<uint32_t> levels(count);
+  order.reserve(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    if (incomingCounts[i] == 0) {
+      order.push_back(i);
+    }
+  }
+  for (size_t next = 0; next < order.size(); ++next) {
+    for (auto child : children[order[next]]) {
+      levels[child] = std::max(levels[child], levels[order[next]] + 1);
+      if (--incomingCounts[child] == 0) {
+        order.push_back(child);
+      }
+    }
+  }
+
+  // Nodes left out of the order are part of a cycle in the animated node graph, and are never updated.
+  assert(order.size() == count);
+
+  std::stable_sort(order.begin(), order.end(), [&levels](uint32_t a, uint32_t b) { return levels[a] < levels[b]; });
+
+  std::vector<uint32_t> slots(count, UINT32_MAX);
+  for (uint32_t slot = 0; slot < order.size(); ++slot) {
+    slots[order[slot]] = slot;
+  }
+
+  m_nodes.clear();
+  m_kinds.clear();
+  m_childOffsets.clear();
+  m_childSlots.clear();
+  m_levelOffsets.clear();
+  m_slots.clear();
+  m_nodes.reserve(order.size());
+  m_kinds.reserve(order.size());
+  m_childOffsets.reserve(order.size() + 1);
+  m_slots.reserve(order.size());
+  for (auto index : order) {
+    while (m_levelOffsets.size() <= levels[index]) {
+      m_levelOffsets.push_back(static_cast<uint32_t>(m_nodes.size()));
+    }
+    m_slots.emplace(nodes[index].first->Tag(), static_cast<uint32_t>(m_nodes.size()));
+    m_nodes.push_back(nodes[index].first);
+    m_kinds.push_back(nodes[index].second);
+    m_childOffsets.push_back(static_cast<uint32_t>(m_childSlots.size()));
+    for (auto child : children[index]) {
+      if (slots[child] != UINT32_MAX) {
+        m_childSlots.push_back(slots[child]);
+      }
+    }
+  }
+  m_childOffsets.push_back(static_cast<uint32_t>(m_childSlots.size()));
+  m_levelOffsets.push_back(static_cast<uint32_t>(m_nodes.size()));
+
+  m_valid = true;
+}
+
+void AnimatedNodeEvaluationPlan::Run(std::unordered_set<int64_t> const &tags) {
+  const auto count = m_nodes.size();
+  m_pending.assign(count, s_idle);
+
+  auto first = count;
+  for (auto tag : tags) {
+    const auto slot = m_slots.find(tag);
+    if (slot != m_slots.end()) {
+      m_pending[slot->second] = s_pending;
+      first = std::min(first, static_cast<size_t>(slot->second));
+    }
+  }
+  if (first == count) {
+    return;
+  }
+
+  // Children always come in a later level than their parents, so a node is final once the pass reaches its level.
+  const auto levelCount = m_levelOffsets.size() - 1;
+  auto level = static_cast<size_t>(
+      std::upper_bound(m_levelOffsets.begin(), m_levelOffsets.end(), static_cast<uint32_t>(first)) -
+      m_levelOffsets.begin() - 1);
+  for (; level < levelCount; ++level) {
+    const auto begin = m_levelOffsets[level];
+    const auto end = m_levelOffsets[level + 1];
+
+    m_interpolations.Clear();
+    for (auto slot = begin; slot < end; ++slot) {
+      if (m_pending[slot] && m_kinds[slot] == AnimatedNodeKind::Interpolation &&
+          static_cast<InterpolationAnimatedNode *>(m_nodes[slot])->QueueInterpolation(m_interpolations)) {
+        m_pending[slot] = s_queued;
+      }
+    }
+    EvaluateInterpolations(m_interpolations);
+
+    size_t interpolation = 0;
+    for (auto slot = begin; slot < end; ++slot) {
+      if (!m_pending[slot]) {
+        continue;
+      }
+
+      const auto node = m_nodes[slot];
+      if (m_pending[slot] == s_queued) {
+        static_cast<InterpolationAnimatedNode *>(node)->CompleteInterpolation(m_interpolations, interpolation++);
+      } else {
+        node->Update();
+      }
+
+      switch (m_kinds[slot]) {
+        case AnimatedNodeKind::Props:
+          static_cast<PropsAnimatedNode *>(node)->UpdateView();
+          break;
+        case AnimatedNodeKind::Value:
+        case AnimatedNodeKind::Interpolation:
+          static_cast<ValueAnimatedNode *>(node)->OnValueUpdate();
+          break;
+        default:
+          break;
+      }
+
+      for (auto child = m_childOffsets[slot]; child < m_childOffsets[slot + 1]; ++child) {
+        m_pending[m_childSlots[child]] = s_pending;
+      }
+    }
+  }
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "AnimationKernels.h"
+
+namespace Microsoft::ReactNative {
+class AnimatedNode;
+
+enum class AnimatedNodeKind : uint8_t {
+  Value,
+  Interpolation,
+  Props,
+  Other,
+};
+
+/// <summary>
+/// The animated node graph flattened into topological order, with the children of each node resolved to plan
+/// slots. Updating the nodes reachable from a set of changed nodes is then a single linear pass over the plan
+/// instead of a graph traversal with tag lookups.
+///
+/// Nodes are grouped in levels, each level only depending on the ones before it, so that the interpolation nodes
+/// of a level are evaluated together in one batch.
+///
+/// The plan holds raw node pointers, so it has to be rebuilt whenever nodes are created, dropped, connected or
+/// disconnected.
+/// </summary>
+class AnimatedNodeEvaluationPlan {
+ public:
+  void Invalidate() noexcept;
+  bool IsValid() const noexcept;
+  size_t Size() const noexcept;
+
+  void Build(std::vector<std::pair<AnimatedNode *, AnimatedNodeKind>> const &nodes);
+
+  // Updates the nodes with the given tags and every node reachable from them, each after all of its parents.
+  void Run(std::unordered_set<int64_t> const &tags);
+
+ private:
+  std::vector<AnimatedNode *> m_nodes{};
+  std::vector<AnimatedNodeKind> m_kinds{};
+  // The children of the node in slot i are m_childSlots[m_childOffsets[i]] to m_childSlots[m_childOffsets[i + 1]].
+  std::vector<uint32_t> m_childOffsets{};
+  std::vector<uint32_t> m_childSlots{};
+  // The nodes of level i are in slots m_levelOffsets[i] to m_levelOffsets[i + 1].
+  std::vector<uint32_t> m_levelOffsets{};
+  std::vector<uint8_t> m_pending{};
+  InterpolationBatch m_interpolations{};
+  std::unordered_map<int64_t, uint32_t> m_slots{};
+  bool m_valid{false};
+};
+} // namespace Microsoft::ReactNative
@@ -101,6 +101,30 @@ void AnimationDriver::RunAnimationStep(winrt::TimeSpan renderingTime) {
     return;
   }
 
+  const auto [timeDeltaMs, restarting] = BeginAnimationStep(renderingTime);
+  EndAnimationStep(Update(timeDeltaMs, restarting));
+}
+
+bool AnimationDriver::QueueAnimationStep(winrt::TimeSpan renderingTime, AnimationBatch &batch) {
+  assert(!m_useComposition);
+  if (m_isComplete) {
+    return false;
+  }
+
+  const auto [timeDeltaMs, restarting] = BeginAnimationStep(renderingTime);
+  if (const auto isComplete = QueueUpdate(timeDeltaMs, restarting, batch)) {
+    EndAnimationStep(*isComplete);
+    return false;
+  }
+
+  return true;
+}
+
+void AnimationDriver::CompleteAnimationStep(AnimationBatch const &batch) {
+  EndAnimationStep(CompleteUpdate(batch));
+}
+
+std::tuple<double, bool> AnimationDriver::BeginAnimationStep(winrt::TimeSpan renderingTime) {
   // winrt::TimeSpan ticks are 100 nanoseconds, divide by 10000 to get milliseconds.
   const auto frameTimeMs = renderingTime.count() / 10000.0;
   auto restarting = false;
@@ -109,9 +133,10 @@ void AnimationDriver::RunAnimationStep(winrt::TimeSpan renderingTime) {
     restarting = true;
   }
 
-  const auto timeDeltaMs = frameTimeMs - m_startFrameTimeMs;
-  const auto isComplete = Update(timeDeltaMs, restarting);
+  return std::make_tuple(frameTimeMs - m_startFrameTimeMs, restarting);
+}
 
+void AnimationDriver::EndAnimationStep(bool isComplete) {
   if (isComplete) {
     if (m_iterations == -1 || ++m_iteration < m_iterations) {
       m_startFrameTimeMs = -1;
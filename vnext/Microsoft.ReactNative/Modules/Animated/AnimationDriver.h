@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include "AnimationKernels.h"
 #include "NativeAnimatedNodeManager.h"
 #include "ValueAnimatedNode.h"
 
@@ -64,7 +65,16 @@ class AnimationDriver : public std::enable_shared_from_this<AnimationDriver> {
 
   void RunAnimationStep(winrt::TimeSpan renderingTime);
 
+  // Same as RunAnimationStep, except that drivers that support it queue their sample into the batch instead of
+  // computing it. Returns true if the step was queued, in which case CompleteAnimationStep has to be called once the
+  // batch has been evaluated.
+  bool QueueAnimationStep(winrt::TimeSpan renderingTime, AnimationBatch &batch);
+  void CompleteAnimationStep(AnimationBatch const &batch);
+
  private:
+  std::tuple<double, bool> BeginAnimationStep(winrt::TimeSpan renderingTime);
+  void EndAnimationStep(bool isComplete);
+
   Callback m_endCallback{};
 #ifdef DEBUG
   int m_debug_callbackAttempts{0};
@@ -76,6 +86,14 @@ class AnimationDriver : public std::enable_shared_from_this<AnimationDriver> {
     return true;
   };
 
+  // Returns whether the animation is complete, or no value if the sample was queued into the batch.
+  virtual std::optional<bool> QueueUpdate(double timeDeltaMs, bool restarting, AnimationBatch & /*batch*/) {
+    return Update(timeDeltaMs, restarting);
+  }
+  virtual bool CompleteUpdate(AnimationBatch const & /*batch*/) {
+    return true;
+  }
+
   bool m_useComposition{};
   int64_t m_id{0};
   int64_t m_animatedValueTag{};
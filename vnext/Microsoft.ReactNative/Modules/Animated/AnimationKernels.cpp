@@ -0,0 +1,309 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "AnimationKernels.h"
+#include "AnimationUtils.h"
+
+#include <cmath>
+
+// SSE2 is part of every x64 processor and of the x86 baseline the project builds for. The transcendental functions
+// (exp, sin, cos) come from the short vector math library that ships with the MSVC runtime, which clang-cl does
+// not provide.
+#if ((defined(_M_IX86) && _M_IX86_FP >= 2) || defined(_M_X64)) && !defined(_M_CEE)
+#define ANIMATION_KERNELS_SSE2 1
+#include <emmintrin.h>
+#if !defined(__clang__)
+#define ANIMATION_KERNELS_SVML 1
+#include <immintrin.h>
+#endif
+#endif
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+void EvaluateSpringScalar(SpringBatch &batch, size_t i) noexcept {
+  const auto time = batch.Times[i];
+  const auto c = batch.Damping[i];
+  const auto m = batch.Mass[i];
+  const auto k = batch.Stiffness[i];
+  const auto v0 = -batch.InitialVelocities[i];
+  const auto toValue = batch.EndValues[i];
+
+  const auto zeta = c / (2 * std::sqrt(k * m));
+  const auto omega0 = std::sqrt(k / m);
+  const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
+  const auto x0 = toValue - batch.StartValues[i];
+
+  if (zeta < 1) {
+    const auto envelope = std::exp(-zeta * omega0 * time);
+    const auto sin = std::sin(omega1 * time);
+    const auto cos = std::cos(omega1 * time);
+    batch.Values[i] = toValue - envelope * ((v0 + zeta * omega0 * x0) / omega1 * sin + x0 * cos);
+    batch.Velocities[i] = zeta * omega0 * envelope * (sin * (v0 + zeta * omega0 * x0) / omega1 + x0 * cos) -
+        envelope * (cos * (v0 + zeta * omega0 * x0) - omega1 * x0 * sin);
+  } else {
+    const auto envelope = std::exp(-omega0 * time);
+    batch.Values[i] = toValue - envelope * (x0 + (v0 + omega0 * x0) * time);
+    batch.Velocities[i] = envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
+  }
+}
+
+void EvaluateDecayScalar(DecayBatch &batch, size_t i) noexcept {
+  const auto deceleration = batch.Decelerations[i];
+  batch.Values[i] = batch.StartValues[i] +
+      batch.Velocities[i] / (1 - deceleration) * (1 - std::exp(-(1 - deceleration) * (1000 * batch.Times[i])));
+}
+
+#ifdef ANIMATION_KERNELS_SSE2
+
+inline __m128d Select(__m128d mask, __m128d ifTrue, __m128d ifFalse) noexcept {
+  return _mm_or_pd(_mm_and_pd(mask, ifTrue), _mm_andnot_pd(mask, ifFalse));
+}
+
+inline __m128d ModeMask(ExtrapolationType const *modes, ExtrapolationType mode) noexcept {
+  return _mm_castsi128_pd(_mm_set_epi64x(modes[1] == mode ? -1 : 0, modes[0] == mode ? -1 : 0));
+}
+
+#endif // ANIMATION_KERNELS_SSE2
+
+} // namespace
+
+#pragma region Batches
+
+size_t InterpolationBatch::Add(
+    double value,
+    double inputMin,
+    double inputMax,
+    double outputMin,
+    double outputMax,
+    ExtrapolationType extrapolateLeft,
+    ExtrapolationType extrapolateRight) {
+  Values.push_back(value);
+  InputMin.push_back(inputMin);
+  InputMax.push_back(inputMax);
+  OutputMin.push_back(outputMin);
+  OutputMax.push_back(outputMax);
+  ExtrapolateLeft.push_back(extrapolateLeft);
+  ExtrapolateRight.push_back(extrapolateRight);
+  return Values.size() - 1;
+}
+
+size_t InterpolationBatch::Size() const noexcept {
+  return Values.size();
+}
+
+void InterpolationBatch::Clear() noexcept {
+  Values.clear();
+  InputMin.clear();
+  InputMax.clear();
+  OutputMin.clear();
+  OutputMax.clear();
+  ExtrapolateLeft.clear();
+  ExtrapolateRight.clear();
+  Results.clear();
+}
+
+size_t SpringBatch::Add(
+    double time,
+    double startValue,
+    double endValue,
+    double stiffness,
+    double damping,
+    double mass,
+    double initialVelocity) {
+  Times.push_back(time);
+  StartValues.push_back(startValue);
+  EndValues.push_back(endValue);
+  Stiffness.push_back(stiffness);
+  Damping.push_back(damping);
+  Mass.push_back(mass);
+  InitialVelocities.push_back(initialVelocity);
+  return Times.size() - 1;
+}
+
+size_t SpringBatch::Size() const noexcept {
+  return Times.size();
+}
+
+void SpringBatch::Clear() noexcept {
+  Times.clear();
+  StartValues.clear();
+  EndValues.clear();
+  Stiffness.clear();
+  Damping.clear();
+  Mass.clear();
+  InitialVelocities.clear();
+  Values.clear();
+  Velocities.clear();
+}
+
+size_t DecayBatch::Add(double time, double startValue, double velocity, double deceleration) {
+  Times.push_back(time);
+  StartValues.push_back(startValue);
+  Velocities.push_back(velocity);
+  Decelerations.push_back(deceleration);
+  return Times.size() - 1;
+}
+
+size_t DecayBatch::Size() const noexcept {
+  return Times.size();
+}
+
+void DecayBatch::Clear() noexcept {
+  Times.clear();
+  StartValues.clear();
+  Velocities.clear();
+  Decelerations.clear();
+  Values.clear();
+}
+
+void AnimationBatch::Clear() noexcept {
+  Springs.Clear();
+  Decays.Clear();
+}
+
+#pragma endregion Batches
+
+#pragma region Kernels
+
+void EvaluateInterpolations(InterpolationBatch &batch) noexcept {
+  const auto size = batch.Size();
+  batch.Results.resize(size);
+
+  size_t i = 0;
+#ifdef ANIMATION_KERNELS_SSE2
+  for (; i + 2 <= size; i += 2) {
+    const auto value = _mm_loadu_pd(&batch.Values[i]);
+    const auto inputMin = _mm_loadu_pd(&batch.InputMin[i]);
+    const auto inputMax = _mm_loadu_pd(&batch.InputMax[i]);
+    const auto outputMin = _mm_loadu_pd(&batch.OutputMin[i]);
+    const auto outputMax = _mm_loadu_pd(&batch.OutputMax[i]);
+    const auto left = &batch.ExtrapolateLeft[i];
+    const auto right = &batch.ExtrapolateRight[i];
+
+    // Extrapolate
+    const auto below = _mm_cmplt_pd(value, inputMin);
+    const auto identityLeft = _mm_and_pd(below, ModeMask(left, ExtrapolationType::Identity));
+    auto result = Select(_mm_and_pd(below, ModeMask(left, ExtrapolationType::Clamp)), inputMin, value);
+    const auto above = _mm_andnot_pd(identityLeft, _mm_cmpgt_pd(result, inputMax));
+    const auto identityRight = _mm_and_pd(above, ModeMask(right, ExtrapolationType::Identity));
+    result = Select(_mm_and_pd(above, ModeMask(right, ExtrapolationType::Clamp)), inputMax, result);
+
+    // Lanes with an empty input range divide by zero here and are replaced below.
+    const auto interpolated = _mm_add_pd(
+        outputMin,
+        _mm_div_pd(
+            _mm_mul_pd(_mm_sub_pd(outputMax, outputMin), _mm_sub_pd(result, inputMin)),
+            _mm_sub_pd(inputMax, inputMin)));
+    const auto emptyRange = Select(_mm_cmple_pd(value, inputMin), outputMin, outputMax);
+
+    auto output = Select(_mm_cmpeq_pd(inputMin, inputMax), emptyRange, interpolated);
+    output = Select(identityRight, result, output);
+    output = Select(identityLeft, value, output);
+    _mm_storeu_pd(&batch.Results[i], output);
+  }
+#endif // ANIMATION_KERNELS_SSE2
+
+  for (; i < size; ++i) {
+    batch.Results[i] = Interpolate(
+        batch.Values[i],
+        batch.InputMin[i],
+        batch.InputMax[i],
+        batch.OutputMin[i],
+        batch.OutputMax[i],
+        batch.ExtrapolateLeft[i],
+        batch.ExtrapolateRight[i]);
+  }
+}
+
+void EvaluateSprings(SpringBatch &batch) noexcept {
+  const auto size = batch.Size();
+  batch.Values.resize(size);
+  batch.Velocities.resize(size);
+
+  size_t i = 0;
+#ifdef ANIMATION_KERNELS_SVML
+  const auto one = _mm_set1_pd(1.0);
+  const auto two = _mm_set1_pd(2.0);
+  const auto zero = _mm_setzero_pd();
+  for (; i + 2 <= size; i += 2) {
+    const auto time = _mm_loadu_pd(&batch.Times[i]);
+    const auto c = _mm_loadu_pd(&batch.Damping[i]);
+    const auto m = _mm_loadu_pd(&batch.Mass[i]);
+    const auto k = _mm_loadu_pd(&batch.Stiffness[i]);
+    const auto v0 = _mm_sub_pd(zero, _mm_loadu_pd(&batch.InitialVelocities[i]));
+    const auto toValue = _mm_loadu_pd(&batch.EndValues[i]);
+
+    const auto zeta = _mm_div_pd(c, _mm_mul_pd(two, _mm_sqrt_pd(_mm_mul_pd(k, m))));
+    const auto omega0 = _mm_sqrt_pd(_mm_div_pd(k, m));
+    const auto x0 = _mm_sub_pd(toValue, _mm_loadu_pd(&batch.StartValues[i]));
+    const auto underdamped = _mm_cmplt_pd(zeta, one);
+
+    // Underdamped. Lanes with zeta >= 1 compute NaN here and are replaced below.
+    const auto omega1 = _mm_mul_pd(omega0, _mm_sqrt_pd(_mm_sub_pd(one, _mm_mul_pd(zeta, zeta))));
+    const auto zetaOmega0 = _mm_mul_pd(zeta, omega0);
+    const auto envelope = _mm_exp_pd(_mm_sub_pd(zero, _mm_mul_pd(zetaOmega0, time)));
+    const auto sin = _mm_sin_pd(_mm_mul_pd(omega1, time));
+    const auto cos = _mm_cos_pd(_mm_mul_pd(omega1, time));
+    const auto a = _mm_add_pd(v0, _mm_mul_pd(zetaOmega0, x0));
+    const auto underdampedValue = _mm_sub_pd(
+        toValue, _mm_mul_pd(envelope, _mm_add_pd(_mm_mul_pd(_mm_div_pd(a, omega1), sin), _mm_mul_pd(x0, cos))));
+    const auto underdampedVelocity = _mm_sub_pd(
+        _mm_mul_pd(
+            _mm_mul_pd(zetaOmega0, envelope),
+            _mm_add_pd(_mm_div_pd(_mm_mul_pd(sin, a), omega1), _mm_mul_pd(x0, cos))),
+        _mm_mul_pd(envelope, _mm_sub_pd(_mm_mul_pd(cos, a), _mm_mul_pd(_mm_mul_pd(omega1, x0), sin))));
+
+    // Critically damped and overdamped.
+    const auto criticalEnvelope = _mm_exp_pd(_mm_sub_pd(zero, _mm_mul_pd(omega0, time)));
+    const auto criticalValue = _mm_sub_pd(
+        toValue,
+        _mm_mul_pd(
+            criticalEnvelope, _mm_add_pd(x0, _mm_mul_pd(_mm_add_pd(v0, _mm_mul_pd(omega0, x0)), time))));
+    const auto criticalVelocity = _mm_mul_pd(
+        criticalEnvelope,
+        _mm_add_pd(
+            _mm_mul_pd(v0, _mm_sub_pd(_mm_mul_pd(time, omega0), one)),
+            _mm_mul_pd(_mm_mul_pd(time, x0), _mm_mul_pd(omega0, omega0))));
+
+    _mm_storeu_pd(&batch.Values[i], Select(underdamped, underdampedValue, criticalValue));
+    _mm_storeu_pd(&batch.Velocities[i], Select(underdamped, underdampedVelocity, criticalVelocity));
+  }
+#endif // ANIMATION_KERNELS_SVML
+
+  for (; i < size; ++i) {
+    EvaluateSpringScalar(batch, i);
+  }
+}
+
+void EvaluateDecays(DecayBatch &batch) noexcept {
+  const auto size = batch.Size();
+  batch.Values.resize(size);
+
+  size_t i = 0;
+#ifdef ANIMATION_KERNELS_SVML
+  const auto one = _mm_set1_pd(1.0);
+  const auto thousand = _mm_set1_pd(1000.0);
+  const auto zero = _mm_setzero_pd();
+  for (; i + 2 <= size; i += 2) {
+    const auto remaining = _mm_sub_pd(one, _mm_loadu_pd(&batch.Decelerations[i]));
+    const auto time = _mm_mul_pd(thousand, _mm_loadu_pd(&batch.Times[i]));
+    const auto decay = _mm_exp_pd(_mm_sub_pd(zero, _mm_mul_pd(remaining, time)));
+    const auto value = _mm_add_pd(
+        _mm_loadu_pd(&batch.StartValues[i]),
+        _mm_mul_pd(_mm_div_pd(_mm_loadu_pd(&batch.Velocities[i]), remaining), _mm_sub_pd(one, decay)));
+    _mm_storeu_pd(&batch.Values[i], value);
+  }
+#endif // ANIMATION_KERNELS_SVML
+
+  for (; i < size; ++i) {
+    EvaluateDecayScalar(batch, i);
+  }
+}
+
+#pragma endregion Kernels
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ExtrapolationType.h"
+
+namespace Microsoft::ReactNative {
+
+// Batches of animated values evaluated in one pass, stored as structures of arrays so that the kernels can process
+// several values per instruction. Callers append their inputs, run the kernel, and read their result back at the
+// index returned by Add.
+
+struct InterpolationBatch {
+  std::vector<double> Values;
+  std::vector<double> InputMin;
+  std::vector<double> InputMax;
+  std::vector<double> OutputMin;
+  std::vector<double> OutputMax;
+  std::vector<ExtrapolationType> ExtrapolateLeft;
+  std::vector<ExtrapolationType> ExtrapolateRight;
+
+  std::vector<double> Results;
+
+  size_t Add(
+      double value,
+      double inputMin,
+      double inputMax,
+      double outputMin,
+      double outputMax,
+      ExtrapolationType extrapolateLeft,
+      ExtrapolationType extrapolateRight);
+  size_t Size() const noexcept;
+  void Clear() noexcept;
+};
+
+struct SpringBatch {
+  std::vector<double> Times;
+  std::vector<double> StartValues;
+  std::vector<double> EndValues;
+  std::vector<double> Stiffness;
+  std::vector<double> Damping;
+  std::vector<double> Mass;
+  std::vector<double> InitialVelocities;
+
+  std::vector<double> Values;
+  std::vector<double> Velocities;
+
+  size_t Add(
+      double time,
+      double startValue,
+      double endValue,
+      double stiffness,
+      double damping,
+      double mass,
+      double initialVelocity);
+  size_t Size() const noexcept;
+  void Clear() noexcept;
+};
+
+struct DecayBatch {
+  std::vector<double> Times;
+  std::vector<double> StartValues;
+  std::vector<double> Velocities;
+  std::vector<double> Decelerations;
+
+  std::vector<double> Values;
+
+  size_t Add(double time, double startValue, double velocity, double deceleration);
+  size_t Size() const noexcept;
+  void Clear() noexcept;
+};
+
+// The batches of calculated animation drivers stepped in the same frame.
+struct AnimationBatch {
+  SpringBatch Springs;
+  DecayBatch Decays;
+
+  void Clear() noexcept;
+};
+
+// Same results as Interpolate in AnimationUtils.h for each value.
+void EvaluateInterpolations(InterpolationBatch &batch) noexcept;
+
+// Same results as SpringAnimationDriver::GetValueAndVelocityForTime for each animation that is not driven by
+// composition, i.e. that animates towards its end value.
+void EvaluateSprings(SpringBatch &batch) noexcept;
+
+// Same results as DecayAnimationDriver::GetValueAndVelocityForTime for each animation.
+void EvaluateDecays(DecayBatch &batch) noexcept;
+
+} // namespace Microsoft::ReactNative
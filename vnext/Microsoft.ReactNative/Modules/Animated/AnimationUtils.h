@@ -2,10 +2,7 @@
 // Licensed under the MIT License.
 
 #pragma once
-
-static constexpr std::string_view ExtrapolateTypeIdentity = "identity";
-static constexpr std::string_view ExtrapolateTypeClamp = "clamp";
-static constexpr std::string_view ExtrapolateTypeExtend = "extend";
+#include "ExtrapolationType.h"
 
 static double Interpolate(
     double value,
@@ -13,23 +10,23 @@ static double Interpolate(
     double inputMax,
     double outputMin,
     double outputMax,
-    std::string_view const &extrapolateLeft,
-    std::string_view const &extrapolateRight) {
+    ExtrapolationType extrapolateLeft,
+    ExtrapolationType extrapolateRight) noexcept {
   auto result = value;
 
   // Extrapolate
   if (result < inputMin) {
-    if (extrapolateLeft == ExtrapolateTypeIdentity) {
+    if (extrapolateLeft == ExtrapolationType::Identity) {
       return result;
-    } else if (extrapolateLeft == ExtrapolateTypeClamp) {
+    } else if (extrapolateLeft == ExtrapolationType::Clamp) {
       result = inputMin;
     }
   }
 
   if (result > inputMax) {
-    if (extrapolateRight == ExtrapolateTypeIdentity) {
+    if (extrapolateRight == ExtrapolationType::Identity) {
       return result;
-    } else if (extrapolateRight == ExtrapolateTypeClamp) {
+    } else if (extrapolateRight == ExtrapolationType::Clamp) {
       result = inputMax;
     }
   }
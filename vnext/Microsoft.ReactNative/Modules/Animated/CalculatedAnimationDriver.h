@@ -18,5 +18,8 @@ class CalculatedAnimationDriver : public AnimationDriver {
  protected:
   virtual std::tuple<float, double> GetValueAndVelocityForTime(double time) = 0;
   virtual bool IsAnimationDone(double currentValue, std::optional<double> previousValue, double currentVelocity) = 0;
+
+  // The index of the sample queued by QueueUpdate in the batch of the current frame.
+  size_t m_batchIndex{0};
 };
 } // namespace Microsoft::ReactNative
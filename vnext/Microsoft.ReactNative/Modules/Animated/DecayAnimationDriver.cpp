@@ -36,24 +36,56 @@ bool DecayAnimationDriver::IsAnimationDone(
 bool DecayAnimationDriver::Update(double timeDeltaMs, bool restarting) {
   if (const auto node = GetAnimatedValue()) {
     if (restarting) {
-      const auto value = node->RawValue();
-      if (!m_originalValue) {
-        // First iteration, assign m_fromValue based on AnimatedValue
-        m_originalValue = value;
-      } else {
-        // Not the first iteration, reset AnimatedValue based on m_originalValue
-        node->RawValue(m_originalValue.value());
-      }
-
-      m_lastValue = value;
+      Restart(*node);
     }
 
     const auto [value, velocity] = GetValueAndVelocityForTime(timeDeltaMs / 1000.0);
-    if (restarting || IsAnimationDone(value, m_lastValue, 0.0 /* ignored */)) {
-      m_lastValue = value;
-      node->RawValue(value);
-      return false;
+    return ApplyValue(*node, value, restarting);
+  }
+
+  return true;
+}
+
+std::optional<bool> DecayAnimationDriver::QueueUpdate(double timeDeltaMs, bool restarting, AnimationBatch &batch) {
+  if (const auto node = GetAnimatedValue()) {
+    if (restarting) {
+      Restart(*node);
     }
+
+    m_restarting = restarting;
+    m_batchIndex = batch.Decays.Add(timeDeltaMs / 1000.0, m_originalValue.value(), m_velocity, m_deceleration);
+    return std::nullopt;
+  }
+
+  return true;
+}
+
+bool DecayAnimationDriver::CompleteUpdate(AnimationBatch const &batch) {
+  if (const auto node = GetAnimatedValue()) {
+    return ApplyValue(*node, static_cast<float>(batch.Decays.Values[m_batchIndex]), m_restarting);
+  }
+
+  return true;
+}
+
+void DecayAnimationDriver::Restart(ValueAnimatedNode &node) {
+  const auto value = node.RawValue();
+  if (!m_originalValue) {
+    // First iteration, assign m_fromValue based on AnimatedValue
+    m_originalValue = value;
+  } else {
+    // Not the first iteration, reset AnimatedValue based on m_originalValue
+    node.RawValue(m_originalValue.value());
+  }
+
+  m_lastValue = value;
+}
+
+bool DecayAnimationDriver::ApplyValue(ValueAnimatedNode &node, float value, bool restarting) {
+  if (restarting || IsAnimationDone(value, m_lastValue, 0.0 /* ignored */)) {
+    m_lastValue = value;
+    node.RawValue(value);
+    return false;
   }
 
   return true;
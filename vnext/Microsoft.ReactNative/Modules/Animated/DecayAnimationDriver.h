@@ -18,13 +18,19 @@ class DecayAnimationDriver : public CalculatedAnimationDriver {
 
  protected:
   bool Update(double timeDeltaMs, bool restarting) override;
+  std::optional<bool> QueueUpdate(double timeDeltaMs, bool restarting, AnimationBatch &batch) override;
+  bool CompleteUpdate(AnimationBatch const &batch) override;
   std::tuple<float, double> GetValueAndVelocityForTime(double time) override;
   bool IsAnimationDone(double currentValue, std::optional<double> previousValue, double currentVelocity) override;
 
  private:
+  void Restart(ValueAnimatedNode &node);
+  bool ApplyValue(ValueAnimatedNode &node, float value, bool restarting);
+
   double m_velocity{0};
   double m_deceleration{0};
   double m_lastValue{0};
+  bool m_restarting{false};
 
   static constexpr std::string_view s_velocityName{"velocity"};
   static constexpr std::string_view s_decelerationName{"deceleration"};
@@ -82,8 +82,15 @@ bool FrameAnimationDriver::Update(double timeDeltaMs, bool restarting) {
       const auto fromValue = m_frames[startIndex];
       const auto toValue = m_frames[nextIndex];
       const auto frameOutput = Interpolate(
-          timeDeltaMs, fromInterval, toInterval, fromValue, toValue, ExtrapolateTypeExtend, ExtrapolateTypeExtend);
-      nextValue = Interpolate(frameOutput, 0, 1, startValue, m_toValue, ExtrapolateTypeExtend, ExtrapolateTypeExtend);
+          timeDeltaMs,
+          fromInterval,
+          toInterval,
+          fromValue,
+          toValue,
+          ExtrapolationType::Extend,
+          ExtrapolationType::Extend);
+      nextValue = Interpolate(
+          frameOutput, 0, 1, startValue, m_toValue, ExtrapolationType::Extend, ExtrapolationType::Extend);
     }
 
     node->RawValue(nextValue);
@@ -21,8 +21,8 @@ InterpolationAnimatedNode::InterpolationAnimatedNode(
     m_outputRanges.push_back(rangeValue.AsDouble());
   }
 
-  m_extrapolateLeft = config[s_extrapolateLeftName].AsString();
-  m_extrapolateRight = config[s_extrapolateRightName].AsString();
+  m_extrapolateLeft = ExtrapolationTypeFromString(config[s_extrapolateLeftName].AsString());
+  m_extrapolateRight = ExtrapolationTypeFromString(config[s_extrapolateRightName].AsString());
 }
 
 void InterpolationAnimatedNode::Update() {
@@ -38,6 +38,35 @@ void InterpolationAnimatedNode::Update() {
   }
 }
 
+bool InterpolationAnimatedNode::QueueInterpolation(InterpolationBatch &batch) {
+  assert(!m_useComposition);
+  if (m_parentTag == s_parentTagUnset) {
+    return false;
+  }
+
+  if (const auto manager = m_manager.lock()) {
+    if (const auto node = manager->GetValueAnimatedNode(m_parentTag)) {
+      const auto value = node->Value();
+      const auto rangeIndex = RangeIndex(value);
+      batch.Add(
+          value,
+          m_inputRanges[rangeIndex],
+          m_inputRanges[rangeIndex + 1],
+          m_outputRanges[rangeIndex],
+          m_outputRanges[rangeIndex + 1],
+          m_extrapolateLeft,
+          m_extrapolateRight);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void InterpolationAnimatedNode::CompleteInterpolation(InterpolationBatch const &batch, size_t index) {
+  RawValue(batch.Results[index]);
+}
+
 void InterpolationAnimatedNode::OnDetachedFromNode([[maybe_unused]] int64_t animatedNodeTag) {
   assert(m_parentTag == animatedNodeTag);
   m_parentTag = s_parentTagUnset;
@@ -157,7 +186,7 @@ winrt::hstring InterpolationAnimatedNode::GetLeftExpression(
     const winrt::hstring &leftInterpolateExpression) {
   const auto firstInput = s_inputName.data() + std::to_wstring(0);
   const auto firstOutput = s_outputName.data() + std::to_wstring(0);
-  switch (ExtrapolationTypeFromString(m_extrapolateLeft)) {
+  switch (m_extrapolateLeft) {
     case ExtrapolationType::Clamp:
       return value + L" < " + firstInput + L" ? " + firstOutput + L" : ";
     case ExtrapolationType::Identity:
@@ -174,7 +203,7 @@ winrt::hstring InterpolationAnimatedNode::GetRightExpression(
     const winrt::hstring &rightInterpolateExpression) {
   const auto lastInput = s_inputName.data() + std::to_wstring(m_inputRanges.size() - 1);
   const auto lastOutput = s_outputName.data() + std::to_wstring(m_outputRanges.size() - 1);
-  switch (ExtrapolationTypeFromString(m_extrapolateRight)) {
+  switch (m_extrapolateRight) {
     case ExtrapolationType::Clamp:
       return value + L" > " + lastInput + L" ? " + lastOutput + L" : ";
     case ExtrapolationType::Identity:
@@ -187,15 +216,7 @@ winrt::hstring InterpolationAnimatedNode::GetRightExpression(
 }
 
 double InterpolationAnimatedNode::InterpolateValue(double value) {
-  // Compute range index
-  size_t index = 1;
-  for (; index < m_inputRanges.size() - 1; ++index) {
-    if (m_inputRanges[index] >= value) {
-      break;
-    }
-  }
-  index--;
-
+  const auto index = RangeIndex(value);
   return Interpolate(
       value,
       m_inputRanges[index],
@@ -206,4 +227,14 @@ double InterpolationAnimatedNode::InterpolateValue(double value) {
       m_extrapolateRight);
 }
 
+size_t InterpolationAnimatedNode::RangeIndex(double value) const noexcept {
+  size_t index = 1;
+  for (; index < m_inputRanges.size() - 1; ++index) {
+    if (m_inputRanges[index] >= value) {
+      break;
+    }
+  }
+  return index - 1;
+}
+
 } // namespace Microsoft::ReactNative
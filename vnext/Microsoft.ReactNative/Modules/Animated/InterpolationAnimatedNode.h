@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include "AnimationKernels.h"
+#include "ExtrapolationType.h"
 #include "ValueAnimatedNode.h"
 
 namespace Microsoft::ReactNative {
@@ -17,6 +19,11 @@ class InterpolationAnimatedNode final : public ValueAnimatedNode {
   virtual void OnDetachedFromNode(int64_t animatedNodeTag) override;
   virtual void OnAttachToNode(int64_t animatedNodeTag) override;
 
+  // Batched equivalent of Update: appends the interpolation of the parent value to the batch, if there is a parent,
+  // and applies the result at that position once the batch has been evaluated.
+  bool QueueInterpolation(InterpolationBatch &batch);
+  void CompleteInterpolation(InterpolationBatch const &batch, size_t index);
+
   static constexpr std::string_view ExtrapolateTypeIdentity = "identity";
   static constexpr std::string_view ExtrapolateTypeClamp = "clamp";
   static constexpr std::string_view ExtrapolateTypeExtend = "extend";
@@ -35,13 +42,14 @@ class InterpolationAnimatedNode final : public ValueAnimatedNode {
   winrt::hstring GetRightExpression(const winrt::hstring &, const winrt::hstring &rightInterpolateExpression);
 
   double InterpolateValue(double value);
+  size_t RangeIndex(double value) const noexcept;
 
   comp::ExpressionAnimation m_rawValueAnimation{nullptr};
   comp::ExpressionAnimation m_offsetAnimation{nullptr};
   std::vector<double> m_inputRanges;
   std::vector<double> m_outputRanges;
-  std::string m_extrapolateLeft;
-  std::string m_extrapolateRight;
+  ExtrapolationType m_extrapolateLeft{ExtrapolationType::Extend};
+  ExtrapolationType m_extrapolateRight{ExtrapolationType::Extend};
 
   int64_t m_parentTag{s_parentTagUnset};
 
@@ -24,7 +24,6 @@
 #include "FacadeType.h"
 
 #include <Windows.Foundation.h>
-#include <queue>
 
 #ifdef USE_FABRIC
 #include <Fabric/Composition/CompositionContextHelper.h>
@@ -70,6 +69,8 @@ void NativeAnimatedNodeManager::CreateAnimatedNode(
     return;
   }
 
+  m_evaluationPlan.Invalidate();
+
   switch (const auto type = AnimatedNodeTypeFromString(config["type"].AsString())) {
     case AnimatedNodeType::Style: {
       m_styleNodes.emplace(tag, std::make_unique<StyleAnimatedNode>(tag, config, manager));
@@ -156,6 +157,7 @@ void NativeAnimatedNodeManager::RestoreDefaultValues(int64_t tag) {
 void NativeAnimatedNodeManager::ConnectAnimatedNode(int64_t parentNodeTag, int64_t childNodeTag) {
   if (const auto parentNode = GetAnimatedNode(parentNodeTag)) {
     parentNode->AddChild(childNodeTag);
+    m_evaluationPlan.Invalidate();
     if (!parentNode->UseComposition()) {
       m_updatedNodes.insert(childNodeTag);
       EnsureRendering();
@@ -166,6 +168,7 @@ void NativeAnimatedNodeManager::ConnectAnimatedNode(int64_t parentNodeTag, int64
 void NativeAnimatedNodeManager::DisconnectAnimatedNode(int64_t parentNodeTag, int64_t childNodeTag) {
   if (const auto parentNode = GetAnimatedNode(parentNodeTag)) {
     parentNode->RemoveChild(childNodeTag);
+    m_evaluationPlan.Invalidate();
     if (!parentNode->UseComposition()) {
       m_updatedNodes.insert(childNodeTag);
       EnsureRendering();
@@ -353,6 +356,7 @@ void NativeAnimatedNodeManager::DropAnimatedNode(int64_t tag) {
   m_styleNodes.erase(tag);
   m_transformNodes.erase(tag);
   m_updatedNodes.erase(tag);
+  m_evaluationPlan.Invalidate();
 }
 
 void NativeAnimatedNodeManager::SetAnimatedNodeValue(int64_t tag, double value) {
@@ -570,11 +574,23 @@ void NativeAnimatedNodeManager::RunUpdates(winrt::TimeSpan renderingTime) {
   std::unordered_set<int64_t> updatingNodes{};
   updatingNodes = std::move(m_updatedNodes);
 
-  // Increment animation drivers
+  // Increment animation drivers. Spring and decay drivers queue their samples so that they are computed together.
+  m_animationBatch.Clear();
+  m_queuedAnimations.clear();
   for (auto id : m_activeAnimationIds) {
     auto &animation = m_activeAnimations.at(id);
-    animation->RunAnimationStep(renderingTime);
+    if (animation->QueueAnimationStep(renderingTime, m_animationBatch)) {
+      m_queuedAnimations.push_back(animation.get());
+    } else if (animation->IsComplete()) {
+      hasFinishedAnimations = true;
+    }
     updatingNodes.insert(animation->AnimatedValueTag());
+  }
+
+  EvaluateSprings(m_animationBatch.Springs);
+  EvaluateDecays(m_animationBatch.Decays);
+  for (const auto animation : m_queuedAnimations) {
+    animation->CompleteAnimationStep(m_animationBatch);
     if (animation->IsComplete()) {
       hasFinishedAnimations = true;
     }
@@ -633,107 +649,33 @@ void NativeAnimatedNodeManager::UpdateActiveAnimationIds() {
 }
 
 void NativeAnimatedNodeManager::UpdateNodes(std::unordered_set<int64_t> &nodes) {
-  auto activeNodesCount = 0;
-  auto updatedNodesCount = 0;
-
-  // BFS state
-  std::unordered_map<int64_t, int64_t> bfsColors;
-  std::unordered_map<int64_t, int64_t> incomingNodeCounts;
-
-  // STEP 1.
-  // BFS over graph of nodes starting from IDs in `nodes` argument and IDs that are attached to
-  // active animations (from `m_activeAnimations)`. Update `incomingNodeCounts` map for each node
-  // during that BFS. Store number of visited nodes in `activeNodesCount`. We "execute" active
-  // animations as a part of this step.
-
-  m_animatedGraphBFSColor++; /* use new color */
-  if (m_animatedGraphBFSColor == 0) {
-    // value "0" is used as an initial color for a new node, using it in BFS may cause some nodes to be skipped.
-    m_animatedGraphBFSColor++;
-  }
-
-  std::queue<int64_t> nodesQueue{};
-  for (auto id : nodes) {
-    if (!bfsColors.count(id) || bfsColors.at(id) != m_animatedGraphBFSColor) {
-      bfsColors[id] = m_animatedGraphBFSColor;
-      activeNodesCount++;
-      nodesQueue.push(id);
-    }
-  }
-
-  while (nodesQueue.size() > 0) {
-    auto id = nodesQueue.front();
-    nodesQueue.pop();
-    if (auto node = GetAnimatedNode(id)) {
-      for (auto &childId : node->Children()) {
-        if (!incomingNodeCounts.count(childId)) {
-          incomingNodeCounts[childId] = 1;
-        } else {
-          incomingNodeCounts.at(childId)++;
-        }
-
-        if (!bfsColors.count(childId) || bfsColors.at(childId) != m_animatedGraphBFSColor) {
-          bfsColors[childId] = m_animatedGraphBFSColor;
-          activeNodesCount++;
-          nodesQueue.push(childId);
-        }
-      }
+  // The plan only changes with the topology of the graph, which stays the same for most frames.
+  if (!m_evaluationPlan.IsValid()) {
+    std::vector<std::pair<AnimatedNode *, AnimatedNodeKind>> allNodes{};
+    allNodes.reserve(
+        m_valueNodes.size() + m_propsNodes.size() + m_styleNodes.size() + m_transformNodes.size() +
+        m_trackingNodes.size());
+    for (const auto &pair : m_valueNodes) {
+      const auto isInterpolation = dynamic_cast<InterpolationAnimatedNode *>(pair.second.get()) != nullptr;
+      allNodes.emplace_back(
+          pair.second.get(), isInterpolation ? AnimatedNodeKind::Interpolation : AnimatedNodeKind::Value);
     }
-  }
-
-  // STEP 2
-  // BFS over the graph of active nodes in topological order -> visit node only when all its
-  // "predecessors" in the graph have already been visited. It is important to visit nodes in that
-  // order as they may often use values of their predecessors in order to calculate "next state"
-  // of their own. We start by determining the starting set of nodes by looking for nodes with
-  // `incomingNodeCounts[id] = 0` (those can only be the ones that we start BFS in the previous
-  // step). We store number of visited nodes in this step in `updatedNodesCount`
-
-  m_animatedGraphBFSColor++;
-  if (m_animatedGraphBFSColor == 0) {
-    // see reasoning for this check a few lines above
-    m_animatedGraphBFSColor++;
-  }
-
-  // find nodes with zero "incoming nodes", those can be either nodes from `m_updatedNodes` or
-  // ones connected to active animations
-  for (auto id : nodes) {
-    if (!incomingNodeCounts.count(id) ||
-        incomingNodeCounts.at(id) == 0 && bfsColors.at(id) != m_animatedGraphBFSColor) {
-      bfsColors[id] = m_animatedGraphBFSColor;
-      updatedNodesCount++;
-      nodesQueue.push(id);
+    for (const auto &pair : m_propsNodes) {
+      allNodes.emplace_back(pair.second.get(), AnimatedNodeKind::Props);
     }
-  }
-
-  // Run main "update" loop
-  while (nodesQueue.size() > 0) {
-    auto id = nodesQueue.front();
-    nodesQueue.pop();
-    if (auto node = GetAnimatedNode(id)) {
-      node->Update();
-      if (auto propsNode = GetPropsAnimatedNode(id)) {
-        propsNode->UpdateView();
-      } else if (auto valueNode = GetValueAnimatedNode(id)) {
-        valueNode->OnValueUpdate();
-      }
-
-      for (auto &childId : node->Children()) {
-        auto &incomingCount = incomingNodeCounts.at(childId);
-        auto &bfsColor = bfsColors.at(childId);
-        incomingCount--;
-        if (bfsColor != m_animatedGraphBFSColor && incomingCount == 0) {
-          bfsColor = m_animatedGraphBFSColor;
-          updatedNodesCount++;
-          nodesQueue.push(childId);
-        }
-      }
+    for (const auto &pair : m_styleNodes) {
+      allNodes.emplace_back(pair.second.get(), AnimatedNodeKind::Other);
+    }
+    for (const auto &pair : m_transformNodes) {
+      allNodes.emplace_back(pair.second.get(), AnimatedNodeKind::Other);
     }
+    for (const auto &pair : m_trackingNodes) {
+      allNodes.emplace_back(pair.second.get(), AnimatedNodeKind::Other);
+    }
+
+    m_evaluationPlan.Build(allNodes);
   }
 
-  // Verify that we've visited *all* active nodes. Throw otherwise as this would mean there is a
-  // cycle in animated node graph. We also take advantage of the fact that all active nodes are
-  // visited in the step above so that `incomingNodeCounts` for all node IDs are set to zero
-  assert(activeNodesCount == updatedNodesCount);
+  m_evaluationPlan.Run(nodes);
 }
 } // namespace Microsoft::ReactNative
@@ -9,7 +9,9 @@
 #include <cxxreact/CxxModule.h>
 #include <folly/dynamic.h>
 #include "AnimatedNode.h"
+#include "AnimatedNodeEvaluationPlan.h"
 #include "AnimationDriver.h"
+#include "AnimationKernels.h"
 #include "EventAnimationDriver.h"
 #include "PropsAnimatedNode.h"
 #include "StyleAnimatedNode.h"
@@ -134,7 +136,9 @@ class NativeAnimatedNodeManager {
 
   std::unordered_set<int64_t> m_updatedNodes{};
   std::vector<int64_t> m_activeAnimationIds{};
-  int64_t m_animatedGraphBFSColor{};
+  AnimatedNodeEvaluationPlan m_evaluationPlan{};
+  AnimationBatch m_animationBatch{};
+  std::vector<AnimationDriver *> m_queuedAnimations{};
   xaml::Media::CompositionTarget::Rendering_revoker m_renderingRevoker;
 
   static constexpr std::string_view s_toValueIdName{"toValue"};
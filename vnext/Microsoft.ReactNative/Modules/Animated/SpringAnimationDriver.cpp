@@ -81,47 +81,81 @@ std::tuple<float, double> SpringAnimationDriver::GetValueAndVelocityForTime(doub
 bool SpringAnimationDriver::Update(double timeDeltaMs, bool restarting) {
   assert(!m_useComposition);
   if (const auto node = GetAnimatedValue()) {
-    if (restarting) {
-      if (!m_originalValue) {
-        m_originalValue = node->RawValue();
-      } else {
-        node->RawValue(m_originalValue.value());
-      }
+    const auto [value, velocity] = GetValueAndVelocityForTime(AdvanceTime(*node, timeDeltaMs, restarting));
+    return ApplyValue(*node, value, velocity);
+  }
 
-      // Spring animations run a frame behind JS driven animations if we do
-      // not start the first frame at 16ms.
-      m_lastTime = timeDeltaMs - s_frameDurationMs;
-      m_timeAccumulator = 0.0;
-    }
+  return true;
+}
 
-    // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
-    // We should be able to catch up in a subsequent advance if necessary.
-    auto adjustedDeltaTime = timeDeltaMs - m_lastTime;
-    if (adjustedDeltaTime > MAX_DELTA_TIME_MS) {
-      adjustedDeltaTime = MAX_DELTA_TIME_MS;
-    }
-    m_timeAccumulator += adjustedDeltaTime;
-    m_lastTime = timeDeltaMs;
+std::optional<bool> SpringAnimationDriver::QueueUpdate(double timeDeltaMs, bool restarting, AnimationBatch &batch) {
+  assert(!m_useComposition);
+  if (const auto node = GetAnimatedValue()) {
+    const auto time = AdvanceTime(*node, timeDeltaMs, restarting);
+    m_batchIndex = batch.Springs.Add(
+        time,
+        m_originalValue.value(),
+        m_endValue,
+        m_springStiffness,
+        m_springDamping,
+        m_springMass,
+        m_initialVelocity);
+    return std::nullopt;
+  }
 
-    auto [value, velocity] = GetValueAndVelocityForTime(m_timeAccumulator / 1000.0);
+  return true;
+}
 
-    auto isComplete = false;
-    if (IsAnimationDone(value, std::nullopt, velocity)) {
-      if (m_springStiffness > 0) {
-        value = static_cast<float>(m_endValue);
-      } else {
-        m_endValue = value;
-      }
+bool SpringAnimationDriver::CompleteUpdate(AnimationBatch const &batch) {
+  if (const auto node = GetAnimatedValue()) {
+    return ApplyValue(
+        *node, static_cast<float>(batch.Springs.Values[m_batchIndex]), batch.Springs.Velocities[m_batchIndex]);
+  }
+
+  return true;
+}
 
-      isComplete = true;
+double SpringAnimationDriver::AdvanceTime(ValueAnimatedNode &node, double timeDeltaMs, bool restarting) {
+  if (restarting) {
+    if (!m_originalValue) {
+      m_originalValue = node.RawValue();
+    } else {
+      node.RawValue(m_originalValue.value());
     }
 
-    node->RawValue(value);
+    // Spring animations run a frame behind JS driven animations if we do
+    // not start the first frame at 16ms.
+    m_lastTime = timeDeltaMs - s_frameDurationMs;
+    m_timeAccumulator = 0.0;
+  }
 
-    return isComplete;
+  // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
+  // We should be able to catch up in a subsequent advance if necessary.
+  auto adjustedDeltaTime = timeDeltaMs - m_lastTime;
+  if (adjustedDeltaTime > MAX_DELTA_TIME_MS) {
+    adjustedDeltaTime = MAX_DELTA_TIME_MS;
   }
+  m_timeAccumulator += adjustedDeltaTime;
+  m_lastTime = timeDeltaMs;
 
-  return true;
+  return m_timeAccumulator / 1000.0;
+}
+
+bool SpringAnimationDriver::ApplyValue(ValueAnimatedNode &node, float value, double velocity) {
+  auto isComplete = false;
+  if (IsAnimationDone(value, std::nullopt, velocity)) {
+    if (m_springStiffness > 0) {
+      value = static_cast<float>(m_endValue);
+    } else {
+      m_endValue = value;
+    }
+
+    isComplete = true;
+  }
+
+  node.RawValue(value);
+
+  return isComplete;
 }
 
 bool SpringAnimationDriver::IsAtRest(double currentVelocity, double currentValue, double endValue) {
@@ -22,10 +22,14 @@ class SpringAnimationDriver : public CalculatedAnimationDriver {
 
  protected:
   bool Update(double timeDeltaMs, bool restarting) override;
+  std::optional<bool> QueueUpdate(double timeDeltaMs, bool restarting, AnimationBatch &batch) override;
+  bool CompleteUpdate(AnimationBatch const &batch) override;
   std::tuple<float, double> GetValueAndVelocityForTime(double time) override;
   bool IsAnimationDone(double currentValue, std::optional<double> previousValue, double currentVelocity) override;
 
  private:
+  double AdvanceTime(ValueAnimatedNode &node, double timeDeltaMs, bool restarting);
+  bool ApplyValue(ValueAnimatedNode &node, float value, double velocity);
   bool IsAtRest(double currentVelocity, double currentPosition, double endValue);
   bool IsOvershooting(double currentValue);
 
@@ -0,0 +1,53 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <yoga/Yoga.h>
+#include <cstdint>
+
+namespace Microsoft::ReactNative {
+
+// What a layout pass of NativeUIManager did, to tell how much of the tree a batch touched.
+struct LayoutBatchStats {
+  // Roots whose layout was calculated.
+  uint32_t RootsLaidOut{0};
+  // Roots skipped because neither their size nor any of their nodes changed since their last layout.
+  uint32_t RootsSkipped{0};
+  // Nodes visited to find the ones with a new layout.
+  uint32_t NodesVisited{0};
+  // Frames set on views through SetLayoutProps.
+  uint32_t LayoutsApplied{0};
+  // New layouts that were not set on their view, as it already has that frame.
+  uint32_t LayoutsUnchanged{0};
+};
+
+// Calls `visit(tag, yogaNode)` for each node under `tag`, children first, that got a new layout from the last
+// YGNodeCalculateLayout, and clears its new layout flag.
+//
+// Yoga only gives a new layout to the nodes that their parent laid out, and it does not lay out the children of the
+// nodes whose layout it takes from its cache. So the children of a node without a new layout are not visited, as none
+// of them got one either. Changing one leaf then visits the nodes laid out again and their children rather than the
+// whole tree. Nodes without a Yoga node are always visited through.
+template <typename TGetYogaNode, typename TForEachChild, typename TVisit>
+void VisitNewLayouts(
+    int64_t tag,
+    TGetYogaNode const &getYogaNode,
+    TForEachChild const &forEachChild,
+    TVisit const &visit,
+    LayoutBatchStats &stats) {
+  ++stats.NodesVisited;
+  YGNodeRef yogaNode = getYogaNode(tag);
+  if (yogaNode && !YGNodeGetHasNewLayout(yogaNode)) {
+    return;
+  }
+
+  forEachChild(tag, [&](int64_t child) { VisitNewLayouts(child, getYogaNode, forEachChild, visit, stats); });
+
+  if (yogaNode) {
+    YGNodeSetHasNewLayout(yogaNode, false);
+    visit(tag, yogaNode);
+  }
+}
+
+} // namespace Microsoft::ReactNative
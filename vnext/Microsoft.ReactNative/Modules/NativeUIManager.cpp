@@ -797,6 +797,7 @@ void NativeUIManager::CreateView(ShadowNode &shadowNode, React::JSValueObject &p
     if (result.second == true) {
       YGNodeRef yogaNode = result.first->second.get();
       StyleYogaNode(node, yogaNode, props);
+      m_tagsWithUpdatedViews.insert(node.m_tag);
 
       YGMeasureFunc func = pViewManager->GetYogaCustomMeasureFunc();
       if (func != nullptr) {
@@ -827,6 +828,7 @@ void NativeUIManager::AddView(ShadowNode &parentShadowNode, ShadowNode &childSha
     }
 
     YGNodeInsertChild(yogaNodeToManage, yogaNodeToAdd, static_cast<uint32_t>(index));
+    m_tagsWithUpdatedViews.insert(childNode.m_tag);
   }
 }
 
@@ -848,6 +850,8 @@ void NativeUIManager::RemoveView(ShadowNode &shadowNode, bool removeChildren /*=
 
   m_tagsToYogaNodes.erase(node.m_tag);
   m_tagsToYogaContext.erase(node.m_tag);
+  m_tagsWithUpdatedViews.erase(node.m_tag);
+  m_lastLayoutSizes.erase(node.m_tag);
 }
 
 void NativeUIManager::ReplaceView(ShadowNode &shadowNode) {
@@ -858,6 +862,7 @@ void NativeUIManager::ReplaceView(ShadowNode &shadowNode) {
     auto it = m_tagsToYogaNodes.find(node.m_tag);
     if (it != m_tagsToYogaNodes.end()) {
       YGNodeRef yogaNode = it->second.get();
+      m_tagsWithUpdatedViews.insert(node.m_tag);
 
       if (pViewManager->IsNativeControlWithSelfLayout()) {
         auto context = std::make_unique<YogaContext>(node.GetView());
@@ -881,11 +886,13 @@ void NativeUIManager::UpdateView(ShadowNode &shadowNode, winrt::Microsoft::React
   if (pViewManager->RequiresYogaNode()) {
     YGNodeRef yogaNode = GetYogaNode(node.m_tag);
     StyleYogaNode(node, yogaNode, props);
+    m_tagsWithUpdatedViews.insert(node.m_tag);
   }
 }
 
 void NativeUIManager::DoLayout() {
   TraceSection s("NativeUIManager::DoLayout");
+  m_layoutStats = {};
 
   {
     TraceSection s("NativeUIManager::DoLayout::UpdateLayout");
@@ -908,10 +915,30 @@ void NativeUIManager::DoLayout() {
     const auto rootElement = rootShadowNode.GetView().as<xaml::FrameworkElement>();
     float actualWidth = static_cast<float>(rootElement.ActualWidth());
     float actualHeight = static_cast<float>(rootElement.ActualHeight());
+    if (IsLayoutUpToDate(rootTag, actualWidth, actualHeight)) {
+      ++m_layoutStats.RootsSkipped;
+      continue;
+    }
     ApplyLayout(rootTag, actualWidth, actualHeight);
   }
 }
 
+// A root needs no layout if it has the size it was last laid out with and none of its nodes were dirtied since, as
+// Yoga would then reuse the previous layout of every node.
+bool NativeUIManager::IsLayoutUpToDate(int64_t rootTag, float width, float height) const {
+  const auto lastSize = m_lastLayoutSizes.find(rootTag);
+  if (lastSize == m_lastLayoutSizes.end() || lastSize->second.width != width || lastSize->second.height != height) {
+    return false;
+  }
+
+  const auto rootNode = GetYogaNode(rootTag);
+  return rootNode && !YGNodeIsDirty(rootNode) && m_tagsWithUpdatedViews.count(rootTag) == 0;
+}
+
+const LayoutBatchStats &NativeUIManager::LastLayoutStats() const noexcept {
+  return m_layoutStats;
+}
+
 void NativeUIManager::ApplyLayout(int64_t tag, float width, float height) {
   if (YGNodeRef rootNode = GetYogaNode(tag)) {
     TraceSection s("NativeUIManager::DoLayout::YGNodeCalculateLayout");
@@ -919,6 +946,8 @@ void NativeUIManager::ApplyLayout(int64_t tag, float width, float height) {
     // We will flip the root of the tree into RTL by forcing the root XAML node's FlowDirection to RightToLeft
     // which will inherit down the XAML tree, allowing all native controls to pick it up.
     YGNodeCalculateLayout(rootNode, width, height, YGDirectionLTR);
+    m_lastLayoutSizes[tag] = {width, height};
+    ++m_layoutStats.RootsLaidOut;
   } else {
     assert(false);
     return;
@@ -926,44 +955,56 @@ void NativeUIManager::ApplyLayout(int64_t tag, float width, float height) {
 
   {
     TraceSection s("NativeUIManager::DoLayout::SetLayoutProps");
-    SetLayoutPropsRecursive(tag);
+    VisitNewLayouts(
+        tag,
+        [this](int64_t nodeTag) { return GetYogaNode(nodeTag); },
+        [this](int64_t nodeTag, auto const &visitChild) {
+          ShadowNodeBase &shadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(nodeTag));
+          if (!shadowNode.GetViewManager()->IsNativeControlWithSelfLayout()) {
+            for (const auto child : shadowNode.m_children) {
+              visitChild(child);
+            }
+          }
+        },
+        [this](int64_t nodeTag, YGNodeRef yogaNode) {
+          SetLayoutProps(static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(nodeTag)), yogaNode);
+        },
+        m_layoutStats);
   }
 }
 
-void NativeUIManager::SetLayoutPropsRecursive(int64_t tag) {
-  ShadowNodeBase &shadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(tag));
-  auto *pViewManager = shadowNode.GetViewManager();
-  if (!pViewManager->IsNativeControlWithSelfLayout()) {
-    for (const auto child : shadowNode.m_children) {
-      SetLayoutPropsRecursive(child);
-    }
+void NativeUIManager::SetLayoutProps(ShadowNodeBase &shadowNode, YGNodeRef yogaNode) {
+  float left = YGNodeLayoutGetLeft(yogaNode);
+  float top = YGNodeLayoutGetTop(yogaNode);
+  float width = YGNodeLayoutGetWidth(yogaNode);
+  float height = YGNodeLayoutGetHeight(yogaNode);
+
+  // Yoga also reports a new layout for nodes it laid out again to the same frame. Setting that frame on the view again
+  // would only cause XAML to measure and arrange it, unless the view was created or updated since.
+  const auto &lastLayout = shadowNode.m_layout;
+  if (left == lastLayout.Left && top == lastLayout.Top && width == lastLayout.Width && height == lastLayout.Height &&
+      m_tagsWithUpdatedViews.count(shadowNode.m_tag) == 0) {
+    ++m_layoutStats.LayoutsUnchanged;
+    return;
   }
 
-  const auto tagToYogaNode = m_tagsToYogaNodes.find(tag);
-  if (auto yogaNode = GetYogaNode(tag)) {
-    if (!YGNodeGetHasNewLayout(yogaNode))
-      return;
-    YGNodeSetHasNewLayout(yogaNode, false);
-
-    float left = YGNodeLayoutGetLeft(yogaNode);
-    float top = YGNodeLayoutGetTop(yogaNode);
-    float width = YGNodeLayoutGetWidth(yogaNode);
-    float height = YGNodeLayoutGetHeight(yogaNode);
-    auto view = shadowNode.GetView();
-    auto pViewManager = shadowNode.GetViewManager();
-    pViewManager->SetLayoutProps(shadowNode, view, left, top, width, height);
-    if (shadowNode.m_onLayoutRegistered) {
-      const auto hasLayoutChanged = !YogaFloatEquals(left, shadowNode.m_layout.Left) ||
-          !YogaFloatEquals(top, shadowNode.m_layout.Top) || !YogaFloatEquals(width, shadowNode.m_layout.Width) ||
-          !YogaFloatEquals(height, shadowNode.m_layout.Height);
-      if (hasLayoutChanged) {
-        React::JSValueObject layout{{"x", left}, {"y", top}, {"height", height}, {"width", width}};
-        React::JSValueObject eventData{{"target", tag}, {"layout", std::move(layout)}};
-        pViewManager->DispatchCoalescingEvent(tag, L"topLayout", MakeJSValueWriter(std::move(eventData)));
-      }
+  m_tagsWithUpdatedViews.erase(shadowNode.m_tag);
+  ++m_layoutStats.LayoutsApplied;
+
+  auto view = shadowNode.GetView();
+  auto pViewManager = shadowNode.GetViewManager();
+  pViewManager->SetLayoutProps(shadowNode, view, left, top, width, height);
+  if (shadowNode.m_onLayoutRegistered) {
+    const auto hasLayoutChanged = !YogaFloatEquals(left, lastLayout.Left) || !YogaFloatEquals(top, lastLayout.Top) ||
+        !YogaFloatEquals(width, lastLayout.Width) || !YogaFloatEquals(height, lastLayout.Height);
+    if (hasLayoutChanged) {
+      const auto tag = shadowNode.m_tag;
+      React::JSValueObject layout{{"x", left}, {"y", top}, {"height", height}, {"width", width}};
+      React::JSValueObject eventData{{"target", tag}, {"layout", std::move(layout)}};
+      pViewManager->DispatchCoalescingEvent(tag, L"topLayout", MakeJSValueWriter(std::move(eventData)));
     }
-    shadowNode.m_layout = {left, top, width, height};
   }
+  shadowNode.m_layout = {left, top, width, height};
 }
 
 winrt::Windows::Foundation::Rect GetRectOfElementInParentCoords(
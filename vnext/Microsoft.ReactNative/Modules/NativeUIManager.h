@@ -16,7 +16,9 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
+#include "IncrementalLayout.h"
 
 namespace Microsoft::ReactNative {
 struct IXamlReactControl;
@@ -104,8 +106,12 @@ class NativeUIManager final : public INativeUIManager {
   void DoLayout();
   void ApplyLayout(int64_t tag, float width = YGUndefined, float height = YGUndefined);
 
+  // What the last DoLayout, and the ApplyLayout calls since, laid out and applied.
+  const LayoutBatchStats &LastLayoutStats() const noexcept;
+
  private:
-  void SetLayoutPropsRecursive(int64_t tag);
+  bool IsLayoutUpToDate(int64_t rootTag, float width, float height) const;
+  void SetLayoutProps(ShadowNodeBase &shadowNode, YGNodeRef yogaNode);
   YGNodeRef GetYogaNode(int64_t tag) const;
 
   winrt::weak_ref<winrt::Microsoft::ReactNative::ReactRootView> GetParentXamlReactControl(int64_t tag) const;
@@ -122,6 +128,13 @@ class NativeUIManager final : public INativeUIManager {
   std::vector<std::function<void()>> m_batchCompletedCallbacks;
   std::vector<int64_t> m_extraLayoutNodes;
 
+  // The size each root was last laid out with, and the views created or updated since their frame was last set.
+  // Together with the dirty flags of the Yoga nodes, they let a layout pass skip the roots and frames that have not
+  // changed.
+  std::unordered_map<int64_t, YGSize> m_lastLayoutSizes;
+  std::unordered_set<int64_t> m_tagsWithUpdatedViews;
+  LayoutBatchStats m_layoutStats;
+
   std::map<int64_t, winrt::weak_ref<winrt::Microsoft::ReactNative::ReactRootView>> m_tagsToXamlReactControl;
 };
 
@@ -0,0 +1,196 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "TimerQueue.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace Microsoft::ReactNative {
+
+// The wheel uses milliseconds as ticks. DateTime counts 100ns intervals.
+constexpr int64_t TimeUnitsPerTick = 10000;
+
+// Mask for the bits of a tick that are addressed by the levels up to and including the given level.
+static uint64_t LevelRangeMask(uint32_t level, uint32_t slotBits) {
+  uint32_t bits = slotBits * (level + 1);
+  return bits >= 64 ? UINT64_MAX : (uint64_t{1} << bits) - 1;
+}
+
+TimerQueue::TimerQueue() {}
+
+uint64_t TimerQueue::ToTick(TDateTime time) {
+  return static_cast<uint64_t>(std::max<int64_t>(time.time_since_epoch().count(), 0) / TimeUnitsPerTick);
+}
+
+uint64_t TimerQueue::ToDueTick(TDateTime targetTime) {
+  // A timer fires when the current time is after its target time.
+  // The due tick is the first millisecond that starts after the target time.
+  return ToTick(targetTime) + 1;
+}
+
+void TimerQueue::Push(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
+  Remove(id);
+
+  uint64_t dueTick = ToDueTick(targetTime);
+  if (IsEmpty()) {
+    // Nothing depends on the current tick while the wheel is empty. Reset it to keep the new timer
+    // close to the lowest level. The current tick must not be ahead of the timers pushed later.
+    m_currentTick = std::min(ToTick(TDateTime::clock::now()), dueTick);
+  }
+
+  uint32_t index = AllocateNode(Timer{id, targetTime, period, repeat}, dueTick);
+  m_nodeIndexById.emplace(id, index);
+  LinkNode(index);
+}
+
+void TimerQueue::Remove(uint32_t id) {
+  auto it = m_nodeIndexById.find(id);
+  if (it == m_nodeIndexById.end())
+    return;
+
+  uint32_t index = it->second;
+  m_nodeIndexById.erase(it);
+  UnlinkNode(index);
+  FreeNode(index);
+}
+
+void TimerQueue::PopExpired(TDateTime now, std::vector<Timer> &expiredTimers) {
+  uint64_t nowTick = ToTick(now);
+  size_t firstExpiredIndex = expiredTimers.size();
+  uint32_t level, slot;
+  uint64_t slotTick;
+  while (TryGetNextSlot(level, slot, slotTick) && slotTick <= nowTick) {
+    m_currentTick = slotTick;
+
+    // Detach the whole slot: its timers either expire or move to a lower level.
+    uint32_t slotIndex = level * SlotCount + slot;
+    uint32_t index = m_slots[slotIndex].Head;
+    m_slots[slotIndex] = TimerSlot{};
+    m_occupiedSlots[level] &= ~(uint64_t{1} << slot);
+
+    while (index != InvalidIndex) {
+      TimerNode &node = m_nodes[index];
+      uint32_t next = node.Next;
+      if (node.DueTick <= m_currentTick) {
+        expiredTimers.push_back(node.Value);
+        m_nodeIndexById.erase(node.Value.Id);
+        FreeNode(index);
+      } else {
+        LinkNode(index);
+      }
+
+      index = next;
+    }
+  }
+
+  // Slots are visited in order of their ticks, but the timers pushed after their due tick are added to the
+  // current slot. Sort the batch to fire timers in order of their target time.
+  std::stable_sort(
+      expiredTimers.begin() + firstExpiredIndex, expiredTimers.end(), [](Timer const &left, Timer const &right) {
+        return left.TargetTime < right.TargetTime;
+      });
+
+  // All remaining timers are due after the now time. Moving the current tick forward keeps
+  // the timers pushed later closer to the lowest level.
+  m_currentTick = std::max(m_currentTick, nowTick);
+}
+
+TDateTime TimerQueue::NextTargetTime() const {
+  uint32_t level, slot;
+  uint64_t slotTick;
+  if (!TryGetNextSlot(level, slot, slotTick))
+    return TDateTime::max();
+
+  return TDateTime{TTimeSpan{static_cast<int64_t>(slotTick) * TimeUnitsPerTick}};
+}
+
+bool TimerQueue::IsEmpty() const {
+  return m_nodeIndexById.empty();
+}
+
+size_t TimerQueue::Size() const {
+  return m_nodeIndexById.size();
+}
+
+bool TimerQueue::TryGetNextSlot(uint32_t &level, uint32_t &slot, uint64_t &slotTick) const {
+  // Timers at a lower level are always due before the timers at an upper level because they share
+  // all upper slot digits with the current tick. Thus, the first occupied slot of the lowest
+  // occupied level is the next one to visit.
+  for (level = 0; level < LevelCount; ++level) {
+    uint32_t shift = level * SlotBits;
+    uint32_t currentSlot = static_cast<uint32_t>(m_currentTick >> shift) & (SlotCount - 1);
+    uint64_t occupiedSlots = m_occupiedSlots[level] & (UINT64_MAX << currentSlot);
+    if (occupiedSlots) {
+      slot = static_cast<uint32_t>(std::countr_zero(occupiedSlots));
+      slotTick = (m_currentTick & ~LevelRangeMask(level, SlotBits)) | (uint64_t{slot} << shift);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+uint32_t TimerQueue::AllocateNode(Timer const &timer, uint64_t dueTick) {
+  if (m_freeNodes.empty()) {
+    m_nodes.emplace_back(timer, dueTick);
+    return static_cast<uint32_t>(m_nodes.size() - 1);
+  }
+
+  uint32_t index = m_freeNodes.back();
+  m_freeNodes.pop_back();
+  m_nodes[index] = TimerNode{timer, dueTick};
+  return index;
+}
+
+void TimerQueue::FreeNode(uint32_t index) {
+  m_freeNodes.push_back(index);
+}
+
+void TimerQueue::LinkNode(uint32_t index) {
+  TimerNode &node = m_nodes[index];
+
+  // Timers that are already due are put to the current slot of the lowest level.
+  uint64_t dueTick = std::max(node.DueTick, m_currentTick);
+  uint64_t diff = dueTick ^ m_currentTick;
+  uint32_t level = diff ? (63 - static_cast<uint32_t>(std::countl_zero(diff))) / SlotBits : 0;
+  uint32_t slot = static_cast<uint32_t>(dueTick >> (level * SlotBits)) & (SlotCount - 1);
+
+  node.Slot = level * SlotCount + slot;
+  node.Next = InvalidIndex;
+  TimerSlot &timerSlot = m_slots[node.Slot];
+  node.Prev = timerSlot.Tail;
+  if (timerSlot.Tail != InvalidIndex) {
+    m_nodes[timerSlot.Tail].Next = index;
+  } else {
+    timerSlot.Head = index;
+  }
+
+  timerSlot.Tail = index;
+  m_occupiedSlots[level] |= uint64_t{1} << slot;
+}
+
+void TimerQueue::UnlinkNode(uint32_t index) {
+  TimerNode &node = m_nodes[index];
+  TimerSlot &timerSlot = m_slots[node.Slot];
+  if (node.Prev != InvalidIndex) {
+    m_nodes[node.Prev].Next = node.Next;
+  } else {
+    timerSlot.Head = node.Next;
+  }
+
+  if (node.Next != InvalidIndex) {
+    m_nodes[node.Next].Prev = node.Prev;
+  } else {
+    timerSlot.Tail = node.Prev;
+  }
+
+  if (timerSlot.Head == InvalidIndex) {
+    m_occupiedSlots[node.Slot / SlotCount] &= ~(uint64_t{1} << (node.Slot % SlotCount));
+  }
+
+  node.Slot = InvalidIndex;
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <winrt/Windows.Foundation.h>
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+typedef winrt::Windows::Foundation::DateTime TDateTime;
+typedef winrt::Windows::Foundation::TimeSpan TTimeSpan;
+
+struct Timer {
+  Timer(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
+    Id = id;
+    TargetTime = targetTime;
+    Period = period;
+    Repeat = repeat;
+  }
+
+  uint32_t Id;
+  TDateTime TargetTime;
+  TTimeSpan Period;
+  bool Repeat;
+};
+
+// Hierarchical timer wheel with millisecond resolution.
+//
+// The wheel has LevelCount levels with SlotCount slots each. A timer is stored at the level of the highest
+// slot digit where its due tick differs from the current tick, so Push and Remove are O(1).
+// PopExpired moves the current tick forward by visiting only the occupied slots: the timers from an upper
+// level slot are cascaded to the lower levels and the timers that are due are returned in one batch.
+class TimerQueue {
+ public:
+  TimerQueue();
+
+  void Push(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat);
+  void Remove(uint32_t id);
+
+  // Removes timers with TargetTime before the now time and appends them to expiredTimers ordered by their
+  // TargetTime. Timers with the same TargetTime keep the order in which they were pushed.
+  void PopExpired(TDateTime now, std::vector<Timer> &expiredTimers);
+
+  // The time when the next timer may expire. It is never later than the expiration of any timer in the queue,
+  // but it can be earlier for timers that are not cascaded yet to the lowest level.
+  // For timers pushed with TargetTime in the past it is the time of the last PopExpired call.
+  TDateTime NextTargetTime() const;
+
+  bool IsEmpty() const;
+  size_t Size() const;
+
+ private:
+  static constexpr uint32_t SlotBits = 6;
+  static constexpr uint32_t SlotCount = 1u << SlotBits;
+  static constexpr uint32_t LevelCount = (64 + SlotBits - 1) / SlotBits; // Levels cover all 64-bit ticks.
+  static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+  struct TimerNode {
+    TimerNode(Timer const &value, uint64_t dueTick) : Value{value}, DueTick{dueTick} {}
+
+    Timer Value;
+    uint64_t DueTick;
+    uint32_t Slot{InvalidIndex};
+    uint32_t Prev{InvalidIndex};
+    uint32_t Next{InvalidIndex};
+  };
+
+  struct TimerSlot {
+    uint32_t Head{InvalidIndex};
+    uint32_t Tail{InvalidIndex};
+  };
+
+  static uint64_t ToTick(TDateTime time);
+  static uint64_t ToDueTick(TDateTime targetTime);
+
+  bool TryGetNextSlot(uint32_t &level, uint32_t &slot, uint64_t &slotTick) const;
+  uint32_t AllocateNode(Timer const &timer, uint64_t dueTick);
+  void FreeNode(uint32_t index);
+  void LinkNode(uint32_t index);
+  void UnlinkNode(uint32_t index);
+
+ private:
+  std::vector<TimerNode> m_nodes;
+  std::vector<uint32_t> m_freeNodes;
+  std::unordered_map<uint32_t, uint32_t> m_nodeIndexById;
+  std::array<TimerSlot, LevelCount * SlotCount> m_slots;
+  std::array<uint64_t, LevelCount> m_occupiedSlots{};
+  uint64_t m_currentTick{0};
+};
+
+} // namespace Microsoft::ReactNative
@@ -35,43 +35,6 @@ winrt::Windows::Foundation::TimeSpan TimeSpanFromMs(double ms) {
   return dur;
 }
 
-//
-// TimerQueue
-//
-
-TimerQueue::TimerQueue() {
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Push(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
-  m_timerVector.emplace_back(id, targetTime, period, repeat);
-  std::push_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Pop() {
-  std::pop_heap(m_timerVector.begin(), m_timerVector.end());
-  m_timerVector.pop_back();
-}
-
-Timer &TimerQueue::Front() {
-  return m_timerVector.front();
-}
-
-void TimerQueue::Remove(uint32_t id) {
-  // TODO: This is very inefficient, but doing this with a heap is inherently
-  // hard. If performance is not good
-  //	enough for the scenarios then a different structure is probably needed.
-  auto found = std::find(m_timerVector.begin(), m_timerVector.end(), id);
-  if (found != m_timerVector.end())
-    m_timerVector.erase(found);
-
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-bool TimerQueue::IsEmpty() {
-  return m_timerVector.empty();
-}
-
 std::unique_ptr<TimerRegistry> TimerRegistry::CreateTimerRegistry(
     const winrt::Microsoft::ReactNative::IReactPropertyBag &properties) noexcept {
   auto registry = std::make_unique<TimerRegistry>();
@@ -146,11 +109,13 @@ void Timing::OnTick() {
   vector<uint32_t> readyTimers;
   auto now = TDateTime::clock::now();
 
+  // Pop all expired timers from the queue at once and add them to list of timers ready to fire
+  m_expiredTimers.clear();
+  m_timerQueue.PopExpired(now, m_expiredTimers);
+  readyTimers.reserve(m_expiredTimers.size());
+
   auto emittedAnimationFrame = false;
-  while (!m_timerQueue.IsEmpty() && m_timerQueue.Front().TargetTime < now) {
-    // Pop first timer from the queue and add it to list of timers ready to fire
-    Timer next = m_timerQueue.Front();
-    m_timerQueue.Pop();
+  for (const auto &next : m_expiredTimers) {
     readyTimers.push_back(next.Id);
 
     // If timer is repeating push it back onto the queue for the next repetition
@@ -233,11 +198,11 @@ void Timing::StartRendering() {
 }
 
 void Timing::StartDispatcherTimer() {
-  const auto &nextTimer = m_timerQueue.Front();
+  auto nextTargetTime = m_timerQueue.NextTargetTime();
   m_rendering.revoke();
   m_usingRendering = false;
   auto timer = EnsureDispatcherTimer();
-  timer.Interval(std::max(nextTimer.TargetTime - TDateTime::clock::now(), TTimeSpan::zero()));
+  timer.Interval(std::max(nextTargetTime - TDateTime::clock::now(), TTimeSpan::zero()));
   timer.Start();
 }
 
@@ -267,11 +232,13 @@ void Timing::createTimerOnQueue(uint32_t id, double duration, double jsSchedulin
   const int64_t msFrom1601to1970 = 11644473600000;
   TDateTime scheduledTime(TimeSpanFromMs(jsSchedulingTime + msFrom1601to1970));
   auto initialTargetTime = scheduledTime + period;
+  auto previousTargetTime = m_timerQueue.NextTargetTime();
   m_timerQueue.Push(id, initialTargetTime, period, repeat);
   if (!m_usingRendering) {
     if (IsAnimationFrameRequest(period, repeat)) {
       StartRendering();
-    } else if (initialTargetTime <= m_timerQueue.Front().TargetTime) {
+    } else if (m_timerQueue.NextTargetTime() < previousTargetTime) {
+      // The new timer may expire before the one the dispatcher timer is waiting for.
       StartDispatcherTimer();
     }
   }
@@ -9,52 +9,13 @@
 #include <ReactCoreInjection.h>
 #include <react/runtime/PlatformTimerRegistry.h>
 #include <react/runtime/TimerManager.h>
+#include "TimerQueue.h"
 
 namespace Microsoft::ReactNative {
 
-typedef winrt::Windows::Foundation::DateTime TDateTime;
-typedef winrt::Windows::Foundation::TimeSpan TTimeSpan;
-
 class TimingModule;
 struct Timing;
 
-struct Timer {
-  Timer(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
-    Id = id;
-    TargetTime = targetTime;
-    Period = period;
-    Repeat = repeat;
-  }
-
-  bool operator<(const Timer &timer) const {
-    return timer.TargetTime < TargetTime;
-  }
-
-  bool operator==(uint32_t id) const {
-    return id == Id;
-  }
-
-  uint32_t Id;
-  TDateTime TargetTime;
-  TTimeSpan Period;
-  bool Repeat;
-};
-
-class TimerQueue {
- public:
-  TimerQueue();
-
-  void Push(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat);
-  void Pop();
-  Timer &Front();
-  void Remove(uint32_t id);
-
-  bool IsEmpty();
-
- private:
-  std::vector<Timer> m_timerVector;
-};
-
 struct TimerRegistry : public facebook::react::PlatformTimerRegistry {
   static std::unique_ptr<TimerRegistry> CreateTimerRegistry(
       const winrt::Microsoft::ReactNative::IReactPropertyBag &properties) noexcept;
@@ -111,6 +72,7 @@ struct Timing : public std::enable_shared_from_this<Timing> {
   TimerRegistry *m_timerRegistry{nullptr}; // bridgeless
   winrt::Microsoft::ReactNative::IReactPropertyBag m_properties{nullptr};
   TimerQueue m_timerQueue;
+  std::vector<Timer> m_expiredTimers; // Reused by OnTick to avoid allocations.
   xaml::Media::CompositionTarget::Rendering_revoker m_rendering;
   winrt::Microsoft::ReactNative::ITimer m_dispatcherQueueTimer{nullptr};
   winrt::weak_ref<winrt::Microsoft::ReactNative::IReactDispatcher> m_uiDispatcher;
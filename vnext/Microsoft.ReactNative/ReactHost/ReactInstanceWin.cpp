@@ -44,6 +44,7 @@
 #include "Modules/SourceCode.h"
 #include "Modules/StatusBarManager.h"
 #include "Modules/Timing.h"
+#include "ModuleConstantsSnapshot.h"
 #include "MoveOnCopy.h"
 #include "MsoUtils.h"
 #include "NativeModules.h"
@@ -582,7 +583,7 @@ std::unique_ptr<facebook::jsi::PreparedScriptStore> CreatePreparedScriptStore()
   std::unique_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore = nullptr;
   wchar_t tempPath[MAX_PATH];
   if (GetTempPathW(static_cast<DWORD>(std::size(tempPath)), tempPath)) {
-    preparedScriptStore = std::make_unique<facebook::react::BasePreparedScriptStoreImpl>(winrt::to_string(tempPath));
+    preparedScriptStore = std::make_unique<facebook::react::LruPreparedScriptStore>(winrt::to_string(tempPath));
   }
   return preparedScriptStore;
 }
@@ -693,6 +694,7 @@ void ReactInstanceWin::InitializeBridgeless() noexcept {
 
             m_options.TurboModuleProvider->SetReactContext(
                 winrt::make<implementation::ReactContext>(Mso::Copy(m_reactContext)));
+            m_options.TurboModuleProvider->WarmUp(JavaScriptBundleFile());
 
             facebook::react::ReactInstance::JSRuntimeFlags options;
             m_bridgelessReactInstance->initializeRuntime(
@@ -895,6 +897,7 @@ void ReactInstanceWin::InitializeWithBridge() noexcept {
             // We need to keep the instance wrapper alive as its destruction shuts down the native queue.
             m_options.TurboModuleProvider->SetReactContext(
                 winrt::make<implementation::ReactContext>(Mso::Copy(m_reactContext)));
+            m_options.TurboModuleProvider->WarmUp(JavaScriptBundleFile());
 
             auto bundleRootPath = devSettings->bundleRootPath;
             auto jsiRuntimeHolder = devSettings->jsiRuntimeHolder;
@@ -1053,6 +1056,11 @@ void ReactInstanceWin::OnReactInstanceLoaded(const Mso::ErrorCode &errorCode) no
       m_state = ReactInstanceState::Loaded;
       m_whenLoaded.SetValue();
       DrainJSCallQueue();
+      // Stable modules provide their constants while the bundle loads.
+      Mso::DispatchQueue::ConcurrentQueue().Post([]() noexcept { SaveModuleConstantsSnapshot(); });
+      if (m_options.TurboModuleProvider) {
+        m_options.TurboModuleProvider->SaveUsage();
+      }
     } else {
       m_state = ReactInstanceState::HasError;
       m_whenLoaded.SetError(errorCode);
@@ -0,0 +1,243 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace winrt::Microsoft::ReactNative {
+
+// How a TurboModule was used by an instance.
+struct TurboModuleUsage {
+  std::string ModuleName;
+  // The time taken by the module provider, which constructs the module and runs its REACT_INIT methods.
+  std::chrono::microseconds CreationTime{0};
+  // Whether the module was created ahead of its first use, off the JS thread.
+  bool WarmedUp{false};
+  uint64_t CallCount{0};
+};
+
+// Records the creation time and call count of each TurboModule of an instance, and derives from the usage of a
+// previous run the modules worth creating before JS asks for them.
+//
+//   log := "RNWTurboModuleUsage1\n" (name "\t" calls "\n")*
+class TurboModuleUsageLog final {
+ public:
+  // The counter that the members of a module increment on each call.
+  std::shared_ptr<std::atomic<uint64_t>> CallCounter(const std::string &moduleName) noexcept {
+    std::scoped_lock lock{m_mutex};
+    return Find(moduleName).CallCount;
+  }
+
+  void RecordCreation(const std::string &moduleName, std::chrono::microseconds creationTime, bool warmedUp) noexcept {
+    std::scoped_lock lock{m_mutex};
+    auto &entry = Find(moduleName);
+    entry.Usage.CreationTime = creationTime;
+    entry.Usage.WarmedUp = warmedUp;
+  }
+
+  // The usage of each module, in the order the modules were first created or called.
+  std::vector<TurboModuleUsage> Usage() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    std::vector<TurboModuleUsage> usage;
+    usage.reserve(m_entries.size());
+    for (const auto &entry : m_entries) {
+      usage.push_back(entry.Usage);
+      usage.back().CallCount = entry.CallCount->load(std::memory_order_relaxed);
+    }
+    return usage;
+  }
+
+  // Serializes the modules that were called, in the order they were first created.
+  std::string Serialize() const noexcept {
+    std::string content{Magic};
+    content.append("\n");
+    for (const auto &usage : Usage()) {
+      if (usage.CallCount > 0 && usage.ModuleName.find_first_of("\t\n") == std::string::npos) {
+        content.append(usage.ModuleName).append("\t").append(std::to_string(usage.CallCount)).append("\n");
+      }
+    }
+    return content;
+  }
+
+  // The first maxCount modules of a serialized log, skipping lines that are malformed. Modules are created in this
+  // order, so the modules JS needs first are ready first.
+  static std::vector<std::string> WarmUpList(std::string_view content, size_t maxCount) noexcept {
+    std::vector<std::string> modules;
+    auto end = content.find('\n');
+    if (end == std::string_view::npos || content.substr(0, end) != Magic) {
+      return modules;
+    }
+    content.remove_prefix(end + 1);
+
+    std::unordered_set<std::string_view> seen;
+    while (!content.empty() && modules.size() < maxCount) {
+      end = content.find('\n');
+      auto line = content.substr(0, end);
+      content.remove_prefix(end == std::string_view::npos ? content.size() : end + 1);
+
+      auto tab = line.find('\t');
+      if (tab == 0 || tab == std::string_view::npos || tab + 1 == line.size() ||
+          line.find_first_not_of("0123456789", tab + 1) != std::string_view::npos) {
+        continue;
+      }
+      if (seen.insert(line.substr(0, tab)).second) {
+        modules.emplace_back(line.substr(0, tab));
+      }
+    }
+    return modules;
+  }
+
+ private:
+  static constexpr std::string_view Magic = "RNWTurboModuleUsage1";
+
+  struct Entry {
+    TurboModuleUsage Usage;
+    std::shared_ptr<std::atomic<uint64_t>> CallCount;
+  };
+
+  Entry &Find(const std::string &moduleName) noexcept {
+    for (auto &entry : m_entries) {
+      if (entry.Usage.ModuleName == moduleName) {
+        return entry;
+      }
+    }
+    return m_entries.emplace_back(
+        Entry{TurboModuleUsage{moduleName}, std::make_shared<std::atomic<uint64_t>>(uint64_t{0})});
+  }
+
+  mutable std::mutex m_mutex;
+  // An instance has at most a few hundred modules, each looked up once when created.
+  std::vector<Entry> m_entries;
+};
+
+// The initializers of a module that may only run on the JS thread. While the module is created on another thread, they
+// are kept until the module is handed to JS.
+template <typename TInitializer>
+class JsThreadInitializers final {
+ public:
+  explicit JsThreadInitializers(bool defer) noexcept : m_defer(defer) {}
+
+  template <typename TRun>
+  void Add(TInitializer const &initializer, TRun const &run) noexcept {
+    if (m_defer) {
+      m_deferred.push_back(initializer);
+      return;
+    }
+    run(initializer);
+  }
+
+  // Runs the deferred initializers, and the ones added later as they are added. Called on the JS thread.
+  template <typename TRun>
+  void RunDeferred(TRun const &run) noexcept {
+    m_defer = false;
+    for (auto const &initializer : std::exchange(m_deferred, {})) {
+      run(initializer);
+    }
+  }
+
+ private:
+  bool m_defer;
+  std::vector<TInitializer> m_deferred;
+};
+
+// Creates modules on a thread of its own, in the order they are given, before JS asks for them. Destroying it drops
+// the modules still queued and waits for the module being created.
+template <typename TModuleProvider, typename TPreparedModule>
+class TurboModuleWarmUp {
+ public:
+  using CreateModule = std::function<TPreparedModule(const std::string &, const TModuleProvider &)>;
+
+  TurboModuleWarmUp(std::vector<std::pair<std::string, TModuleProvider>> modules, CreateModule createModule) noexcept
+      : m_pending(std::make_move_iterator(modules.begin()), std::make_move_iterator(modules.end())),
+        m_createModule(std::move(createModule)) {
+    if (!m_pending.empty()) {
+      m_thread = std::thread([this]() noexcept { Run(); });
+    }
+  }
+
+  ~TurboModuleWarmUp() noexcept {
+    {
+      std::scoped_lock lock{m_mutex};
+      m_pending.clear();
+    }
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+  }
+
+  TurboModuleWarmUp(const TurboModuleWarmUp &) = delete;
+  TurboModuleWarmUp &operator=(const TurboModuleWarmUp &) = delete;
+
+  // Takes the module if the warm-up thread created it, waiting if it is creating it. A module still queued is taken
+  // off the queue, for the JS thread to create it rather than wait for the modules queued before it.
+  std::optional<TPreparedModule> Take(const std::string &moduleName) noexcept {
+    std::unique_lock lock{m_mutex};
+    m_pending.erase(
+        std::remove_if(
+            m_pending.begin(),
+            m_pending.end(),
+            [&moduleName](const auto &pending) { return pending.first == moduleName; }),
+        m_pending.end());
+    m_moduleCreated.wait(lock, [&]() { return m_creating != moduleName; });
+
+    auto it = m_created.find(moduleName);
+    if (it == m_created.end()) {
+      return std::nullopt;
+    }
+    auto preparedModule = std::move(it->second);
+    m_created.erase(it);
+    return preparedModule;
+  }
+
+ private:
+  void Run() noexcept {
+    for (;;) {
+      std::pair<std::string, TModuleProvider> pending;
+      {
+        std::scoped_lock lock{m_mutex};
+        if (m_pending.empty()) {
+          return;
+        }
+        pending = std::move(m_pending.front());
+        m_pending.pop_front();
+        m_creating = pending.first;
+      }
+
+      auto preparedModule = m_createModule(pending.first, pending.second);
+
+      {
+        std::scoped_lock lock{m_mutex};
+        m_created.emplace(std::move(pending.first), std::move(preparedModule));
+        m_creating.clear();
+      }
+      m_moduleCreated.notify_all();
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_moduleCreated;
+  std::deque<std::pair<std::string, TModuleProvider>> m_pending;
+  std::string m_creating;
+  std::unordered_map<std::string, TPreparedModule> m_created;
+  const CreateModule m_createModule;
+  std::thread m_thread;
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -7,20 +7,32 @@
 
 #include "pch.h"
 #include "TurboModulesProvider.h"
+#include <CppRuntimeOptions.h>
 #include <IReactContext.h>
+#include <Utils/Helpers.h>
+#include <dispatchQueue/dispatchQueue.h>
 #include <ReactCommon/TurboModuleUtils.h>
 #include <react/bridging/EventEmitter.h>
+#include <JSI/JSIDynamic.h>
+#include <folly/json.h>
 #include "CallInvokerWriter.h"
+#include "DynamicWriter.h"
+#include "JSValueJsiConverter.h"
 #include "JSValueWriter.h"
 #include "JsiApi.h"
 #include "JsiReader.h"
 #include "JsiWriter.h"
+#include "ModuleConstantsSnapshot.h"
 #ifdef __APPLE__
 #include "Crash.h"
 #else
 #include <crash/verifyElseCrash.h>
 #endif
 
+#include <fstream>
+#include <iterator>
+#include <optional>
+
 using namespace winrt;
 using namespace Windows::Foundation;
 
@@ -36,7 +48,8 @@ struct TurboModuleMethodInfo {
 };
 
 struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBuilder> {
-  TurboModuleBuilder(const IReactContext &reactContext) noexcept : m_reactContext(reactContext) {}
+  TurboModuleBuilder(const IReactContext &reactContext, bool deferJsiInitializers = false) noexcept
+      : m_reactContext(reactContext), m_jsiInitializers(deferJsiInitializers) {}
 
  public: // IReactModuleBuilder
   void AddInitializer(InitializerDelegate const &initializer) noexcept {
@@ -44,11 +57,9 @@ struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBu
   }
 
   void AddJsiInitializer(JsiInitializerDelegate const &initializer) noexcept {
-    initializer(
-        m_reactContext,
-        winrt::get_self<winrt::Microsoft::ReactNative::implementation::ReactContext>(m_reactContext)
-            ->GetInner()
-            .JsiRuntime());
+    // The JSI runtime may only be used on the JS thread.
+    m_jsiInitializers.Add(
+        initializer, [this](JsiInitializerDelegate const &jsiInitializer) { RunJsiInitializer(jsiInitializer); });
   }
 
   void AddConstantProvider(ConstantProviderDelegate const &constantProvider) noexcept {
@@ -75,6 +86,12 @@ struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBu
   }
 
  public:
+  // Runs the JSI initializers deferred while the module was created off the JS thread.
+  void RunDeferredJsiInitializers() noexcept {
+    m_jsiInitializers.RunDeferred(
+        [this](JsiInitializerDelegate const &jsiInitializer) { RunJsiInitializer(jsiInitializer); });
+  }
+
   const std::unordered_map<std::string, TurboModuleMethodInfo> &Methods() const noexcept {
     return m_methods;
   }
@@ -92,6 +109,14 @@ struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBu
   }
 
  private:
+  void RunJsiInitializer(JsiInitializerDelegate const &initializer) noexcept {
+    initializer(
+        m_reactContext,
+        winrt::get_self<winrt::Microsoft::ReactNative::implementation::ReactContext>(m_reactContext)
+            ->GetInner()
+            .JsiRuntime());
+  }
+
   void EnsureMemberNotSet(const std::string &key, bool checkingMethod) noexcept {
     VerifyElseCrash(m_methods.find(key) == m_methods.end());
     VerifyElseCrash(m_syncMethods.find(key) == m_syncMethods.end());
@@ -103,6 +128,7 @@ struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBu
 
  private:
   IReactContext m_reactContext;
+  JsThreadInitializers<JsiInitializerDelegate> m_jsiInitializers;
   std::unordered_map<std::string, EventEmitterInitializerDelegate> m_eventEmitters;
   std::unordered_map<std::string, TurboModuleMethodInfo> m_methods;
   std::unordered_map<std::string, SyncMethodDelegate> m_syncMethods;
@@ -110,6 +136,21 @@ struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBu
   bool m_constantsEvaluated{false};
 };
 
+// A module created by its provider, before it is handed to JS.
+struct PreparedTurboModule {
+  winrt::com_ptr<TurboModuleBuilder> ModuleBuilder;
+  IInspectable ProvidedModule;
+
+  static PreparedTurboModule Create(
+      const IReactContext &reactContext,
+      const ReactModuleProvider &reactModuleProvider,
+      bool deferJsiInitializers) noexcept {
+    auto moduleBuilder = winrt::make_self<TurboModuleBuilder>(reactContext, deferJsiInitializers);
+    auto providedModule = reactModuleProvider(moduleBuilder.as<IReactModuleBuilder>());
+    return {std::move(moduleBuilder), std::move(providedModule)};
+  }
+};
+
 /*-------------------------------------------------------------------------------
   TurboModuleImpl
 -------------------------------------------------------------------------------*/
@@ -121,12 +162,16 @@ class TurboModuleImpl : public facebook::react::TurboModule {
       const std::string &name,
       const std::shared_ptr<facebook::react::CallInvoker> &jsInvoker,
       std::weak_ptr<facebook::react::LongLivedObjectCollection> longLivedObjectCollection,
-      const ReactModuleProvider &reactModuleProvider)
+      PreparedTurboModule &&preparedModule,
+      std::shared_ptr<std::atomic<uint64_t>> callCount)
       : facebook::react::TurboModule(name, jsInvoker),
         m_reactContext(reactContext),
         m_longLivedObjectCollection(std::move(longLivedObjectCollection)),
-        m_moduleBuilder(winrt::make_self<TurboModuleBuilder>(reactContext)),
-        m_providedModule(reactModuleProvider(m_moduleBuilder.as<IReactModuleBuilder>())) {
+        m_moduleBuilder(std::move(preparedModule.ModuleBuilder)),
+        m_providedModule(std::move(preparedModule.ProvidedModule)),
+        m_callCount(std::move(callCount)) {
+    m_moduleBuilder->RunDeferredJsiInitializers();
+
     if (auto hostObject = m_providedModule.try_as<IJsiHostObject>()) {
       // Force ABI runtime creation if it hasn't already been created
       winrt::get_self<winrt::Microsoft::ReactNative::implementation::ReactContext>(m_reactContext)
@@ -175,19 +220,60 @@ class TurboModuleImpl : public facebook::react::TurboModule {
           runtime,
           propName,
           0,
-          [moduleBuilder = m_moduleBuilder](
+          [moduleBuilder = m_moduleBuilder, moduleName = name_, callCount = m_callCount](
               facebook::jsi::Runtime &rt,
               const facebook::jsi::Value & /*thisVal*/,
               const facebook::jsi::Value * /*args*/,
               size_t /*count*/) {
-            // collect all constants to an object
-            auto writer = winrt::make<JsiWriter>(rt);
+            callCount->fetch_add(1, std::memory_order_relaxed);
+            auto &snapshot = GetModuleConstantsSnapshot();
+            auto start = std::chrono::steady_clock::now();
+            auto recordTiming = [&](bool fromSnapshot) {
+              snapshot.RecordTiming(
+                  moduleName,
+                  std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start),
+                  fromSnapshot);
+            };
+
+            if (!snapshot.IsStable(moduleName)) {
+              // collect all constants to an object
+              auto writer = winrt::make<JsiWriter>(rt);
+              writer.WriteObjectBegin();
+              for (auto const &constantProvider : moduleBuilder->ConstantProviders()) {
+                constantProvider(writer);
+              }
+              writer.WriteObjectEnd();
+              auto result = writer.as<JsiWriter>()->MoveResult();
+              recordTiming(false);
+              return result;
+            }
+
+            // The constants of a stable module are parsed from the snapshot instead of calling its constant providers.
+            if (auto json = snapshot.TryGet(moduleName)) {
+              try {
+                auto result = rt.global()
+                                  .getPropertyAsObject(rt, "JSON")
+                                  .getPropertyAsFunction(rt, "parse")
+                                  .call(rt, facebook::jsi::String::createFromUtf8(rt, *json));
+                recordTiming(true);
+                return result;
+              } catch (const facebook::jsi::JSError &) {
+                // Fall back to the constant providers, which also replaces the snapshot entry.
+              }
+            }
+
+            auto writer = winrt::make<DynamicWriter>();
             writer.WriteObjectBegin();
             for (auto const &constantProvider : moduleBuilder->ConstantProviders()) {
               constantProvider(writer);
             }
             writer.WriteObjectEnd();
-            return writer.as<JsiWriter>()->MoveResult();
+            auto constants = writer.as<DynamicWriter>()->TakeValue();
+            auto result = facebook::jsi::valueFromDynamic(rt, constants);
+            recordTiming(false);
+
+            RecordModuleConstants(moduleName, constants);
+            return result;
           });
     }
 
@@ -202,11 +288,12 @@ class TurboModuleImpl : public facebook::react::TurboModule {
                 runtime,
                 propName,
                 0,
-                [method = methodInfo.Method](
+                [method = methodInfo.Method, callCount = m_callCount](
                     facebook::jsi::Runtime &rt,
                     const facebook::jsi::Value & /*thisVal*/,
                     const facebook::jsi::Value *args,
                     size_t argCount) {
+                  callCount->fetch_add(1, std::memory_order_relaxed);
                   method(winrt::make<JsiReader>(rt, args, argCount), nullptr, nullptr, nullptr);
                   return facebook::jsi::Value::undefined();
                 });
@@ -217,11 +304,13 @@ class TurboModuleImpl : public facebook::react::TurboModule {
                 0,
                 [jsInvoker = jsInvoker_,
                  method = methodInfo.Method,
-                 longLivedObjectCollection = m_longLivedObjectCollection](
+                 longLivedObjectCollection = m_longLivedObjectCollection,
+                 callCount = m_callCount](
                     facebook::jsi::Runtime &rt,
                     const facebook::jsi::Value & /*thisVal*/,
                     const facebook::jsi::Value *args,
                     size_t argCount) {
+                  callCount->fetch_add(1, std::memory_order_relaxed);
                   VerifyElseCrash(argCount > 0);
                   if (auto strongLongLivedObjectCollection = longLivedObjectCollection.lock()) {
                     auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedObjectCollection, rt);
@@ -242,11 +331,13 @@ class TurboModuleImpl : public facebook::react::TurboModule {
                 0,
                 [jsInvoker = jsInvoker_,
                  method = methodInfo.Method,
-                 longLivedObjectCollection = m_longLivedObjectCollection](
+                 longLivedObjectCollection = m_longLivedObjectCollection,
+                 callCount = m_callCount](
                     facebook::jsi::Runtime &rt,
                     const facebook::jsi::Value & /*thisVal*/,
                     const facebook::jsi::Value *args,
                     size_t argCount) {
+                  callCount->fetch_add(1, std::memory_order_relaxed);
                   VerifyElseCrash(argCount > 1);
                   if (auto strongLongLivedObjectCollection = longLivedObjectCollection.lock()) {
                     auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedObjectCollection, rt);
@@ -302,11 +393,13 @@ class TurboModuleImpl : public facebook::react::TurboModule {
                 0,
                 [jsInvoker = jsInvoker_,
                  method = methodInfo.Method,
-                 longLivedObjectCollection = m_longLivedObjectCollection](
+                 longLivedObjectCollection = m_longLivedObjectCollection,
+                 callCount = m_callCount](
                     facebook::jsi::Runtime &rt,
                     const facebook::jsi::Value & /*thisVal*/,
                     const facebook::jsi::Value *args,
                     size_t count) {
+                  callCount->fetch_add(1, std::memory_order_relaxed);
                   if (auto strongLongLivedObjectCollection = longLivedObjectCollection.lock()) {
                     auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedObjectCollection, rt);
                     auto argReader = winrt::make<JsiReader>(rt, args, count);
@@ -392,11 +485,12 @@ class TurboModuleImpl : public facebook::react::TurboModule {
             runtime,
             propName,
             0,
-            [method = it->second](
+            [method = it->second, callCount = m_callCount](
                 facebook::jsi::Runtime &rt,
                 const facebook::jsi::Value &thisVal,
                 const facebook::jsi::Value *args,
                 size_t count) {
+              callCount->fetch_add(1, std::memory_order_relaxed);
               auto argReader = winrt::make<JsiReader>(rt, args, count);
               auto argWriter = winrt::make<JsiWriter>(rt);
               method(argReader, argWriter);
@@ -424,9 +518,7 @@ class TurboModuleImpl : public facebook::react::TurboModule {
             emitter->emit(
                 [jsInvoker, eventDelegate, jsValue = std::make_shared<JSValue>(TakeJSValue(argWriter))](
                     facebook::jsi::Runtime &rt) -> facebook::jsi::Value {
-                  auto argWriter = winrt::make<JsiWriter>(rt);
-                  WriteValue(argWriter, *jsValue);
-                  return argWriter.as<JsiWriter>()->MoveResult();
+                  return JsiValueFromJSValue(rt, *jsValue);
                 });
           });
         }
@@ -473,12 +565,24 @@ class TurboModuleImpl : public facebook::react::TurboModule {
   std::unordered_map<std::string, std::shared_ptr<facebook::react::IAsyncEventEmitter>> m_eventEmitters;
   std::shared_ptr<implementation::HostObjectWrapper> m_hostObjectWrapper;
   std::weak_ptr<facebook::react::LongLivedObjectCollection> m_longLivedObjectCollection;
+  std::shared_ptr<std::atomic<uint64_t>> m_callCount;
 };
 
 /*-------------------------------------------------------------------------------
   TurboModulesProvider
 -------------------------------------------------------------------------------*/
 
+// The most modules created ahead of their first use. Usage logs list the modules in the order they were first
+// created, so these are the modules the app needs first.
+constexpr size_t MaxWarmUpModules = 32;
+
+// Creates on its own thread the modules that the previous run called first.
+struct TurboModulesProvider::WarmUpState final : TurboModuleWarmUp<ReactModuleProvider, PreparedTurboModule> {
+  using TurboModuleWarmUp::TurboModuleWarmUp;
+};
+
+TurboModulesProvider::~TurboModulesProvider() noexcept = default;
+
 std::shared_ptr<facebook::react::TurboModule> TurboModulesProvider::getModule(
     const std::string &moduleName,
     const std::shared_ptr<facebook::react::CallInvoker> &callInvoker) noexcept {
@@ -488,8 +592,23 @@ std::shared_ptr<facebook::react::TurboModule> TurboModulesProvider::getModule(
     return nullptr;
   }
 
+  auto preparedModule = m_warmUp ? m_warmUp->Take(moduleName) : std::nullopt;
+  if (!preparedModule) {
+    auto start = std::chrono::steady_clock::now();
+    preparedModule = PreparedTurboModule::Create(m_reactContext, it->second, /*deferJsiInitializers*/ false);
+    m_usageLog->RecordCreation(
+        moduleName,
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start),
+        /*warmedUp*/ false);
+  }
+
   auto tm = std::make_shared<TurboModuleImpl>(
-      m_reactContext, moduleName, callInvoker, m_longLivedObjectCollection, /*reactModuleProvider*/ it->second);
+      m_reactContext,
+      moduleName,
+      callInvoker,
+      m_longLivedObjectCollection,
+      std::move(*preparedModule),
+      m_usageLog->CallCounter(moduleName));
   return tm;
 }
 
@@ -524,6 +643,52 @@ void TurboModulesProvider::AddModuleProvider(
   }
 }
 
+void TurboModulesProvider::WarmUp(std::string_view bundleName) noexcept {
+  if (m_warmUp || !::Microsoft::React::GetRuntimeOptionBool("TurboModules.WarmUp")) {
+    return;
+  }
+
+  m_usageLogPath = ::Microsoft::ReactNative::AppTempFilePath(L"rnw_turbo_module_usage", L".log", bundleName);
+  std::vector<std::pair<std::string, ReactModuleProvider>> modules;
+  if (std::ifstream file{m_usageLogPath, std::ios::binary}) {
+    std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    for (auto &moduleName : TurboModuleUsageLog::WarmUpList(content, MaxWarmUpModules)) {
+      auto it = m_moduleProviders.find(moduleName);
+      if (it != m_moduleProviders.end()) {
+        modules.emplace_back(std::move(moduleName), it->second);
+      }
+    }
+  }
+
+  m_warmUp = std::make_unique<WarmUpState>(
+      std::move(modules),
+      [reactContext = m_reactContext, usageLog = m_usageLog](
+          const std::string &moduleName, const ReactModuleProvider &moduleProvider) noexcept {
+        auto start = std::chrono::steady_clock::now();
+        auto preparedModule = PreparedTurboModule::Create(reactContext, moduleProvider, /*deferJsiInitializers*/ true);
+        usageLog->RecordCreation(
+            moduleName,
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start),
+            /*warmedUp*/ true);
+        return preparedModule;
+      });
+}
+
+void TurboModulesProvider::SaveUsage() noexcept {
+  if (m_usageLogPath.empty()) {
+    return;
+  }
+
+  Mso::DispatchQueue::ConcurrentQueue().Post([path = m_usageLogPath, usageLog = m_usageLog]() noexcept {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << usageLog->Serialize();
+  });
+}
+
+std::vector<TurboModuleUsage> TurboModulesProvider::Usage() const noexcept {
+  return m_usageLog->Usage();
+}
+
 std::shared_ptr<facebook::react::LongLivedObjectCollection> const &
 TurboModulesProvider::LongLivedObjectCollection() noexcept {
   return m_longLivedObjectCollection;
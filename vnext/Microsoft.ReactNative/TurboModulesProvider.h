@@ -9,6 +9,7 @@
 #include <ReactCommon/LongLivedObject.h>
 #include <TurboModuleRegistry.h>
 #include "Base/FollyIncludes.h"
+#include "TurboModuleUsage.h"
 #include "winrt/Microsoft.ReactNative.h"
 
 namespace winrt::Microsoft::ReactNative {
@@ -21,7 +22,22 @@ class TurboModulesProvider final : public facebook::react::TurboModuleRegistry {
   std::vector<std::string> getEagerInitModuleNames() noexcept override;
 
  public:
+  ~TurboModulesProvider() noexcept;
+
   void SetReactContext(const IReactContext &reactContext) noexcept;
+
+  // When the "TurboModules.WarmUp" runtime option is set, creates on a background thread the modules that the previous
+  // run of the bundle called, so that they are ready when JS first asks for them. JSI initializers of these modules
+  // still run on the JS thread, when the module is handed to JS. Must be called after SetReactContext.
+  void WarmUp(std::string_view bundleName) noexcept;
+
+  // Writes the modules called so far to the usage log of the bundle on a background queue, for the next run to warm
+  // them up. Does nothing unless WarmUp was enabled.
+  void SaveUsage() noexcept;
+
+  // The creation time and call count of the modules created so far.
+  std::vector<TurboModuleUsage> Usage() const noexcept;
+
   void AddModuleProvider(
       winrt::hstring const &moduleName,
       ReactModuleProvider const &moduleProvider,
@@ -29,11 +45,16 @@ class TurboModulesProvider final : public facebook::react::TurboModuleRegistry {
   std::shared_ptr<facebook::react::LongLivedObjectCollection> const &LongLivedObjectCollection() noexcept;
 
  private:
+  struct WarmUpState;
+
   // To keep a list of deferred asynchronous callbacks and promises.
   std::shared_ptr<facebook::react::LongLivedObjectCollection> m_longLivedObjectCollection{
       std::make_shared<facebook::react::LongLivedObjectCollection>()};
   std::unordered_map<std::string, ReactModuleProvider> m_moduleProviders;
   IReactContext m_reactContext;
+  std::shared_ptr<TurboModuleUsageLog> m_usageLog{std::make_shared<TurboModuleUsageLog>()};
+  std::wstring m_usageLogPath;
+  std::unique_ptr<WarmUpState> m_warmUp;
 };
 
 } // namespace winrt::Microsoft::ReactNative
@@ -8,6 +8,7 @@
 
 #include <appmodel.h>
 #include <processthreadsapi.h>
+#include <functional>
 
 #ifdef USE_FABRIC
 #include <Fabric/Composition/CompositionUIService.h>
@@ -98,4 +99,22 @@ bool IsFabricEnabled(winrt::Microsoft::ReactNative::IReactPropertyBag const &pro
 #endif
 }
 
+std::wstring AppTempFilePath(std::wstring_view prefix, std::wstring_view extension, std::string_view key) noexcept {
+  wchar_t tempPath[MAX_PATH];
+  wchar_t executablePath[MAX_PATH];
+  auto length = GetModuleFileNameW(nullptr, executablePath, static_cast<DWORD>(std::size(executablePath)));
+  if (!GetTempPathW(static_cast<DWORD>(std::size(tempPath)), tempPath) || length == 0 ||
+      length >= std::size(executablePath)) {
+    return {};
+  }
+
+  std::wstring_view executable{executablePath, length};
+  std::wstring identity{executable};
+  identity.append(L"|").append(key.begin(), key.end());
+
+  std::wstring path{tempPath};
+  path.append(prefix).append(L".").append(executable.substr(executable.find_last_of(L"\\/") + 1)).append(L".");
+  return path.append(std::to_wstring(std::hash<std::wstring>{}(identity))).append(extension);
+}
+
 } // namespace Microsoft::ReactNative
@@ -7,6 +7,8 @@
 #include <JSValue.h>
 #include <React.h>
 #include <stdint.h>
+#include <string>
+#include <string_view>
 
 namespace Microsoft::ReactNative {
 
@@ -27,4 +29,9 @@ bool IsXamlIsland();
 bool IsWinUI3Island();
 bool IsFabricEnabled(winrt::Microsoft::ReactNative::IReactPropertyBag const &properties);
 
+// The path of a file in the temp folder for the app and `key`. Apps that are not packaged share the temp folder, so the
+// file name includes the name of the app's executable and a hash of its path and `key`. Empty if there is no temp
+// folder.
+std::wstring AppTempFilePath(std::wstring_view prefix, std::wstring_view extension, std::string_view key = {}) noexcept;
+
 } // namespace Microsoft::ReactNative
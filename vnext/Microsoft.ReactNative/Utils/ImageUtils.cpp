@@ -5,11 +5,13 @@
 #include "ImageUtils.h"
 
 #include <CppRuntimeOptions.h>
+#include <Networking/CachingHttpFilter.h>
 #include <Networking/NetworkPropertyIds.h>
 #include <Shared/cdebug.h>
 #include <Utils/CppWinrtLessExceptions.h>
+#include <Utils/WinRTConversions.h>
 #include <windows.Web.Http.h>
-#include <winrt/Windows.Security.Cryptography.h>
+#include <winrt/Windows.Web.Http.Filters.h>
 #include <winrt/Windows.Web.Http.Headers.h>
 #include <winrt/Windows.Web.Http.h>
 
@@ -94,7 +96,8 @@ winrt::IAsyncOperation<winrt::IRandomAccessStream> GetImageStreamAsync(
       }
     }
 
-    winrt::HttpClient httpClient;
+    winrt::HttpClient httpClient{Microsoft::React::Networking::MakeCachingHttpFilter(
+        winrt::Windows::Web::Http::Filters::HttpBaseProtocolFilter())};
     auto httpClientAbi = reinterpret_cast<ABI::Windows::Web::Http::IHttpClient *>(winrt::get_abi(httpClient));
 
     winrt::Windows::Foundation::IAsyncOperationWithProgress<
@@ -163,8 +166,11 @@ winrt::IAsyncOperation<winrt::IRandomAccessStream> GetImageInlineDataAsync(React
     co_await winrt::resume_background();
 
     std::string_view base64String(source.uri.c_str() + start + 1, source.uri.length() - start - 1);
-    auto buffer = winrt::Windows::Security::Cryptography::CryptographicBuffer::DecodeFromBase64String(
-        winrt::to_hstring(base64String));
+    auto buffer = Microsoft::React::Utilities::DecodeBase64ToBuffer(base64String);
+    if (!buffer) {
+      // Base64 decode failed
+      co_return nullptr;
+    }
 
     winrt::InMemoryRandomAccessStream memoryStream;
     co_await memoryStream.WriteAsync(buffer);
@@ -172,7 +178,6 @@ winrt::IAsyncOperation<winrt::IRandomAccessStream> GetImageInlineDataAsync(React
 
     co_return memoryStream;
   } catch (winrt::hresult_error const &) {
-    // Base64 decode failed
   }
 
   co_return nullptr;
@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+#include "eventWaitHandle/eventWaitHandle.h"
+#include "motifCpp/testCheck.h"
+
+namespace DispatchQueueTests {
+
+TEST_CLASS (TaskQueueTest) {
+  TEST_METHOD(TaskQueue_MultipleProducers_KeepPerProducerOrder) {
+    constexpr int32_t producerCount = 8;
+    constexpr int32_t taskCount = 10000;
+    std::vector<int32_t> lastValues(producerCount, -1);
+    std::atomic<int32_t> callCount{0};
+    bool isOrdered{true};
+    Mso::ManualResetEvent finished;
+
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    std::vector<std::thread> producers;
+    for (int32_t producer = 0; producer < producerCount; ++producer) {
+      producers.emplace_back([&, producer]() noexcept {
+        for (int32_t i = 0; i < taskCount; ++i) {
+          queue.Post([&, producer, i]() noexcept {
+            // Tasks are invoked one at a time by the serial queue.
+            isOrdered = isOrdered && (lastValues[producer] + 1 == i);
+            lastValues[producer] = i;
+            if (++callCount == producerCount * taskCount) {
+              finished.Set();
+            }
+          });
+        }
+      });
+    }
+
+    for (auto &producer : producers) {
+      producer.join();
+    }
+
+    finished.Wait();
+    TestCheck(isOrdered);
+    TestCheckEqual(producerCount * taskCount, callCount.load());
+  }
+
+  TEST_METHOD(TaskQueue_MultipleProducers_ShutdownCancelsRemainingTasks) {
+    constexpr int32_t producerCount = 4;
+    constexpr int32_t taskCount = 10000;
+    std::atomic<int32_t> invokeCount{0};
+    std::atomic<int32_t> cancelCount{0};
+
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    std::vector<std::thread> producers;
+    for (int32_t producer = 0; producer < producerCount; ++producer) {
+      producers.emplace_back([&]() noexcept {
+        for (int32_t i = 0; i < taskCount; ++i) {
+          queue.Post(Mso::MakeDispatchTask([&]() noexcept { ++invokeCount; }, [&]() noexcept { ++cancelCount; }));
+        }
+      });
+    }
+
+    queue.Shutdown(Mso::PendingTaskAction::Cancel);
+    for (auto &producer : producers) {
+      producer.join();
+    }
+
+    queue.AwaitTermination();
+
+    // Each task must be either invoked or canceled: none of them can be lost.
+    TestCheckEqual(producerCount * taskCount, invokeCount.load() + cancelCount.load());
+  }
+
+  TEST_METHOD(TaskQueue_PostWhileSuspended) {
+    constexpr int32_t producerCount = 4;
+    constexpr int32_t taskCount = 1000;
+    std::atomic<int32_t> callCount{0};
+    Mso::ManualResetEvent finished;
+
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    {
+      auto suspendGuard = queue.Suspend();
+      std::vector<std::thread> producers;
+      for (int32_t producer = 0; producer < producerCount; ++producer) {
+        producers.emplace_back([&]() noexcept {
+          for (int32_t i = 0; i < taskCount; ++i) {
+            queue.Post([&]() noexcept {
+              if (++callCount == producerCount * taskCount) {
+                finished.Set();
+              }
+            });
+          }
+        });
+      }
+
+      for (auto &producer : producers) {
+        producer.join();
+      }
+
+      TestCheckEqual(0, callCount.load());
+    }
+
+    finished.Wait();
+    TestCheckEqual(producerCount * taskCount, callCount.load());
+  }
+
+  TEST_METHOD(TaskQueue_PostWhileResuming) {
+    // Tasks posted while the queue resumes must all run, including the ones that producers are still linking
+    // into the queue when the queue counts them.
+    constexpr int32_t producerCount = 4;
+    constexpr int32_t taskCount = 10000;
+    std::atomic<int32_t> callCount{0};
+    Mso::ManualResetEvent finished;
+
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    std::vector<std::thread> producers;
+    for (int32_t producer = 0; producer < producerCount; ++producer) {
+      producers.emplace_back([&]() noexcept {
+        for (int32_t i = 0; i < taskCount; ++i) {
+          queue.Post([&]() noexcept {
+            if (++callCount == producerCount * taskCount) {
+              finished.Set();
+            }
+          });
+        }
+      });
+    }
+
+    for (int32_t i = 0; i < 1000; ++i) {
+      auto suspendGuard = queue.Suspend();
+      std::this_thread::yield();
+    }
+
+    for (auto &producer : producers) {
+      producer.join();
+    }
+
+    TestCheck(finished.WaitFor(std::chrono::seconds{10}));
+    TestCheckEqual(producerCount * taskCount, callCount.load());
+  }
+};
+
+} // namespace DispatchQueueTests
@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+#include "eventWaitHandle/eventWaitHandle.h"
+#include "motifCpp/testCheck.h"
+
+namespace DispatchQueueTests {
+
+TEST_CLASS (WorkStealingSchedulerTest) {
+  TEST_METHOD(WorkStealingScheduler_IsNotSerial) {
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(4);
+    TestCheck(!queue.IsSerial());
+  }
+
+  TEST_METHOD(WorkStealingScheduler_RunsAllTasks) {
+    constexpr int32_t taskCount = 10000;
+    std::atomic<int32_t> callCount{0};
+    Mso::ManualResetEvent finished;
+
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(4);
+    for (int32_t i = 0; i < taskCount; ++i) {
+      queue.Post([&]() noexcept {
+        if (++callCount == taskCount) {
+          finished.Set();
+        }
+      });
+    }
+
+    finished.Wait();
+    TestCheckEqual(taskCount, callCount.load());
+  }
+
+  TEST_METHOD(WorkStealingScheduler_RunsTasksConcurrently) {
+    // Two tasks can only finish if they run at the same time.
+    Mso::ManualResetEvent firstStarted;
+    Mso::ManualResetEvent secondStarted;
+    Mso::ManualResetEvent finished;
+    std::atomic<int32_t> finishCount{0};
+
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(2);
+    queue.Post([&]() noexcept {
+      firstStarted.Set();
+      TestCheck(secondStarted.WaitFor(std::chrono::seconds{10}));
+      if (++finishCount == 2) {
+        finished.Set();
+      }
+    });
+    queue.Post([&]() noexcept {
+      secondStarted.Set();
+      TestCheck(firstStarted.WaitFor(std::chrono::seconds{10}));
+      if (++finishCount == 2) {
+        finished.Set();
+      }
+    });
+
+    finished.Wait();
+  }
+
+  TEST_METHOD(WorkStealingScheduler_HasThreadAccess) {
+    Mso::ManualResetEvent finished;
+    bool hasThreadAccess{false};
+    bool isCurrentQueue{false};
+
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(2);
+    queue.Post([&]() noexcept {
+      hasThreadAccess = queue.HasThreadAccess();
+      isCurrentQueue = queue.IsCurrentQueue();
+      finished.Set();
+    });
+
+    finished.Wait();
+    TestCheck(hasThreadAccess);
+    TestCheck(isCurrentQueue);
+    TestCheck(!queue.HasThreadAccess());
+  }
+
+  TEST_METHOD(WorkStealingScheduler_SuspendResume) {
+    std::atomic<int32_t> callCount{0};
+    Mso::ManualResetEvent finished;
+
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(4);
+    {
+      auto suspendGuard = queue.Suspend();
+      for (int32_t i = 0; i < 100; ++i) {
+        queue.Post([&]() noexcept {
+          if (++callCount == 100) {
+            finished.Set();
+          }
+        });
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds{50});
+      TestCheckEqual(0, callCount.load());
+    }
+
+    finished.Wait();
+    TestCheckEqual(100, callCount.load());
+  }
+
+  TEST_METHOD(WorkStealingScheduler_PostWhileSuspending) {
+    // Tasks posted while another thread suspends and resumes the queue must all run.
+    constexpr int32_t producerCount = 4;
+    constexpr int32_t taskCount = 10000;
+    std::atomic<int32_t> callCount{0};
+    Mso::ManualResetEvent finished;
+
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(4);
+    std::vector<std::thread> producers;
+    for (int32_t p = 0; p < producerCount; ++p) {
+      producers.emplace_back([&]() noexcept {
+        for (int32_t i = 0; i < taskCount; ++i) {
+          queue.Post([&]() noexcept {
+            if (++callCount == producerCount * taskCount) {
+              finished.Set();
+            }
+          });
+        }
+      });
+    }
+
+    for (int32_t i = 0; i < 1000; ++i) {
+      auto suspendGuard = queue.Suspend();
+      std::this_thread::yield();
+    }
+
+    for (auto &producer : producers) {
+      producer.join();
+    }
+
+    TestCheck(finished.WaitFor(std::chrono::seconds{10}));
+    TestCheckEqual(producerCount * taskCount, callCount.load());
+  }
+
+  TEST_METHOD(WorkStealingScheduler_ShutdownCompletesPendingTasks) {
+    std::atomic<int32_t> callCount{0};
+
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(4);
+    for (int32_t i = 0; i < 1000; ++i) {
+      queue.Post([&]() noexcept { ++callCount; });
+    }
+
+    queue.Shutdown(Mso::PendingTaskAction::Complete);
+    queue.AwaitTermination();
+    TestCheckEqual(1000, callCount.load());
+  }
+
+  TEST_METHOD(WorkStealingScheduler_ReleaseQueueFromTask) {
+    // Check that there is no dead lock if the last queue reference is released from its own task.
+    Mso::ManualResetEvent finished;
+    auto queue = std::make_unique<Mso::DispatchQueue>(Mso::DispatchQueue::MakeConcurrentQueue(4));
+    Mso::DispatchQueue *queuePtr = queue.get();
+    queuePtr->Post([queue = std::move(queue), finished]() mutable noexcept {
+      queue = nullptr;
+      finished.Set();
+    });
+
+    finished.Wait();
+  }
+};
+
+} // namespace DispatchQueueTests
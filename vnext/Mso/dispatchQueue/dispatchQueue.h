@@ -7,6 +7,7 @@
 
 #include <optional>
 #include <thread>
+#include <vector>
 #include "functional/functor.h"
 #include "object/unknownObject.h"
 #include "span/span.h"
@@ -405,6 +406,20 @@ struct IDispatchQueueService : IUnknown {
 
   //! Calls ICancellationListener::OnCancel in case if task implements the ICancellationListener interface.
   virtual void CancelTask(DispatchTask &&task) noexcept = 0;
+
+  //! Try to dequeue up to maxCount tasks from dispatch queue for processing under a single lock.
+  //! The dequeued tasks are appended to the tasks vector. It returns number of dequeued tasks.
+  //! The default implementation calls TryDequeTask for each task for the existing implementations of the interface.
+  virtual size_t TryDequeTasks(/*out*/ std::vector<DispatchTask> &tasks, size_t maxCount) noexcept {
+    size_t count{0};
+    DispatchTask task;
+    while (count < maxCount && TryDequeTask(/*out*/ task)) {
+      tasks.push_back(std::move(task));
+      ++count;
+    }
+
+    return count;
+  }
 };
 
 //! The interface for dispatch queue static members.
@@ -616,6 +631,7 @@ inline DispatchLocalValueGuard DispatchQueue::LockLocalValue(TValue **tlsValue)
 }
 
 inline DispatchSuspendGuard DispatchQueue::Suspend() const noexcept {
+  m_state->Suspend();
   return DispatchSuspendGuard{m_state};
 }
 
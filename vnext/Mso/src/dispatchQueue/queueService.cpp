@@ -23,23 +23,28 @@ QueueService::~QueueService() noexcept {
 void QueueService::Post(DispatchTask &&task) noexcept {
   VerifyElseCrashSz(task, "The task is empty");
 
-  bool isShutdown = false;
-  bool shouldSchedule = false;
-
-  {
+  // Task batching is rare. Do not take the lock unless some thread batches tasks for this queue.
+  if (m_taskBatchingThreadCount.load(std::memory_order_acquire) > 0) {
     std::lock_guard lock{m_mutex};
     auto it = m_taskBatches.find(std::this_thread::get_id());
     if (it != m_taskBatches.end()) {
       it->second->AddTask(std::move(task));
-    } else {
-      isShutdown = m_shutdownAction.has_value();
-      if (!isShutdown) {
-        m_queue.Enqueue(std::move(task));
-        shouldSchedule = (m_suspendCounter == 0);
-      }
+      return;
     }
   }
 
+  // Tasks are enqueued without the lock. Shutdown waits for the in-progress posts to finish
+  // to make sure that every task is either enqueued before the shutdown or canceled.
+  bool isShutdown = false;
+  bool shouldSchedule = false;
+  m_activePostCount.fetch_add(1, std::memory_order_seq_cst);
+  isShutdown = m_isShutdown.load(std::memory_order_seq_cst);
+  if (!isShutdown) {
+    m_queue.Enqueue(std::move(task));
+    shouldSchedule = (m_suspendCounter.load(std::memory_order_seq_cst) == 0);
+  }
+  m_activePostCount.fetch_sub(1, std::memory_order_release);
+
   if (shouldSchedule) {
     m_scheduler->Post();
   } else if (isShutdown) {
@@ -95,6 +100,8 @@ void QueueService::BeginTaskBatching() noexcept {
     taskBatch->SetEnclosingBatch(std::move(result.first->second));
     result.first->second = std::move(taskBatch);
   }
+
+  m_taskBatchingThreadCount.store(m_taskBatches.size(), std::memory_order_release);
 }
 
 DispatchTask QueueService::EndTaskBatching() noexcept {
@@ -107,6 +114,7 @@ DispatchTask QueueService::EndTaskBatching() noexcept {
       it->second = std::move(enclosingBatch);
     } else {
       m_taskBatches.erase(it);
+      m_taskBatchingThreadCount.store(m_taskBatches.size(), std::memory_order_release);
     }
   } else {
     taskBatch = Mso::Make<TaskBatch>();
@@ -171,6 +179,17 @@ void QueueService::Shutdown(PendingTaskAction pendingTaskAction) noexcept {
   {
     std::lock_guard lock{m_mutex};
     m_shutdownAction = pendingTaskAction;
+    m_isShutdown.store(true, std::memory_order_seq_cst);
+  }
+
+  // Wait for the posts that did not observe the shutdown to finish enqueuing their tasks.
+  // Posts do not take the lock to enqueue, but we do not hold it while waiting for them either.
+  while (m_activePostCount.load(std::memory_order_seq_cst) != 0) {
+    std::this_thread::yield();
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
     if (pendingTaskAction == PendingTaskAction::Cancel) {
       m_queue.DequeueAll(/*out*/ tasksToCancel);
     }
@@ -198,6 +217,20 @@ bool QueueService::TryDequeTask(/*out*/ DispatchTask &task) noexcept {
   return m_suspendCounter == 0 && m_queue.TryDequeue(/*out*/ task);
 }
 
+size_t QueueService::TryDequeTasks(/*out*/ std::vector<DispatchTask> &tasks, size_t maxCount) noexcept {
+  size_t count{0};
+  std::lock_guard lock{m_mutex};
+  if (m_suspendCounter == 0) {
+    DispatchTask task;
+    while (count < maxCount && m_queue.TryDequeue(/*out*/ task)) {
+      tasks.push_back(std::move(task));
+      ++count;
+    }
+  }
+
+  return count;
+}
+
 void QueueService::InvokeTask(
     DispatchTask &&task,
     std::optional<std::chrono::steady_clock::time_point> endTime) noexcept {
@@ -276,7 +309,10 @@ DispatchQueue DispatchQueueStatic::MakeLooperQueue(DispatchQueueSettings const &
 }
 
 DispatchQueue DispatchQueueStatic::MakeConcurrentQueue(uint32_t maxThreads) noexcept {
-  return Mso::Make<QueueService, IDispatchQueueService>(MakeThreadPoolScheduler(maxThreads));
+  // Concurrent queues with an explicit thread limit use the work-stealing scheduler.
+  // The predefined limit (zero) and serial (one) queues stay on top of the platform thread pool.
+  return Mso::Make<QueueService, IDispatchQueueService>(
+      maxThreads >= 2 ? MakeWorkStealingScheduler(maxThreads) : MakeThreadPoolScheduler(maxThreads));
 }
 
 DispatchQueue DispatchQueueStatic::MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept {
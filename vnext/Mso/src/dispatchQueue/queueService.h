@@ -3,11 +3,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <thread>
 #include "eventWaitHandle/eventWaitHandle.h"
 #include "object/refCountedObject.h"
 #include "taskQueue.h"
+#include "threadMutex.h"
 
 namespace Mso {
 
@@ -50,6 +52,7 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
   bool TryDequeTask(/*out*/ DispatchTask &task) noexcept override;
   void InvokeTask(DispatchTask &&task, std::optional<std::chrono::steady_clock::time_point> endTime) noexcept override;
   void CancelTask(DispatchTask &&task) noexcept override;
+  size_t TryDequeTasks(/*out*/ std::vector<DispatchTask> &tasks, size_t maxCount) noexcept override;
 
  private:
   bool TrySwapLocalValue(
@@ -62,7 +65,10 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
   ThreadMutex m_mutex;
   TaskQueue m_queue{static_cast<IDispatchQueue *>(this)};
   std::optional<PendingTaskAction> m_shutdownAction;
-  int32_t m_suspendCounter{0};
+  std::atomic<bool> m_isShutdown{false};
+  std::atomic<int32_t> m_suspendCounter{0};
+  std::atomic<uint32_t> m_activePostCount{0};
+  std::atomic<size_t> m_taskBatchingThreadCount{0};
   std::map<std::thread::id, Mso::CntPtr<TaskBatch>> m_taskBatches;
   std::map<ptrdiff_t, QueueLocalValueEntry> m_localValues;
 };
@@ -83,6 +89,7 @@ struct DispatchQueueStatic : Mso::UnknownObject<Mso::RefCountStrategy::NoRefCoun
   static DispatchQueueStatic *Instance() noexcept;
   static Mso::CntPtr<IDispatchQueueScheduler> MakeLooperScheduler(DispatchQueueSettings const &settings) noexcept;
   static Mso::CntPtr<IDispatchQueueScheduler> MakeThreadPoolScheduler(uint32_t maxThreads) noexcept;
+  static Mso::CntPtr<IDispatchQueueScheduler> MakeWorkStealingScheduler(uint32_t maxThreads) noexcept;
 
  public: // IDispatchQueueStatic
   DispatchQueue CurrentQueue() noexcept override;
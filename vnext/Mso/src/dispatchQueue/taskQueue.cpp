@@ -2,99 +2,188 @@
 // Licensed under the MIT license.
 
 #include "taskQueue.h"
+#include <utility>
 
 namespace Mso {
 
 //=============================================================================
-// TaskReadBuffer implementation.
+// TaskQueue::NodeCache implementation.
 //=============================================================================
 
-bool TaskReadBuffer::TryDequeue(DispatchTask &item) noexcept {
-  if (m_index < m_buffer.size()) {
-    item = std::move(m_buffer[m_index]);
-    ++m_index;
-    return true;
+//! List of free nodes. The shared list receives the nodes dequeued by any consumer.
+//! The consumers push nodes to it one by one, while the producers take the whole list at once
+//! into their thread-local list. Taking the whole list with an exchange avoids the ABA problem
+//! of popping single nodes from a lock-free stack.
+struct TaskQueue::NodeCache {
+  ~NodeCache() noexcept {
+    Node *node = Head.exchange(nullptr, std::memory_order_acquire);
+    while (node) {
+      delete std::exchange(node, node->Next.load(std::memory_order_relaxed));
+    }
   }
 
-  return false;
-}
+  void Push(Node *node) noexcept {
+    Node *head = Head.load(std::memory_order_relaxed);
+    do {
+      node->Next.store(head, std::memory_order_relaxed);
+    } while (!Head.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  std::atomic<Node *> Head{nullptr};
 
-void TaskReadBuffer::SwapBuffer(std::vector<DispatchTask> &buffer) noexcept {
-  // Before swapping erase deleted items in the beginning of the buffer.
-  m_buffer.erase(m_buffer.begin(), m_buffer.begin() + m_index);
-  m_index = 0;
-  m_buffer.swap(buffer);
+  // Approximate number of nodes in the shared list. Nodes pushed while a producer takes the list
+  // may be left out of the count, which only lets the list exceed its bound by that many nodes.
+  std::atomic<size_t> Count{0};
+};
+
+/*static*/ TaskQueue::NodeCache &TaskQueue::SharedFreeNodes() noexcept {
+  // The shared list is never destroyed, because queues may still free nodes during static destruction.
+  // Its size is bounded by MaxSharedFreeNodeCount.
+  static NodeCache *freeNodes{new NodeCache()};
+  return *freeNodes;
 }
 
-size_t TaskReadBuffer::Size() const noexcept {
-  return m_buffer.size() - m_index;
+/*static*/ TaskQueue::Node *TaskQueue::AllocateNode() noexcept {
+  // The thread-local list is only accessed by its thread. It is atomic only to share the NodeCache type.
+  thread_local NodeCache t_freeNodes;
+  Node *node = t_freeNodes.Head.load(std::memory_order_relaxed);
+  if (!node) {
+    NodeCache &sharedFreeNodes = SharedFreeNodes();
+    node = sharedFreeNodes.Head.exchange(nullptr, std::memory_order_acquire);
+    if (!node) {
+      return new Node();
+    }
+
+    sharedFreeNodes.Count.store(0, std::memory_order_relaxed);
+  }
+
+  t_freeNodes.Head.store(node->Next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  return node;
 }
 
-bool TaskReadBuffer::IsEmpty() const noexcept {
-  return m_index == m_buffer.size();
+/*static*/ void TaskQueue::FreeNode(Node *node) noexcept {
+  NodeCache &sharedFreeNodes = SharedFreeNodes();
+  if (sharedFreeNodes.Count.fetch_add(1, std::memory_order_relaxed) >= MaxSharedFreeNodeCount) {
+    // Do not keep the nodes of a burst of tasks for the lifetime of the process.
+    sharedFreeNodes.Count.fetch_sub(1, std::memory_order_relaxed);
+    delete node;
+    return;
+  }
+
+  sharedFreeNodes.Push(node);
 }
 
 //=============================================================================
 // TaskQueue implementation.
 //=============================================================================
 
-TaskQueue::TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept : m_weakOwnerPtr{std::move(weakOwnerPtr)} {}
+TaskQueue::TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept
+    : m_head{&m_stub}, m_tail{&m_stub}, m_weakOwnerPtr{std::move(weakOwnerPtr)} {}
 
 TaskQueue::~TaskQueue() noexcept {
   VerifyElseCrashSz(IsEmpty(), "Queue must be empty before destruction.");
 }
 
 void TaskQueue::Enqueue(DispatchTask &&task) noexcept {
-  bool queueWasEmpty{IsEmpty()};
-  m_writeBuffer.push_back(std::move(task));
-  if (queueWasEmpty) {
-    m_strongOwnerPtr = m_weakOwnerPtr.GetStrongPtr();
-  }
+  // The item must be counted before it becomes visible to the consumer.
+  // Otherwise, the consumer could decrement the size below zero.
+  OnItemAdded();
+
+  Node *node = AllocateNode();
+  node->Task = std::move(task);
+  PushNode(node);
 }
 
 bool TaskQueue::TryDequeue(/*out*/ DispatchTask &task) noexcept {
-  if (m_readBuffer.IsEmpty() && !m_writeBuffer.empty()) {
-    m_readBuffer.SwapBuffer(m_writeBuffer);
+  if (Node *node = TryPopNode()) {
+    task = std::move(node->Task);
+    FreeNode(node);
+    OnItemRemoved();
+    return true;
   }
 
-  bool result = m_readBuffer.TryDequeue(/*out*/ task);
-  if (result && IsEmpty()) {
-    m_strongOwnerPtr = nullptr;
+  return false;
+}
+
+bool TaskQueue::DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
+  bool result{false};
+  tasks.reserve(tasks.size() + Size());
+
+  DispatchTask task;
+  while (TryDequeue(/*out*/ task)) {
+    tasks.push_back(std::move(task));
+    result = true;
   }
 
   return result;
 }
 
-bool TaskQueue::DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
-  if (IsEmpty()) {
-    return false;
-  }
+size_t TaskQueue::Size() const noexcept {
+  return m_size.load(std::memory_order_seq_cst);
+}
+
+bool TaskQueue::IsEmpty() const noexcept {
+  return Size() == 0;
+}
 
-  tasks.reserve(tasks.size() + m_readBuffer.Size() + m_writeBuffer.size());
+void TaskQueue::PushNode(Node *node) noexcept {
+  node->Next.store(nullptr, std::memory_order_relaxed);
+  Node *prevHead = m_head.exchange(node, std::memory_order_acq_rel);
+  prevHead->Next.store(node, std::memory_order_release);
+}
+
+TaskQueue::Node *TaskQueue::TryPopNode() noexcept {
+  Node *tail = m_tail;
+  Node *next = tail->Next.load(std::memory_order_acquire);
+  if (tail == &m_stub) {
+    if (!next) {
+      return nullptr;
+    }
+
+    m_tail = next;
+    tail = next;
+    next = next->Next.load(std::memory_order_acquire);
+  }
 
-  if (!m_readBuffer.IsEmpty()) {
-    std::vector<DispatchTask> readBuffer;
-    m_readBuffer.SwapBuffer(readBuffer);
-    tasks.insert(tasks.end(), std::make_move_iterator(readBuffer.begin()), std::make_move_iterator(readBuffer.end()));
+  if (next) {
+    m_tail = next;
+    return tail;
   }
 
-  if (!m_writeBuffer.empty()) {
-    tasks.insert(
-        tasks.end(), std::make_move_iterator(m_writeBuffer.begin()), std::make_move_iterator(m_writeBuffer.end()));
-    m_writeBuffer.clear();
+  if (tail != m_head.load(std::memory_order_acquire)) {
+    // A producer has exchanged the head, but did not link the previous node yet.
+    return nullptr;
   }
 
-  m_strongOwnerPtr = nullptr;
+  // The tail is the last node. Push the stub node behind it to be able to detach the tail.
+  PushNode(&m_stub);
+  next = tail->Next.load(std::memory_order_acquire);
+  if (next) {
+    m_tail = next;
+    return tail;
+  }
 
-  return true;
+  return nullptr;
 }
 
-size_t TaskQueue::Size() const noexcept {
-  return m_readBuffer.Size() + m_writeBuffer.size();
+void TaskQueue::OnItemAdded() noexcept {
+  // Keep strong reference to the owner when queue is not empty.
+  // The transitions from zero to one and from one to zero alternate, and the item that
+  // takes the reference becomes visible only after it is taken.
+  // The size is updated with sequential consistency because QueueService::Resume reads it after
+  // changing the suspend counter, while Post reads the suspend counter after adding an item.
+  if (m_size.fetch_add(1, std::memory_order_seq_cst) == 0) {
+    IUnknown *owner = m_weakOwnerPtr.GetStrongPtr().Detach();
+    VerifyElseCrashSz(owner, "Queue owner must be alive while tasks are posted.");
+    m_ownerPtr.store(owner, std::memory_order_release);
+  }
 }
 
-bool TaskQueue::IsEmpty() const noexcept {
-  return m_readBuffer.IsEmpty() && m_writeBuffer.empty();
+void TaskQueue::OnItemRemoved() noexcept {
+  if (m_size.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    // The caller keeps its own strong reference to the owner while dequeuing.
+    m_ownerPtr.load(std::memory_order_acquire)->Release();
+  }
 }
 
 } // namespace Mso
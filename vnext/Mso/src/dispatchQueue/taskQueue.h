@@ -3,36 +3,27 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include "dispatchQueue/dispatchQueue.h"
-#include "threadMutex.h"
 
 namespace Mso {
 
-//! ReadBuffer is used by task queue to dequeue items.
-//! It moves read index instead of resizing buffer.
-struct TaskReadBuffer {
-  TaskReadBuffer() = default;
-
-  // Prohibit copy and move
-  TaskReadBuffer(TaskReadBuffer const &other) = delete;
-  TaskReadBuffer &operator=(TaskReadBuffer const &other) = delete;
-
-  bool TryDequeue(DispatchTask &task) noexcept;
-  void SwapBuffer(std::vector<DispatchTask> &buffer) noexcept;
-  size_t Size() const noexcept;
-  bool IsEmpty() const noexcept;
-
- private:
-  std::vector<DispatchTask> m_buffer;
-  size_t m_index{0};
-};
-
-//! Simple queue that uses two buffers: one for pushing items and another for popping them.
-//! Items are always enqueued under lock.
+//! Multi-producer single-consumer task queue.
+//! Items are enqueued without taking a lock: any number of threads may call Enqueue concurrently.
+//! Dequeue operations (TryDequeue and DequeueAll) must be serialized by the caller.
+//!
+//! Internally it is an intrusive linked list of nodes with a stub node (D. Vyukov's MPSC queue).
+//! Producers atomically exchange the head and then link the previous node to the new one.
+//! The consumer reads from the tail. While a producer is between the two steps the consumer may
+//! temporarily see fewer items than Size() reports, and a dequeue may fail while the queue is not empty.
+//! The producer does not schedule the queue while it is suspended, and a scheduler may consume the
+//! post of another producer for such an item. Therefore, the schedulers check QueueService::HasTasks()
+//! after they drain the queue or fail to dequeue a task, and schedule the queue again if it has tasks.
 //!
-//! Internally we have two vectors: one to enqueue items (write) and another to dequeue items (read).
-//! When the read queue is empty we swap them.
+//! Nodes are recycled: the dequeued nodes are returned to a shared free list of up to
+//! MaxSharedFreeNodeCount nodes and Enqueue reuses them, so that posting a task does not allocate
+//! a node in the steady state.
 struct TaskQueue {
   TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept;
 
@@ -49,10 +40,31 @@ struct TaskQueue {
   bool IsEmpty() const noexcept;
 
  private:
-  std::vector<DispatchTask> m_writeBuffer; // To enqueue items.
-  TaskReadBuffer m_readBuffer; // To dequeue items.
+  struct Node {
+    std::atomic<Node *> Next{nullptr};
+    DispatchTask Task;
+  };
+
+  struct NodeCache;
+
+  static constexpr size_t MaxSharedFreeNodeCount{1024};
+
+  static Node *AllocateNode() noexcept;
+  static void FreeNode(Node *node) noexcept;
+  static NodeCache &SharedFreeNodes() noexcept; // Nodes dequeued by all queues.
+
+  void PushNode(Node *node) noexcept;
+  Node *TryPopNode() noexcept;
+  void OnItemAdded() noexcept;
+  void OnItemRemoved() noexcept;
+
+ private:
+  std::atomic<Node *> m_head; // Producers push items to the head.
+  Node *m_tail; // The consumer pops items from the tail.
+  Node m_stub;
+  std::atomic<size_t> m_size{0};
   Mso::WeakPtr<IUnknown> m_weakOwnerPtr;
-  Mso::CntPtr<IUnknown> m_strongOwnerPtr; // Keep strong reference to the owner when queue is not empty;
+  std::atomic<IUnknown *> m_ownerPtr{nullptr}; // Owner is kept alive while queue is not empty.
 };
 
 } // namespace Mso
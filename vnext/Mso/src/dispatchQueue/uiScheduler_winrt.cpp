@@ -211,6 +211,9 @@ int32_t __stdcall TaskDispatcherHandler<TDispatcherTraits>::Invoke() noexcept {
   DispatchTask task;
   if (m_scheduler->TryTakeTask(queue, task)) {
     queue->InvokeTask(std::move(task), std::chrono::steady_clock::now() + std::chrono::milliseconds(1000 / 60));
+  } else if (queue && queue->HasTasks()) {
+    // The task of this post is still being linked into the queue by its producer.
+    m_scheduler->Post();
   }
 
   return impl::error_ok;
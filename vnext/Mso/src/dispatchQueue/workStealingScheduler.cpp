@@ -0,0 +1,339 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <utility>
+#include "dispatchQueue/dispatchQueue.h"
+#include "queueService.h"
+
+using namespace std::chrono_literals;
+
+namespace Mso {
+
+//! Portable concurrent scheduler that runs dispatch queue tasks on its own pool of worker threads.
+//! Each worker owns a local task deque. Workers refill their deques from the dispatch queue in small batches
+//! to reduce contention on the queue lock, and idle workers steal half of the tasks from a busy worker.
+//! Tasks that were taken from the dispatch queue by a worker are treated the same way as a task that is
+//! being invoked: they are completed even if the queue is suspended or shut down after they were taken.
+struct WorkStealingScheduler : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispatchQueueScheduler> {
+  WorkStealingScheduler(uint32_t maxThreads) noexcept;
+  ~WorkStealingScheduler() noexcept override;
+
+  static void RunWorker(const Mso::WeakPtr<WorkStealingScheduler> &weakSelf, size_t workerIndex) noexcept;
+
+ public: // IDispatchQueueScheduler
+  void InitializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept override;
+  bool HasThreadAccess() noexcept override;
+  bool IsSerial() noexcept override;
+  void Post() noexcept override;
+  void Shutdown() noexcept override;
+  void AwaitTermination() noexcept override;
+
+ private:
+  struct WorkerQueue {
+    std::mutex Mutex;
+    std::deque<DispatchTask> Tasks;
+  };
+
+  void RunTasks(size_t workerIndex) noexcept;
+  bool TryPark(uint64_t postEpoch) noexcept;
+  bool TryTakeTask(IDispatchQueueService &queue, size_t workerIndex, /*out*/ DispatchTask &task) noexcept;
+  bool TryPopLocalTask(size_t workerIndex, /*out*/ DispatchTask &task) noexcept;
+  bool TryStealTask(size_t workerIndex, /*out*/ DispatchTask &task) noexcept;
+  bool TryRefillTasks(IDispatchQueueService &queue, size_t workerIndex, /*out*/ DispatchTask &task) noexcept;
+  void PushLocalTasks(size_t workerIndex, std::vector<DispatchTask> &tasks, size_t startIndex) noexcept;
+  void CancelLocalTasks(size_t workerIndex) noexcept;
+  void WakeUpWorker() noexcept;
+
+ private:
+  struct ThreadAccessGuard {
+    ThreadAccessGuard(WorkStealingScheduler *scheduler) noexcept;
+    ~ThreadAccessGuard() noexcept;
+
+    static bool HasThreadAccess(WorkStealingScheduler *scheduler) noexcept;
+
+   private:
+    WorkStealingScheduler *m_prevScheduler{nullptr};
+    static thread_local WorkStealingScheduler *tls_scheduler;
+  };
+
+ private:
+  const uint32_t m_maxThreads{1};
+  std::vector<std::unique_ptr<WorkerQueue>> m_workerQueues;
+  Mso::WeakPtr<IDispatchQueueService> m_queue;
+
+  std::mutex m_mutex;
+  std::condition_variable m_wakeUpCondition;
+  std::vector<std::thread> m_threads;
+  std::atomic<uint32_t> m_startedWorkerCount{0};
+  std::atomic<uint64_t> m_postEpoch{0};
+  uint32_t m_idleWorkerCount{0};
+  uint32_t m_pendingWakeUpCount{0};
+  bool m_isShutdown{false};
+
+  constexpr static uint32_t MaxConcurrentThreads{64};
+  constexpr static size_t RefillBatchSize{16};
+  constexpr static std::chrono::milliseconds TaskTimeQuota{100ms};
+};
+
+//=============================================================================
+// WorkStealingScheduler implementation
+//=============================================================================
+
+WorkStealingScheduler::WorkStealingScheduler(uint32_t maxThreads) noexcept
+    : m_maxThreads{maxThreads == 0 ? std::max(std::thread::hardware_concurrency(), 2u) : maxThreads} {
+  const uint32_t workerCount = std::min(m_maxThreads, MaxConcurrentThreads);
+  m_workerQueues.reserve(workerCount);
+  for (uint32_t i = 0; i < workerCount; ++i) {
+    m_workerQueues.push_back(std::make_unique<WorkerQueue>());
+  }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() noexcept {
+  AwaitTermination();
+}
+
+/*static*/ void WorkStealingScheduler::RunWorker(
+    const Mso::WeakPtr<WorkStealingScheduler> &weakSelf,
+    size_t workerIndex) noexcept {
+  if (auto self = weakSelf.GetStrongPtr()) {
+    ThreadAccessGuard guard{self.Get()};
+    for (;;) {
+      // Capture the post epoch before looking for tasks to avoid missing a Post() call made after the search.
+      uint64_t postEpoch = self->m_postEpoch.load(std::memory_order_acquire);
+      self->RunTasks(workerIndex);
+      if (!self->TryPark(postEpoch)) {
+        break;
+      }
+    }
+  }
+}
+
+void WorkStealingScheduler::RunTasks(size_t workerIndex) noexcept {
+  // Do not hold the queue strong reference while the worker is parked. Otherwise, the queue is never released.
+  if (auto queue = m_queue.GetStrongPtr()) {
+    DispatchTask task;
+    while (TryTakeTask(*queue, workerIndex, /*out*/ task)) {
+      queue->InvokeTask(std::move(task), std::chrono::steady_clock::now() + TaskTimeQuota);
+    }
+
+    // A refill misses the tasks that producers are still linking into the queue, and Resume() posts once per task
+    // that it sees. Check the queue again as ThreadPoolSchedulerWin::WorkCallback does, so that no task is stranded.
+    if (queue->HasTasks()) {
+      Post();
+    }
+  } else {
+    CancelLocalTasks(workerIndex);
+  }
+}
+
+bool WorkStealingScheduler::TryPark(uint64_t postEpoch) noexcept {
+  std::unique_lock lock{m_mutex};
+  if (m_isShutdown) {
+    return false;
+  }
+
+  ++m_idleWorkerCount;
+  m_wakeUpCondition.wait(
+      lock, [&]() noexcept { return m_isShutdown || m_postEpoch.load(std::memory_order_relaxed) != postEpoch; });
+  --m_idleWorkerCount;
+  if (m_pendingWakeUpCount > 0) {
+    --m_pendingWakeUpCount;
+  }
+
+  // On shutdown we run one more time to complete the pending tasks.
+  return true;
+}
+
+bool WorkStealingScheduler::TryTakeTask(
+    IDispatchQueueService &queue,
+    size_t workerIndex,
+    /*out*/ DispatchTask &task) noexcept {
+  return TryPopLocalTask(workerIndex, /*out*/ task) || TryStealTask(workerIndex, /*out*/ task) ||
+      TryRefillTasks(queue, workerIndex, /*out*/ task);
+}
+
+bool WorkStealingScheduler::TryPopLocalTask(size_t workerIndex, /*out*/ DispatchTask &task) noexcept {
+  WorkerQueue &workerQueue = *m_workerQueues[workerIndex];
+  std::lock_guard lock{workerQueue.Mutex};
+  if (workerQueue.Tasks.empty()) {
+    return false;
+  }
+
+  task = std::move(workerQueue.Tasks.front());
+  workerQueue.Tasks.pop_front();
+  return true;
+}
+
+bool WorkStealingScheduler::TryStealTask(size_t workerIndex, /*out*/ DispatchTask &task) noexcept {
+  const size_t workerCount = m_startedWorkerCount.load(std::memory_order_acquire);
+  std::vector<DispatchTask> stolenTasks;
+  for (size_t i = 1; i < workerCount; ++i) {
+    WorkerQueue &victimQueue = *m_workerQueues[(workerIndex + i) % workerCount];
+    std::lock_guard lock{victimQueue.Mutex};
+    if (!victimQueue.Tasks.empty()) {
+      // Steal the newer half of the victim's tasks from the back. The victim keeps consuming from the front.
+      size_t stealCount = (victimQueue.Tasks.size() + 1) / 2;
+      stolenTasks.reserve(stealCount);
+      auto stealStart = victimQueue.Tasks.end() - stealCount;
+      stolenTasks.insert(
+          stolenTasks.end(), std::make_move_iterator(stealStart), std::make_move_iterator(victimQueue.Tasks.end()));
+      victimQueue.Tasks.erase(stealStart, victimQueue.Tasks.end());
+      break;
+    }
+  }
+
+  if (stolenTasks.empty()) {
+    return false;
+  }
+
+  task = std::move(stolenTasks.front());
+  PushLocalTasks(workerIndex, stolenTasks, /*startIndex:*/ 1);
+  return true;
+}
+
+bool WorkStealingScheduler::TryRefillTasks(
+    IDispatchQueueService &queue,
+    size_t workerIndex,
+    /*out*/ DispatchTask &task) noexcept {
+  std::vector<DispatchTask> tasks;
+  if (queue.TryDequeTasks(/*out*/ tasks, RefillBatchSize) == 0) {
+    return false;
+  }
+
+  task = std::move(tasks.front());
+  if (tasks.size() > 1) {
+    PushLocalTasks(workerIndex, tasks, /*startIndex:*/ 1);
+
+    // Let an idle worker steal some of the tasks we just took.
+    WakeUpWorker();
+  }
+
+  return true;
+}
+
+void WorkStealingScheduler::PushLocalTasks(
+    size_t workerIndex,
+    std::vector<DispatchTask> &tasks,
+    size_t startIndex) noexcept {
+  WorkerQueue &workerQueue = *m_workerQueues[workerIndex];
+  std::lock_guard lock{workerQueue.Mutex};
+  workerQueue.Tasks.insert(
+      workerQueue.Tasks.end(),
+      std::make_move_iterator(tasks.begin() + startIndex),
+      std::make_move_iterator(tasks.end()));
+}
+
+void WorkStealingScheduler::CancelLocalTasks(size_t workerIndex) noexcept {
+  std::deque<DispatchTask> tasksToCancel;
+  {
+    WorkerQueue &workerQueue = *m_workerQueues[workerIndex];
+    std::lock_guard lock{workerQueue.Mutex};
+    tasksToCancel.swap(workerQueue.Tasks);
+  }
+
+  for (auto &task : tasksToCancel) {
+    if (auto cancellation = query_cast<ICancellationListener *>(task.Get())) {
+      cancellation->OnCancel();
+    }
+  }
+}
+
+void WorkStealingScheduler::WakeUpWorker() noexcept {
+  std::lock_guard lock{m_mutex};
+  if (m_isShutdown) {
+    return;
+  }
+
+  m_postEpoch.fetch_add(1, std::memory_order_release);
+  if (m_idleWorkerCount > m_pendingWakeUpCount) {
+    ++m_pendingWakeUpCount;
+    m_wakeUpCondition.notify_one();
+  } else if (m_threads.size() < m_workerQueues.size()) {
+    size_t workerIndex = m_threads.size();
+    m_threads.emplace_back(
+        [weakSelf = Mso::WeakPtr{this}, workerIndex]() noexcept { RunWorker(weakSelf, workerIndex); });
+    m_startedWorkerCount.store(static_cast<uint32_t>(m_threads.size()), std::memory_order_release);
+  }
+}
+
+void WorkStealingScheduler::InitializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept {
+  m_queue = std::move(queue);
+}
+
+bool WorkStealingScheduler::HasThreadAccess() noexcept {
+  return ThreadAccessGuard::HasThreadAccess(this);
+}
+
+bool WorkStealingScheduler::IsSerial() noexcept {
+  return m_maxThreads == 1;
+}
+
+void WorkStealingScheduler::Post() noexcept {
+  WakeUpWorker();
+}
+
+void WorkStealingScheduler::Shutdown() noexcept {
+  {
+    std::lock_guard lock{m_mutex};
+    m_isShutdown = true;
+  }
+
+  m_wakeUpCondition.notify_all();
+}
+
+void WorkStealingScheduler::AwaitTermination() noexcept {
+  std::vector<std::thread> threads;
+  {
+    std::lock_guard lock{m_mutex};
+    m_isShutdown = true;
+    threads = std::move(m_threads);
+    m_threads.clear();
+  }
+
+  m_wakeUpCondition.notify_all();
+
+  for (auto &thread : threads) {
+    if (thread.joinable()) {
+      if (thread.get_id() != std::this_thread::get_id()) {
+        thread.join();
+      } else {
+        // The last queue reference is released from a task on this worker thread.
+        // We cannot join ourselves, and we cannot let std::thread destructor to crash on non-joined thread.
+        thread.detach();
+      }
+    }
+  }
+}
+
+//=============================================================================
+// WorkStealingScheduler::ThreadAccessGuard implementation
+//=============================================================================
+
+/*static*/ thread_local WorkStealingScheduler *WorkStealingScheduler::ThreadAccessGuard::tls_scheduler{nullptr};
+
+WorkStealingScheduler::ThreadAccessGuard::ThreadAccessGuard(WorkStealingScheduler *scheduler) noexcept
+    : m_prevScheduler{tls_scheduler} {
+  tls_scheduler = scheduler;
+}
+
+WorkStealingScheduler::ThreadAccessGuard::~ThreadAccessGuard() noexcept {
+  tls_scheduler = m_prevScheduler;
+}
+
+/*static*/ bool WorkStealingScheduler::ThreadAccessGuard::HasThreadAccess(WorkStealingScheduler *scheduler) noexcept {
+  return tls_scheduler == scheduler;
+}
+
+//=============================================================================
+// DispatchQueueStatic::MakeWorkStealingScheduler implementation
+//=============================================================================
+
+/*static*/ Mso::CntPtr<IDispatchQueueScheduler> DispatchQueueStatic::MakeWorkStealingScheduler(
+    uint32_t maxThreads) noexcept {
+  return Mso::Make<WorkStealingScheduler, IDispatchQueueScheduler>(maxThreads);
+}
+
+} // namespace Mso
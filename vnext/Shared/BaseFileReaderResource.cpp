@@ -33,12 +33,13 @@ void BaseFileReaderResource::ReadAsText(
     return resolver("Could not find Blob persistor");
   }
 
-  winrt::array_view<uint8_t const> bytes;
+  BlobContent content;
   try {
-    bytes = persistor->ResolveMessage(std::move(blobId), offset, size);
+    content = persistor->ResolveMessage(std::move(blobId), offset, size);
   } catch (const std::exception &e) {
     return rejecter(e.what());
   }
+  auto const &bytes = content.Data;
 
   // #9982 - Handle non-UTF8 encodings
   //         See https://docs.oracle.com/en/java/javase/11/docs/api/java.base/java/nio/charset/Charset.html
@@ -59,12 +60,13 @@ void BaseFileReaderResource::ReadAsDataUrl(
     return rejecter("Could not find Blob persistor");
   }
 
-  winrt::array_view<uint8_t const> bytes;
+  BlobContent content;
   try {
-    bytes = persistor->ResolveMessage(std::move(blobId), offset, size);
+    content = persistor->ResolveMessage(std::move(blobId), offset, size);
   } catch (const std::exception &e) {
     return rejecter(e.what());
   }
+  auto const &bytes = content.Data;
 
   auto result = string{"data:"};
   result += type;
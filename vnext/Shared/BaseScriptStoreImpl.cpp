@@ -13,6 +13,7 @@
 #include <winrt/base.h>
 
 // Standard Library
+#include <algorithm>
 #include <fstream>
 
 namespace facebook {
@@ -100,6 +101,109 @@ struct PreparedScriptSuffix {
   char eof[length__(PERSIST_EOF)];
 };
 
+// Wraps a prepared script between the prefix and suffix that ReadPreparedScriptEntry validates.
+std::unique_ptr<const jsi::Buffer> MakePreparedScriptEntry(
+    const jsi::Buffer &preparedScript,
+    jsi::ScriptVersion_t scriptVersion,
+    jsi::JSRuntimeVersion_t runtimeVersion) noexcept {
+  // TODO :: Unfortunately, The current abstraction is forcing us to make a
+  // copy. Need to re-evaluate.
+  auto newBuffer = std::make_unique<ByteArrayBuffer>(
+      sizeof(PreparedScriptPrefix) + preparedScript.size() + sizeof(PreparedScriptSuffix));
+
+  PreparedScriptPrefix *prefix = reinterpret_cast<PreparedScriptPrefix *>(newBuffer->data());
+  memcpy_s(prefix->magic, sizeof(prefix->magic), PERSIST_MAGIC, sizeof(prefix->magic));
+  prefix->scriptVersion = scriptVersion;
+  prefix->runtimeVersion = runtimeVersion;
+  prefix->sizeInBytes = preparedScript.size();
+
+  std::optional<std::vector<std::uint8_t>> hashBuffer =
+      Microsoft::ReactNative::GetSHA256Hash(preparedScript.data(), preparedScript.size());
+  if (!hashBuffer) {
+    // Hashing failed.
+    std::terminate();
+  }
+
+  memcpy_s(prefix->hash, sizeof(prefix->hash), hashBuffer.value().data(), hashBuffer.value().size());
+
+  memcpy_s(
+      newBuffer->data() + sizeof(PreparedScriptPrefix),
+      newBuffer->size() - sizeof(PreparedScriptPrefix),
+      preparedScript.data(),
+      preparedScript.size());
+
+  PreparedScriptSuffix *suffix = reinterpret_cast<PreparedScriptSuffix *>(
+      newBuffer->data() + sizeof(PreparedScriptPrefix) + preparedScript.size());
+  memcpy_s(suffix->eof, sizeof(suffix->eof), PERSIST_EOF, sizeof(suffix->eof));
+
+  return newBuffer;
+}
+
+// Returns the prepared script of an entry made by MakePreparedScriptEntry, or null if the entry is corrupted or was
+// made for other versions.
+std::shared_ptr<const jsi::Buffer> ReadPreparedScriptEntry(
+    std::unique_ptr<const jsi::Buffer> buffer,
+    jsi::ScriptVersion_t scriptVersion,
+    jsi::JSRuntimeVersion_t runtimeVersion) noexcept {
+  if (buffer->size() < sizeof(PreparedScriptPrefix) + sizeof(PreparedScriptSuffix)) {
+    // Too small to hold the prefix and suffix. The store was likely truncated.
+    return nullptr;
+  }
+
+  const PreparedScriptPrefix *prefix = reinterpret_cast<const PreparedScriptPrefix *>(buffer->data());
+
+  if (strncmp(prefix->magic, PERSIST_MAGIC, sizeof(prefix->magic)) != 0) {
+    // magic value doesn't match!! The store is very likely corrupted or belongs
+    // to old version.
+    return nullptr;
+  }
+
+  if (prefix->scriptVersion != scriptVersion) {
+    // script version don't match!! Need to regenerate cache.
+    return nullptr;
+  }
+
+  if (prefix->runtimeVersion != runtimeVersion) {
+    // Runtime changed after the cache generation.
+    return nullptr;
+  }
+
+  if (prefix->sizeInBytes != buffer->size() - sizeof(PreparedScriptPrefix) - sizeof(PreparedScriptSuffix)) {
+    // Size is not as expected. Store is possibly corrupted .. It is safer to
+    // bail out.
+    return nullptr;
+  }
+
+  std::optional<std::vector<std::uint8_t>> hashBuffer = Microsoft::ReactNative::GetSHA256Hash(
+      reinterpret_cast<const std::uint8_t *>(buffer->data()) + sizeof(PreparedScriptPrefix),
+      static_cast<size_t>(prefix->sizeInBytes));
+  if (!hashBuffer) {
+    // Hashing failed.
+    return nullptr;
+  }
+
+  if (hashBuffer.value().size() < sizeof(prefix->hash)) {
+    // Unexpected hash size.
+    return nullptr;
+  }
+
+  if (memcmp(hashBuffer.value().data(), prefix->hash, sizeof(prefix->hash)) != 0) {
+    // Hash doesn't match. Store is possibly corrupted. It is safer to bail out.
+    return nullptr;
+  }
+
+  const PreparedScriptSuffix *suffix = reinterpret_cast<const PreparedScriptSuffix *>(
+      buffer->data() + sizeof(PreparedScriptPrefix) + prefix->sizeInBytes);
+  if (strncmp(suffix->eof, PERSIST_EOF, sizeof(suffix->eof)) != 0) {
+    // magic value doesn't match!! The store is very likely corrupted or belongs
+    // to old version.
+    return nullptr;
+  }
+
+  auto sizeInBytes = static_cast<size_t>(prefix->sizeInBytes);
+  return std::make_shared<BufferViewBuffer>(std::move(buffer), sizeof(PreparedScriptPrefix), sizeInBytes);
+}
+
 } // namespace
 
 jsi::VersionedBuffer BaseScriptStoreImpl::getVersionedScript(const std::string &url) noexcept {
@@ -247,98 +351,197 @@ std::shared_ptr<const jsi::Buffer> BasePreparedScriptStoreImpl::tryGetPreparedSc
     return nullptr;
   }
 
-  const PreparedScriptPrefix *prefix = reinterpret_cast<const PreparedScriptPrefix *>(buffer->data());
+  return ReadPreparedScriptEntry(std::move(buffer), scriptSignature.version, runtimeSignature.version);
+}
 
-  if (strncmp(prefix->magic, PERSIST_MAGIC, sizeof(prefix->magic)) != 0) {
-    // magic value doesn't match!! The store is very likely corrupted or belongs
-    // to old version.
-    return nullptr;
-  }
+void BasePreparedScriptStoreImpl::persistPreparedScript(
+    std::shared_ptr<const jsi::Buffer> preparedScript,
+    const jsi::ScriptSignature &scriptMetadata,
+    const jsi::JSRuntimeSignature &runtimeMetadata,
+    const char *prepareTag) noexcept {
+  auto newBuffer = MakePreparedScriptEntry(*preparedScript, scriptMetadata.version, runtimeMetadata.version);
 
-  if (prefix->scriptVersion != scriptSignature.version) {
-    // script version don't match!! Need to regenerate cache.
-    return nullptr;
-  }
+  std::string preparedScriptFilePath = getPreparedScriptFileName(scriptMetadata, runtimeMetadata, prepareTag);
 
-  if (prefix->runtimeVersion != runtimeSignature.version) {
-    // Runtime changed after the cache generation.
-    return nullptr;
-  }
+  bufferStore_->persistBuffer(preparedScriptFilePath, std::move(newBuffer));
+}
 
-  if (prefix->sizeInBytes != buffer->size() - sizeof(PreparedScriptPrefix) - sizeof(PreparedScriptSuffix)) {
-    // Size is not as expected. Store is possibly corrupted .. It is safer to
-    // bail out.
-    return nullptr;
+jsi::ScriptVersion_t ContentHashScriptVersionProvider::getVersion(const std::string &url) noexcept {
+  try {
+    auto buffer = Microsoft::JSI::MakeMemoryMappedBuffer(winrt::to_hstring(url).c_str());
+    auto hash = Microsoft::ReactNative::GetSHA256Hash(buffer->data(), buffer->size());
+    if (!hash || hash.value().size() < sizeof(jsi::ScriptVersion_t)) {
+      return 0;
+    }
+
+    jsi::ScriptVersion_t version = 0;
+    memcpy_s(&version, sizeof(version), hash.value().data(), sizeof(version));
+    // 0 means that the version could not be computed.
+    return version != 0 ? version : 1;
+  } catch (const facebook::jsi::JSINativeException &) {
+    return 0;
   }
+}
 
-  std::optional<std::vector<std::uint8_t>> hashBuffer = Microsoft::ReactNative::GetSHA256Hash(
-      reinterpret_cast<const std::uint8_t *>(buffer->data()) + sizeof(PreparedScriptPrefix),
-      static_cast<size_t>(prefix->sizeInBytes));
-  if (!hashBuffer) {
+std::string LruPreparedScriptStore::getEntryName(
+    const jsi::ScriptSignature &scriptSignature,
+    const jsi::JSRuntimeSignature &runtimeSignature,
+    const char *prepareTag) noexcept {
+  // The version only tells apart the versions of the script at one url: runtimes do not all derive it from the script
+  // content, and apps sharing the store directory may use the same version for other scripts.
+  std::string key = scriptSignature.url;
+  key.append("|").append(std::to_string(scriptSignature.version));
+  key.append("|").append(runtimeSignature.runtimeName);
+  key.append("|").append(std::to_string(runtimeSignature.version));
+  key.append("|").append(prepareTag ? prepareTag : "");
+
+  auto hash = Microsoft::ReactNative::GetSHA256Hash(key.data(), key.size());
+  if (!hash) {
     // Hashing failed.
-    return nullptr;
+    std::terminate();
   }
 
-  if (hashBuffer.value().size() < sizeof(prefix->hash)) {
-    // Unexpected hash size.
-    return nullptr;
+  constexpr char hexDigits[] = "0123456789abcdef";
+  std::string entryName("rnwprep_");
+  for (size_t i = 0; i < 16 && i < hash.value().size(); ++i) {
+    entryName.push_back(hexDigits[hash.value()[i] >> 4]);
+    entryName.push_back(hexDigits[hash.value()[i] & 0xf]);
   }
+  entryName.append(".cache");
+  return entryName;
+}
 
-  if (memcmp(hashBuffer.value().data(), prefix->hash, sizeof(prefix->hash)) != 0) {
-    // Hash doesn't match. Store is possibly corrupted. It is safer to bail out.
+std::shared_ptr<const jsi::Buffer> LruPreparedScriptStore::tryGetPreparedScript(
+    const jsi::ScriptSignature &scriptSignature,
+    const jsi::JSRuntimeSignature &runtimeSignature,
+    const char *prepareTag) noexcept {
+  auto entryPath = winrt::to_hstring(storeDirectory_ + getEntryName(scriptSignature, runtimeSignature, prepareTag));
+
+  std::unique_ptr<const jsi::Buffer> buffer;
+  try {
+    buffer = Microsoft::JSI::MakeMemoryMappedBuffer(entryPath.c_str());
+  } catch (const facebook::jsi::JSINativeException &) {
     return nullptr;
   }
 
-  const PreparedScriptSuffix *suffix = reinterpret_cast<const PreparedScriptSuffix *>(
-      buffer->data() + sizeof(PreparedScriptPrefix) + prefix->sizeInBytes);
-  if (strncmp(suffix->eof, PERSIST_EOF, sizeof(suffix->eof)) != 0) {
-    // magic value doesn't match!! The store is very likely corrupted or belongs
-    // to old version.
+  auto preparedScript = ReadPreparedScriptEntry(std::move(buffer), scriptSignature.version, runtimeSignature.version);
+  if (!preparedScript) {
+    // Corrupted, for instance by a power loss after the rename. The next persistPreparedScript replaces it.
     return nullptr;
   }
 
-  return std::make_shared<BufferViewBuffer>(
-      std::move(buffer), sizeof(PreparedScriptPrefix), static_cast<size_t>(prefix->sizeInBytes));
+  // Mark the entry as recently used for evict.
+  HANDLE file = CreateFile2(
+      entryPath.c_str(),
+      FILE_WRITE_ATTRIBUTES,
+      FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+      OPEN_EXISTING,
+      nullptr /* pCreateExParams */);
+  if (file != INVALID_HANDLE_VALUE) {
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    SetFileTime(file, nullptr, nullptr, &now);
+    CloseHandle(file);
+  }
+
+  return preparedScript;
 }
 
-void BasePreparedScriptStoreImpl::persistPreparedScript(
+void LruPreparedScriptStore::persistPreparedScript(
     std::shared_ptr<const jsi::Buffer> preparedScript,
-    const jsi::ScriptSignature &scriptMetadata,
-    const jsi::JSRuntimeSignature &runtimeMetadata,
+    const jsi::ScriptSignature &scriptSignature,
+    const jsi::JSRuntimeSignature &runtimeSignature,
     const char *prepareTag) noexcept {
-  // TODO :: Unfortunately, The current abstraction is forcing us to make a
-  // copy. Need to re-evaluate.
-  auto newBuffer = std::make_unique<ByteArrayBuffer>(
-      sizeof(PreparedScriptPrefix) + preparedScript->size() + sizeof(PreparedScriptSuffix));
+  auto entry = MakePreparedScriptEntry(*preparedScript, scriptSignature.version, runtimeSignature.version);
+  auto entryName = getEntryName(scriptSignature, runtimeSignature, prepareTag);
+  auto entryPath = winrt::to_hstring(storeDirectory_ + entryName);
+  auto tempPath = winrt::to_hstring(
+      storeDirectory_ + entryName.substr(0, entryName.size() - 6) + "_" + std::to_string(GetCurrentProcessId()) +
+      ".tmp");
+
+  {
+    std::ofstream file(tempPath.c_str(), std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return;
+    }
 
-  PreparedScriptPrefix *prefix = reinterpret_cast<PreparedScriptPrefix *>(newBuffer->data());
-  memcpy_s(prefix->magic, sizeof(prefix->magic), PERSIST_MAGIC, sizeof(prefix->magic));
-  prefix->scriptVersion = scriptMetadata.version;
-  prefix->runtimeVersion = runtimeMetadata.version;
-  prefix->sizeInBytes = preparedScript->size();
+    file.write(reinterpret_cast<const char *>(entry->data()), entry->size());
+    file.close();
+    if (!file) {
+      DeleteFileW(tempPath.c_str());
+      return;
+    }
+  }
 
-  std::optional<std::vector<std::uint8_t>> hashBuffer =
-      Microsoft::ReactNative::GetSHA256Hash(preparedScript->data(), preparedScript->size());
-  if (!hashBuffer) {
-    // Hashing failed.
-    std::terminate();
+  // The rename fails if another instance has the entry mapped. Its entry was prepared from the same script, so it is
+  // kept.
+  if (!MoveFileExW(tempPath.c_str(), entryPath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+    DeleteFileW(tempPath.c_str());
+    return;
   }
 
-  memcpy_s(prefix->hash, sizeof(prefix->hash), hashBuffer.value().data(), hashBuffer.value().size());
+  evict(entryName);
+}
 
-  memcpy_s(
-      newBuffer->data() + sizeof(PreparedScriptPrefix),
-      newBuffer->size() - sizeof(PreparedScriptPrefix),
-      preparedScript->data(),
-      preparedScript->size());
+void LruPreparedScriptStore::evict(const std::string &keepEntryName) noexcept {
+  struct Entry {
+    std::wstring path;
+    uint64_t size;
+    uint64_t lastWriteTime;
+  };
+
+  std::vector<Entry> entries;
+  uint64_t totalSize = 0;
+  std::wstring directory(winrt::to_hstring(storeDirectory_));
+  auto keepPath = directory + std::wstring(winrt::to_hstring(keepEntryName));
+
+  // The entries of BasePreparedScriptStoreImpl are never read again once the app uses this store.
+  for (auto pattern : {L"rnwprep_*", L"prep_*.cache"}) {
+    WIN32_FIND_DATAW findData;
+    HANDLE find =
+        FindFirstFileExW((directory + pattern).c_str(), FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, 0);
+    if (find == INVALID_HANDLE_VALUE) {
+      continue;
+    }
 
-  PreparedScriptSuffix *suffix = reinterpret_cast<PreparedScriptSuffix *>(
-      newBuffer->data() + sizeof(PreparedScriptPrefix) + preparedScript->size());
-  memcpy_s(suffix->eof, sizeof(suffix->eof), PERSIST_EOF, sizeof(suffix->eof));
+    do {
+      if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+        continue;
+      }
+
+      std::wstring_view name{findData.cFileName};
+      auto path = directory + std::wstring(name);
+      if (name.size() > 4 && name.substr(name.size() - 4) == L".tmp") {
+        // Left behind by a crash while persisting. Fails for the files that other instances are still writing.
+        DeleteFileW(path.c_str());
+      } else if (name.size() > 6 && name.substr(name.size() - 6) == L".cache") {
+        auto size = (static_cast<uint64_t>(findData.nFileSizeHigh) << 32) | findData.nFileSizeLow;
+        totalSize += size;
+        if (path != keepPath) {
+          entries.push_back(
+              {std::move(path),
+               size,
+               (static_cast<uint64_t>(findData.ftLastWriteTime.dwHighDateTime) << 32) |
+                   findData.ftLastWriteTime.dwLowDateTime});
+        }
+      }
+    } while (FindNextFileW(find, &findData));
+    FindClose(find);
+  }
 
-  std::string preparedScriptFilePath = getPreparedScriptFileName(scriptMetadata, runtimeMetadata, prepareTag);
+  std::sort(entries.begin(), entries.end(), [](const Entry &left, const Entry &right) {
+    return left.lastWriteTime < right.lastWriteTime;
+  });
 
-  bufferStore_->persistBuffer(preparedScriptFilePath, std::move(newBuffer));
+  // Entries in use by other instances cannot be deleted, and are left for a later eviction.
+  for (const auto &entry : entries) {
+    if (totalSize <= maxSizeInBytes_) {
+      break;
+    }
+    if (DeleteFileW(entry.path.c_str())) {
+      totalSize -= entry.size;
+    }
+  }
 }
 
 } // namespace react
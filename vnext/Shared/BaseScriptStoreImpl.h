@@ -39,6 +39,13 @@ class LocalFileSimpleScriptVersionProvider : public ScriptVersionProvider {
   facebook::jsi::ScriptVersion_t getVersion(const std::string &url) noexcept override;
 };
 
+// Version provider assuming that the script url is a local filesystem path, and using the first 8 bytes of the
+// SHA-256 hash of the script content as its version, so that an edited script never matches a stale prepared script.
+class ContentHashScriptVersionProvider : public ScriptVersionProvider {
+ public:
+  facebook::jsi::ScriptVersion_t getVersion(const std::string &url) noexcept override;
+};
+
 struct PreparedScriptStoreNameGenerator {
   virtual std::string getStoreName(const std::string &url) noexcept = 0;
 };
@@ -72,6 +79,47 @@ class BasePreparedScriptStoreImpl : public facebook::jsi::PreparedScriptStore {
   std::shared_ptr<BufferStore> bufferStore_;
 };
 
+// Prepared script store naming its entries after a hash of the script url and version, runtime signature and prepare
+// tag, so that entry names have a fixed length and no characters of the url.
+// - Entries are memory-mapped and checked against the hash they were persisted with, and corrupted entries are
+//   ignored.
+// - Entries are written to a temporary file which is then renamed, so that a crash while persisting leaves either
+//   the previous entry or no entry.
+// - Once the entries take more than maxSizeInBytes, the least recently used ones are deleted. The entries
+//   BasePreparedScriptStoreImpl left in the same directory count as entries too, so that they are deleted first.
+class LruPreparedScriptStore : public facebook::jsi::PreparedScriptStore {
+ public:
+  static constexpr uint64_t DefaultMaxSizeInBytes = 64 * 1024 * 1024;
+
+  LruPreparedScriptStore(std::string storeDirectory, uint64_t maxSizeInBytes = DefaultMaxSizeInBytes)
+      : storeDirectory_(std::move(storeDirectory)), maxSizeInBytes_(maxSizeInBytes) {}
+
+  std::shared_ptr<const facebook::jsi::Buffer> tryGetPreparedScript(
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+      const char *prepareTag) noexcept override;
+
+  void persistPreparedScript(
+      std::shared_ptr<const facebook::jsi::Buffer> preparedScript,
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+      const char *prepareTag) noexcept override;
+
+  // The path of the entry for a script, relative to the store directory.
+  static std::string getEntryName(
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+      const char *prepareTag) noexcept;
+
+ private:
+  // Deletes the least recently used entries, other than keepEntryName, until the store fits in maxSizeInBytes_, along
+  // with the temporary files of writes that did not complete.
+  void evict(const std::string &keepEntryName) noexcept;
+
+  std::string storeDirectory_;
+  uint64_t maxSizeInBytes_;
+};
+
 // Dead simple script store implementation assuming that the script url is a
 // local filesystem path and assuming the script version is the script size, but
 // with extension point to provide custom version provider.
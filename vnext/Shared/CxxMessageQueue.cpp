@@ -5,6 +5,7 @@
 
 #include <folly/AtomicIntrusiveLinkedList.h>
 
+#include <deque>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -29,15 +30,19 @@ time_point now() {
 class Task {
  public:
   static Task *create(std::function<void()> &&func) {
-    return new Task{std::move(func), false, time_point()};
+    return new Task{std::move(func), false, false, time_point()};
   }
 
   static Task *createSync(std::function<void()> &&func) {
-    return new Task{std::move(func), true, time_point()};
+    return new Task{std::move(func), true, false, time_point()};
   }
 
   static Task *createDelayed(std::function<void()> &&func, time_point startTime) {
-    return new Task{std::move(func), false, startTime};
+    return new Task{std::move(func), false, false, startTime};
+  }
+
+  static Task *createIdle(std::function<void()> &&func) {
+    return new Task{std::move(func), false, true, time_point()};
   }
 
   std::function<void()> func;
@@ -46,6 +51,8 @@ class Task {
   // the synchronous task might never resume. We use this flag to detect this
   // case and throw an error.
   bool sync;
+  // Idle tasks run only when there is no other work for the queue.
+  bool idle;
   time_point startTime;
 
   folly::AtomicIntrusiveLinkedListHook<Task> hook;
@@ -58,8 +65,14 @@ class Task {
   };
 };
 
+// Delayed tasks are pushed by any thread and processed by the runloop thread.
+// To avoid waking up the runloop thread once per delayed task, the queue
+// remembers the time the runloop thread waits for, and push() asks to wake it
+// up only if the new task must run before that time.
 class DelayedTaskQueue {
  public:
+  explicit DelayedTaskQueue(clock::duration slack) : slack_(slack) {}
+
   ~DelayedTaskQueue() {
     while (!queue_.empty()) {
       delete queue_.top();
@@ -67,38 +80,72 @@ class DelayedTaskQueue {
     }
   }
 
+  // Returns true if the runloop thread must be woken up to run the task in time.
+  bool push(Task *t) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    queue_.push(t);
+    nextStartTime_.store(queue_.top()->startTime.time_since_epoch().count(), std::memory_order_relaxed);
+    return t->startTime + slack_ < waitTime_;
+  }
+
   void process() {
-    while (!queue_.empty()) {
-      Task *d = queue_.top();
-      if (now() < d->startTime) {
-        break;
-      }
-      auto owned = std::unique_ptr<Task>(queue_.top());
-      queue_.pop();
+    // Avoid taking the lock when no delayed task is due.
+    time_point currentTime = now();
+    if (currentTime.time_since_epoch().count() < nextStartTime_.load(std::memory_order_relaxed)) {
+      return;
+    }
+
+    while (auto owned = std::unique_ptr<Task>(popDue(currentTime))) {
       owned->func();
     }
   }
 
-  void push(Task *t) {
-    queue_.push(t);
+  // Returns the time when the runloop thread must wake up to run delayed tasks.
+  // All delayed tasks that start within the slack window after the first one
+  // are run on the same wakeup.
+  time_point beginWait() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    waitTime_ = queue_.empty() ? time_point::max() : queue_.top()->startTime + slack_;
+    return waitTime_;
   }
 
-  bool empty() {
-    return queue_.empty();
+  void endWait() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    waitTime_ = time_point::min();
   }
 
-  time_point nextTime() {
-    return queue_.top()->startTime;
+ private:
+  Task *popDue(time_point currentTime) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (queue_.empty() || currentTime < queue_.top()->startTime) {
+      return nullptr;
+    }
+
+    Task *t = queue_.top();
+    queue_.pop();
+    nextStartTime_.store(
+        queue_.empty() ? time_point::max().time_since_epoch().count()
+                       : queue_.top()->startTime.time_since_epoch().count(),
+        std::memory_order_relaxed);
+    return t;
   }
 
- private:
+  const clock::duration slack_;
+  std::mutex mtx_;
   std::priority_queue<Task *, std::vector<Task *>, Task::Compare> queue_;
+  // The time the runloop thread waits for. It is time_point::min() while the
+  // runloop thread is not waiting: it checks the queue before the next wait.
+  time_point waitTime_{time_point::min()};
+  // Start time of the first task. It is read without the lock as a hint.
+  std::atomic<clock::rep> nextStartTime_{time_point::max().time_since_epoch().count()};
 };
 
 } // namespace
 
 class CxxMessageQueue::QueueRunner {
  public:
+  explicit QueueRunner(clock::duration delayedTaskSlack) : delayed_(delayedTaskSlack) {}
+
   ~QueueRunner() {
     queue_.sweep([](Task *t) { delete t; });
   }
@@ -109,12 +156,20 @@ class CxxMessageQueue::QueueRunner {
 
   void enqueueDelayed(std::function<void()> &&func, uint64_t delayMs) {
     if (delayMs) {
-      enqueueTask(Task::createDelayed(std::move(func), now() + std::chrono::milliseconds(delayMs)));
+      // Delayed tasks bypass the posted tasks, so that posting them does not
+      // wake up the runloop thread unless they are due before its next wakeup.
+      if (delayed_.push(Task::createDelayed(std::move(func), now() + std::chrono::milliseconds(delayMs)))) {
+        pending_.set();
+      }
     } else {
       enqueue(std::move(func));
     }
   }
 
+  void enqueueIdle(std::function<void()> &&func) {
+    enqueueTask(Task::createIdle(std::move(func)));
+  }
+
   void enqueueSync(std::function<void()> &&func) {
     EventFlag done;
     enqueueTask(Task::createSync([&]() mutable {
@@ -152,11 +207,21 @@ class CxxMessageQueue::QueueRunner {
     // matter reading stopped_.
     while (!stopped_.load(std::memory_order_relaxed)) {
       sweep();
-      if (delayed_.empty()) {
+      if (!idle_.empty() && queue_.empty()) {
+        auto owned = std::move(idle_.front());
+        idle_.pop_front();
+        owned->func();
+        continue;
+      }
+
+      time_point waitTime = delayed_.beginWait();
+      if (waitTime == time_point::max()) {
         pending_.wait();
       } else {
-        pending_.wait_until(delayed_.nextTime());
+        pending_.wait_until(waitTime);
       }
+      delayed_.endWait();
+      wakeupCount_.fetch_add(1, std::memory_order_relaxed);
     }
     // This sweep is just to catch erroneous enqueueSync. That is, there could
     // be a task marked sync that another thread is waiting for, but we'll
@@ -165,10 +230,10 @@ class CxxMessageQueue::QueueRunner {
     finished_.set();
   }
 
-  // We are processing two queues, the posted tasks (queue_) and the delayed
-  // tasks (delayed_). Delayed tasks first go into posted tasks, and then are
-  // moved to the delayed queue if we pop them before the time they are
-  // scheduled for.
+  // We are processing three queues: the posted tasks (queue_), the delayed
+  // tasks (delayed_) and the idle tasks (idle_). Idle tasks first go into
+  // posted tasks, and then are moved to the idle tasks to run when there is
+  // nothing else to do.
   // As we pop things from queue_, before dealing with that thing, we run any
   // delayed tasks whose scheduled time has arrived.
   void sweep() {
@@ -182,8 +247,8 @@ class CxxMessageQueue::QueueRunner {
       }
 
       delayed_.process();
-      if (t->startTime != time_point() && now() <= t->startTime) {
-        delayed_.push(owned.release());
+      if (t->idle) {
+        idle_.push_back(std::move(owned));
       } else {
         t->func();
       }
@@ -202,6 +267,10 @@ class CxxMessageQueue::QueueRunner {
     return std::this_thread::get_id() == tid_;
   }
 
+  uint64_t wakeupCount() {
+    return wakeupCount_.load(std::memory_order_relaxed);
+  }
+
  private:
   void enqueueTask(Task *task) {
     if (queue_.insertHead(task)) {
@@ -215,12 +284,17 @@ class CxxMessageQueue::QueueRunner {
 
   std::atomic_bool stopped_{false};
   DelayedTaskQueue delayed_;
+  std::deque<std::unique_ptr<Task>> idle_;
 
   BinarySemaphore pending_;
   EventFlag finished_;
+  std::atomic<uint64_t> wakeupCount_{0};
 };
 
-CxxMessageQueue::CxxMessageQueue() : qr_(new QueueRunner()) {}
+CxxMessageQueue::CxxMessageQueue() : CxxMessageQueue(std::chrono::milliseconds::zero()) {}
+
+CxxMessageQueue::CxxMessageQueue(std::chrono::milliseconds delayedTaskSlack)
+    : qr_(new QueueRunner(delayedTaskSlack)) {}
 
 CxxMessageQueue::~CxxMessageQueue() {
   // TODO(@cjhopman): Add detach() so that the queue doesn't have to be
@@ -238,6 +312,10 @@ void CxxMessageQueue::runOnQueueDelayed(std::function<void()> &&func, uint64_t d
   qr_->enqueueDelayed(std::move(func), delayMs);
 }
 
+void CxxMessageQueue::runOnQueueIdle(std::function<void()> &&func) {
+  qr_->enqueueIdle(std::move(func));
+}
+
 void CxxMessageQueue::runOnQueueSync(std::function<void()> &&func) {
   if (isOnQueue()) {
     func();
@@ -258,6 +336,10 @@ bool CxxMessageQueue::isOnQueue() {
   return qr_->isOnQueue();
 }
 
+uint64_t CxxMessageQueue::wakeupCount() {
+  return qr_->wakeupCount();
+}
+
 namespace {
 struct MQRegistry {
   std::weak_ptr<CxxMessageQueue> find(std::thread::id tid) {
@@ -54,9 +54,17 @@ using EventFlag = CVFlag<false>;
 class CxxMessageQueue : public MessageQueueThread {
  public:
   CxxMessageQueue();
+  // Delayed tasks that become due within delayedTaskSlack of each other run on
+  // a single wakeup of the queue thread. A delayed task may run up to
+  // delayedTaskSlack after its scheduled time.
+  explicit CxxMessageQueue(std::chrono::milliseconds delayedTaskSlack);
   virtual ~CxxMessageQueue() override;
   virtual void runOnQueue(std::function<void()> &&) override;
   void runOnQueueDelayed(std::function<void()> &&, uint64_t delayMs);
+  // Runs the function when the queue has no other work to do. Idle tasks run
+  // one at a time, so that posted tasks and due delayed tasks are not blocked
+  // by them. Idle tasks that have not run before the queue stops are dropped.
+  void runOnQueueIdle(std::function<void()> &&);
   // runOnQueueSync and quitSynchronous are dangerous.  They should only be
   // used for initialization and cleanup.
   virtual void runOnQueueSync(std::function<void()> &&) override;
@@ -65,6 +73,9 @@ class CxxMessageQueue : public MessageQueueThread {
 
   bool isOnQueue();
 
+  // The number of times the queue thread woke up after waiting for work.
+  uint64_t wakeupCount();
+
   // This returns a function that will actually run the runloop.
   // This runloop will return some time after quitSynchronous (or after this is
   // destroyed).
@@ -0,0 +1,346 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "BinaryBridgeFraming.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+enum ValueTag : uint8_t {
+  Null = 0,
+  False = 1,
+  True = 2,
+  Int = 3,
+  Double = 4,
+  String = 5,
+  InternedStringDefinition = 6,
+  InternedStringReference = 7,
+  Array = 8,
+  Object = 9,
+};
+
+constexpr size_t FrameHeaderSize = 4;
+
+// Interns the field names of a request, the strings of its fields, such as the url of executeApplicationScript, and
+// the strings of the arguments of its method, such as the module and method names of callFunctionReturnFlushedQueue,
+// but not the strings of the arguments passed on to JavaScript.
+constexpr int RequestInternDepth = 3;
+
+// Deeper values are rejected rather than risking the reader's stack.
+constexpr int MaxValueDepth = 128;
+
+void WriteVarint(std::string &buffer, uint64_t value) {
+  while (value >= 0x80) {
+    buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  buffer.push_back(static_cast<char>(value));
+}
+
+void WriteTag(std::string &buffer, uint8_t tag) {
+  buffer.push_back(static_cast<char>(tag));
+}
+
+// Reserves the frame header, returning its offset for FinishFrame.
+size_t BeginFrame(std::string &buffer, BinaryFrameKind kind) {
+  auto start = buffer.size();
+  buffer.append(FrameHeaderSize, '\0');
+  WriteTag(buffer, static_cast<uint8_t>(kind));
+  return start;
+}
+
+void FinishFrame(std::string &buffer, size_t start) {
+  auto length = buffer.size() - start - FrameHeaderSize;
+  if (length > UINT32_MAX) {
+    throw std::length_error("Binary frame is too large.");
+  }
+  for (size_t i = 0; i < FrameHeaderSize; ++i) {
+    buffer[start + i] = static_cast<char>((length >> (8 * i)) & 0xff);
+  }
+}
+
+[[noreturn]] void ThrowMalformed(const char *what) {
+  throw std::runtime_error(std::string("Malformed binary frame: ") + what);
+}
+
+uint8_t ReadByte(std::string_view data, size_t &offset) {
+  if (offset >= data.size()) {
+    ThrowMalformed("unexpected end of frame");
+  }
+  return static_cast<uint8_t>(data[offset++]);
+}
+
+uint64_t ReadVarint(std::string_view data, size_t &offset) {
+  uint64_t value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    auto byte = ReadByte(data, offset);
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      return value;
+    }
+  }
+  ThrowMalformed("varint is too long");
+}
+
+// Reads a count of items that each take at least one byte, so that a corrupt count cannot make the reader reserve
+// more than the frame holds.
+size_t ReadCount(std::string_view data, size_t &offset) {
+  auto count = ReadVarint(data, offset);
+  if (count > data.size() - offset) {
+    ThrowMalformed("count is larger than the frame");
+  }
+  return static_cast<size_t>(count);
+}
+
+} // namespace
+
+void BinaryFrameWriter::WriteRequest(
+    std::string &buffer,
+    int id,
+    std::string_view method,
+    const folly::dynamic &fields) {
+  auto start = BeginFrame(buffer, BinaryFrameKind::Request);
+  try {
+    WriteVarint(buffer, static_cast<uint32_t>(id));
+    WriteString(buffer, method, true);
+    WriteValue(buffer, fields, RequestInternDepth);
+    FinishFrame(buffer, start);
+  } catch (...) {
+    AbandonFrame(buffer, start);
+    throw;
+  }
+  CommitFrame();
+}
+
+void BinaryFrameWriter::WriteReply(std::string &buffer, int replyId, const folly::dynamic &result) {
+  auto start = BeginFrame(buffer, BinaryFrameKind::Reply);
+  try {
+    WriteVarint(buffer, static_cast<uint32_t>(replyId));
+    WriteValue(buffer, result, 0);
+    FinishFrame(buffer, start);
+  } catch (...) {
+    AbandonFrame(buffer, start);
+    throw;
+  }
+  CommitFrame();
+}
+
+void BinaryFrameWriter::CommitFrame() noexcept {
+  m_internedStrings.merge(m_frameStrings);
+}
+
+void BinaryFrameWriter::AbandonFrame(std::string &buffer, size_t start) noexcept {
+  m_frameStrings.clear();
+  buffer.resize(start);
+}
+
+void BinaryFrameWriter::WriteValue(std::string &buffer, const folly::dynamic &value, int internDepth) {
+  switch (value.type()) {
+    case folly::dynamic::NULLT:
+      WriteTag(buffer, ValueTag::Null);
+      break;
+    case folly::dynamic::BOOL:
+      WriteTag(buffer, value.getBool() ? ValueTag::True : ValueTag::False);
+      break;
+    case folly::dynamic::INT64: {
+      auto n = value.getInt();
+      WriteTag(buffer, ValueTag::Int);
+      WriteVarint(buffer, (static_cast<uint64_t>(n) << 1) ^ static_cast<uint64_t>(n >> 63));
+      break;
+    }
+    case folly::dynamic::DOUBLE: {
+      auto d = value.getDouble();
+      uint64_t bits;
+      std::memcpy(&bits, &d, sizeof(bits));
+      WriteTag(buffer, ValueTag::Double);
+      for (int i = 0; i < 8; ++i) {
+        buffer.push_back(static_cast<char>((bits >> (8 * i)) & 0xff));
+      }
+      break;
+    }
+    case folly::dynamic::STRING:
+      WriteString(buffer, value.stringPiece(), internDepth > 0);
+      break;
+    case folly::dynamic::ARRAY:
+      WriteTag(buffer, ValueTag::Array);
+      WriteVarint(buffer, value.size());
+      for (const auto &item : value) {
+        WriteValue(buffer, item, internDepth - 1);
+      }
+      break;
+    case folly::dynamic::OBJECT:
+      WriteTag(buffer, ValueTag::Object);
+      WriteVarint(buffer, value.size());
+      for (const auto &[key, item] : value.items()) {
+        if (!key.isString()) {
+          throw std::invalid_argument("Binary frames only support string keys.");
+        }
+        WriteString(buffer, key.stringPiece(), internDepth > 0);
+        WriteValue(buffer, item, internDepth - 1);
+      }
+      break;
+  }
+}
+
+void BinaryFrameWriter::WriteString(std::string &buffer, std::string_view value, bool intern) {
+  if (intern && value.size() <= MaxInternedStringLength) {
+    std::string key(value);
+    auto it = m_internedStrings.find(key);
+    auto interned = it != m_internedStrings.end();
+    if (!interned) {
+      it = m_frameStrings.find(key);
+      interned = it != m_frameStrings.end();
+    }
+    if (interned) {
+      WriteTag(buffer, ValueTag::InternedStringReference);
+      WriteVarint(buffer, it->second);
+      return;
+    }
+
+    auto count = m_internedStrings.size() + m_frameStrings.size();
+    if (count < MaxInternedStrings) {
+      m_frameStrings.emplace(std::move(key), static_cast<uint32_t>(count));
+      WriteTag(buffer, ValueTag::InternedStringDefinition);
+      WriteVarint(buffer, value.size());
+      buffer.append(value);
+      return;
+    }
+  }
+
+  WriteTag(buffer, ValueTag::String);
+  WriteVarint(buffer, value.size());
+  buffer.append(value);
+}
+
+bool BinaryFrameReader::ReadFrame(std::string_view data, size_t &offset, BinaryFrame &frame) {
+  if (offset >= data.size()) {
+    return false;
+  }
+  if (data.size() - offset < FrameHeaderSize) {
+    ThrowMalformed("truncated header");
+  }
+
+  uint32_t length = 0;
+  for (size_t i = 0; i < FrameHeaderSize; ++i) {
+    length |= static_cast<uint32_t>(static_cast<uint8_t>(data[offset + i])) << (8 * i);
+  }
+  if (length > data.size() - offset - FrameHeaderSize) {
+    ThrowMalformed("truncated body");
+  }
+
+  auto body = data.substr(offset + FrameHeaderSize, length);
+  size_t bodyOffset = 0;
+  auto kind = ReadByte(body, bodyOffset);
+  if (kind != static_cast<uint8_t>(BinaryFrameKind::Request) && kind != static_cast<uint8_t>(BinaryFrameKind::Reply)) {
+    ThrowMalformed("unknown frame kind");
+  }
+
+  frame.Kind = static_cast<BinaryFrameKind>(kind);
+  frame.Id = static_cast<int>(static_cast<uint32_t>(ReadVarint(body, bodyOffset)));
+  frame.Method = frame.Kind == BinaryFrameKind::Request ? ReadString(body, bodyOffset) : std::string();
+  frame.Value = ReadValue(body, bodyOffset, 0);
+  if (bodyOffset != body.size()) {
+    ThrowMalformed("trailing bytes");
+  }
+
+  offset += FrameHeaderSize + length;
+  return true;
+}
+
+folly::dynamic BinaryFrameReader::ReadValue(std::string_view data, size_t &offset, int depth) {
+  if (depth > MaxValueDepth) {
+    ThrowMalformed("value is nested too deeply");
+  }
+
+  auto tag = ReadByte(data, offset);
+  switch (tag) {
+    case ValueTag::Null:
+      return nullptr;
+    case ValueTag::False:
+      return false;
+    case ValueTag::True:
+      return true;
+    case ValueTag::Int: {
+      auto zigzag = ReadVarint(data, offset);
+      return static_cast<int64_t>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+    }
+    case ValueTag::Double: {
+      if (data.size() - offset < 8) {
+        ThrowMalformed("truncated double");
+      }
+      uint64_t bits = 0;
+      for (int i = 0; i < 8; ++i) {
+        bits |= static_cast<uint64_t>(static_cast<uint8_t>(data[offset + i])) << (8 * i);
+      }
+      offset += 8;
+      double d;
+      std::memcpy(&d, &bits, sizeof(d));
+      return d;
+    }
+    case ValueTag::String:
+    case ValueTag::InternedStringDefinition:
+    case ValueTag::InternedStringReference:
+      return ReadString(data, offset, tag);
+    case ValueTag::Array: {
+      auto count = ReadCount(data, offset);
+      folly::dynamic array = folly::dynamic::array;
+      array.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        array.push_back(ReadValue(data, offset, depth + 1));
+      }
+      return array;
+    }
+    case ValueTag::Object: {
+      auto count = ReadCount(data, offset);
+      folly::dynamic object = folly::dynamic::object;
+      for (size_t i = 0; i < count; ++i) {
+        auto key = ReadString(data, offset);
+        object[std::move(key)] = ReadValue(data, offset, depth + 1);
+      }
+      return object;
+    }
+    default:
+      ThrowMalformed("unknown value tag");
+  }
+}
+
+std::string BinaryFrameReader::ReadString(std::string_view data, size_t &offset) {
+  return ReadString(data, offset, ReadByte(data, offset));
+}
+
+std::string BinaryFrameReader::ReadString(std::string_view data, size_t &offset, uint8_t tag) {
+  if (tag == ValueTag::InternedStringReference) {
+    auto index = ReadVarint(data, offset);
+    if (index >= m_internedStrings.size()) {
+      ThrowMalformed("unknown interned string");
+    }
+    return m_internedStrings[static_cast<size_t>(index)];
+  }
+
+  if (tag != ValueTag::String && tag != ValueTag::InternedStringDefinition) {
+    ThrowMalformed("expected a string");
+  }
+
+  auto length = ReadVarint(data, offset);
+  if (length > data.size() - offset) {
+    ThrowMalformed("truncated string");
+  }
+  std::string value(data.substr(offset, static_cast<size_t>(length)));
+  offset += static_cast<size_t>(length);
+
+  if (tag == ValueTag::InternedStringDefinition) {
+    if (m_internedStrings.size() >= BinaryFrameWriter::MaxInternedStrings) {
+      ThrowMalformed("too many interned strings");
+    }
+    m_internedStrings.push_back(value);
+  }
+  return value;
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <folly/dynamic.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// Compact binary framing of the messages WebSocketJSExecutor exchanges with the debugger proxy, used instead of JSON
+// text once the proxy accepted it in its reply to prepareJSRuntime.
+//
+//   frame   := length:u32le kind:u8 body       length covers kind and body
+//   request := id:varint method:string fields  kind 1; fields is the object of the JSON request without id and method
+//   reply   := replyId:varint result           kind 2; result is the value the JSON reply would carry as text
+//   value   := null | false | true | int:zigzag varint | double:f64le | string | array:count items | object:count
+//              (string value)*
+//   string  := tag len:varint utf8             plain, or interned: the string gets the next index of the table of
+//              strings received on the connection
+//            | tag index:varint                reference to an interned string
+//
+// The method name, the field names of requests and the strings directly in their values, such as the module and
+// method names of callFunctionReturnFlushedQueue, are interned, so that repeated calls send them as one or two bytes.
+constexpr int BinaryBridgeFramingVersion = 1;
+
+enum class BinaryFrameKind : uint8_t {
+  Request = 1,
+  Reply = 2,
+};
+
+struct BinaryFrame {
+  BinaryFrameKind Kind{BinaryFrameKind::Request};
+  // The request id, or the id of the request replied to.
+  int Id{0};
+  // Empty for replies.
+  std::string Method;
+  folly::dynamic Value;
+};
+
+// Writes the frames sent on one connection. Interned strings are numbered in the order they are first written, so the
+// frames must be read in the order they were written. A frame that fails to be written, such as for an object with a
+// key that is not a string, is removed from the buffer along with the strings it interned.
+class BinaryFrameWriter final {
+ public:
+  // The interned strings are limited in count and length, so that the string tables of both sides stay small.
+  static constexpr size_t MaxInternedStrings = 4096;
+  static constexpr size_t MaxInternedStringLength = 64;
+
+  void WriteRequest(std::string &buffer, int id, std::string_view method, const folly::dynamic &fields);
+  void WriteReply(std::string &buffer, int replyId, const folly::dynamic &result);
+
+ private:
+  void WriteValue(std::string &buffer, const folly::dynamic &value, int internDepth);
+  void WriteString(std::string &buffer, std::string_view value, bool intern);
+  void CommitFrame() noexcept;
+  void AbandonFrame(std::string &buffer, size_t start) noexcept;
+
+  std::unordered_map<std::string, uint32_t> m_internedStrings;
+  // The strings interned by the frame being written, added to m_internedStrings once it is written.
+  std::unordered_map<std::string, uint32_t> m_frameStrings;
+};
+
+// Reads the frames received on one connection. Throws std::runtime_error for a malformed frame.
+class BinaryFrameReader final {
+ public:
+  // Reads the frame at `offset` of `data` into `frame` and moves `offset` past it. Returns false at the end of `data`.
+  bool ReadFrame(std::string_view data, size_t &offset, BinaryFrame &frame);
+
+ private:
+  folly::dynamic ReadValue(std::string_view data, size_t &offset, int depth);
+  std::string ReadString(std::string_view data, size_t &offset);
+  std::string ReadString(std::string_view data, size_t &offset, uint8_t tag);
+
+  std::vector<std::string> m_internedStrings;
+};
+
+} // namespace Microsoft::ReactNative
@@ -3,6 +3,7 @@
 
 #include "pch.h"
 
+#include <CppRuntimeOptions.h>
 #include <Utils/CppWinrtLessExceptions.h>
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/RAMBundleRegistry.h>
@@ -34,7 +35,8 @@ WebSocketJSExecutor::WebSocketJSExecutor(
     : m_delegate(delegate),
       m_messageQueueThread(messageQueueThread),
       m_socket(),
-      m_socketDataWriter(m_socket.OutputStream()) {
+      m_socketDataWriter(m_socket.OutputStream()),
+      m_binaryFramingOffered(Microsoft::React::GetRuntimeOptionBool("WebSocketJSExecutor.BinaryFraming")) {
   m_msgReceived = m_socket.MessageReceived(winrt::auto_revoke, [this](auto &&, auto &&args) {
     try {
       if (auto reader = args.GetDataReader()) {
@@ -46,6 +48,14 @@ WebSocketJSExecutor::WebSocketJSExecutor(
 
           std::string str(Microsoft::Common::Utilities::CheckedReinterpretCast<char *>(data.data()), data.size());
           OnMessageReceived(str);
+        } else if (
+            args.MessageType() == winrt::Windows::Networking::Sockets::SocketMessageType::Binary && m_binaryFraming) {
+          uint32_t len = reader.UnconsumedBufferLength();
+          std::vector<uint8_t> data(len);
+          reader.ReadBytes(data);
+
+          OnBinaryMessageReceived(
+              std::string_view(Microsoft::Common::Utilities::CheckedReinterpretCast<char *>(data.data()), data.size()));
         } else {
           OnHitError("Unexpected MessageType from MessageWebSocket.");
         }
@@ -92,10 +102,8 @@ void WebSocketJSExecutor::loadBundle(
   }
 
   try {
-    folly::dynamic request = folly::dynamic::object("id", requestId)("method", "executeApplicationScript")(
-        "url", script->c_str())("inject", m_injectedObjects);
-    std::string str = folly::toJson(request);
-    std::string strReturn = SendMessageAsync(requestId, str).get();
+    folly::dynamic fields = folly::dynamic::object("url", script->c_str())("inject", m_injectedObjects);
+    SendMessageAsync(requestId, "executeApplicationScript", std::move(fields)).get();
   } catch (const std::exception &e) {
     OnHitError(e.what());
   }
@@ -115,14 +123,14 @@ void WebSocketJSExecutor::callFunction(
   folly::dynamic jarray = folly::dynamic::array(moduleId, methodId, arguments);
   auto calls = Call("callFunctionReturnFlushedQueue", jarray);
   if (m_delegate && !IsInError())
-    m_delegate->callNativeModules(*this, folly::parseJson(std::move(calls)), true);
+    m_delegate->callNativeModules(*this, ToNativeCalls(std::move(calls)), true);
 }
 
 void WebSocketJSExecutor::invokeCallback(const double callbackId, const folly::dynamic &arguments) {
   folly::dynamic jarray = folly::dynamic::array(callbackId, arguments);
   auto calls = Call("invokeCallbackAndReturnFlushedQueue", jarray);
   if (m_delegate && !IsInError())
-    m_delegate->callNativeModules(*this, folly::parseJson(std::move(calls)), true);
+    m_delegate->callNativeModules(*this, ToNativeCalls(std::move(calls)), true);
 }
 
 void WebSocketJSExecutor::setGlobalVariable(
@@ -150,26 +158,30 @@ void WebSocketJSExecutor::destroy() {
   SetState(State::Disposed);
 }
 
-std::string WebSocketJSExecutor::Call(const std::string &methodName, folly::dynamic &arguments) {
+folly::dynamic WebSocketJSExecutor::Call(const std::string &methodName, folly::dynamic &arguments) {
   int requestId = ++m_requestId;
 
   if (!IsRunning()) {
     OnHitError("Executor instance not connected to a WebSocket endpoint.");
-    return std::string();
+    return nullptr;
   }
 
   try {
-    folly::dynamic request =
-        folly::dynamic::object("id", requestId)("method", methodName)("arguments", std::move(arguments));
-    std::string str = folly::toJson(request);
-    std::string strReturn = SendMessageAsync(requestId, str).get();
-    return strReturn;
+    return SendMessageAsync(requestId, methodName, folly::dynamic::object("arguments", std::move(arguments))).get();
   } catch (const std::exception &e) {
     OnHitError(e.what());
-    return std::string();
+    return nullptr;
   }
 }
 
+folly::dynamic WebSocketJSExecutor::ToNativeCalls(folly::dynamic &&result) {
+  // The JSON framing carries the flushed queue as JSON text, the binary framing as a value.
+  if (result.isString()) {
+    return folly::parseJson(result.getString());
+  }
+  return std::move(result);
+}
+
 void WebSocketJSExecutor::OnHitError(std::string message) {
   if (m_errorCallback != nullptr)
     m_errorCallback(message);
@@ -223,10 +235,13 @@ bool WebSocketJSExecutor::PrepareJavaScriptRuntime(int milliseconds) {
 
   int requestId = ++m_requestId;
 
-  folly::dynamic request = folly::dynamic::object("id", requestId)("method", "prepareJSRuntime");
-  std::string str = folly::toJson(request);
+  folly::dynamic fields = folly::dynamic::object;
+  if (m_binaryFramingOffered) {
+    fields["binaryFraming"] = BinaryBridgeFramingVersion;
+  }
 
-  return SendMessageAsync(requestId, std::move(str)).wait_for(timeout) == std::future_status::ready;
+  return SendMessageAsync(requestId, "prepareJSRuntime", std::move(fields)).wait_for(timeout) ==
+      std::future_status::ready;
 }
 
 void WebSocketJSExecutor::PollPrepareJavaScriptRuntime() {
@@ -242,13 +257,23 @@ void WebSocketJSExecutor::PollPrepareJavaScriptRuntime() {
   });
 }
 
-std::future<std::string> WebSocketJSExecutor::SendMessageAsync(int requestId, const std::string &message) {
+std::future<folly::dynamic>
+WebSocketJSExecutor::SendMessageAsync(int requestId, const std::string &method, folly::dynamic fields) {
   std::lock_guard<std::mutex> lock(m_lockPromises);
-  auto it = m_promises.emplace(requestId, std::promise<std::string>()).first;
+  auto it = m_promises.emplace(requestId, std::promise<folly::dynamic>()).first;
   auto future = it->second.get_future();
 
   if (!IsDisposed()) {
-    m_socket.Control().MessageType(winrt::Windows::Networking::Sockets::SocketMessageType::Utf8);
+    std::string message;
+    if (m_binaryFraming) {
+      m_frameWriter.WriteRequest(message, requestId, method, fields);
+      m_socket.Control().MessageType(winrt::Windows::Networking::Sockets::SocketMessageType::Binary);
+    } else {
+      fields["id"] = requestId;
+      fields["method"] = method;
+      message = folly::toJson(fields);
+      m_socket.Control().MessageType(winrt::Windows::Networking::Sockets::SocketMessageType::Utf8);
+    }
 
     winrt::array_view<const uint8_t> arr(
         Microsoft::Common::Utilities::CheckedReinterpretCast<const uint8_t *>(message.c_str()),
@@ -260,7 +285,7 @@ std::future<std::string> WebSocketJSExecutor::SendMessageAsync(int requestId, co
     auto promise(std::move(it->second));
     m_promises.erase(it);
 
-    promise.set_value("");
+    promise.set_value(nullptr);
   }
 
   return future;
@@ -272,23 +297,44 @@ void WebSocketJSExecutor::OnMessageReceived(const std::string &msg) {
   if (it_parsed != parsed.items().end()) {
     int replyId = static_cast<int>(it_parsed->second.asInt());
 
-    std::lock_guard<std::mutex> lock(m_lockPromises);
-    auto it_promise = m_promises.find(replyId);
-    if (it_promise != m_promises.end()) {
-      auto promise(std::move(it_promise->second));
-      m_promises.erase(it_promise);
+    // A proxy supporting binary framing accepts it in its reply to prepareJSRuntime, and sends binary messages from
+    // then on.
+    auto it_framing = parsed.find("binaryFraming");
+    if (m_binaryFramingOffered && it_framing != parsed.items().end() &&
+        it_framing->second == BinaryBridgeFramingVersion) {
+      std::lock_guard<std::mutex> lock(m_lockPromises);
+      m_binaryFraming = true;
+    }
+
+    it_parsed = parsed.find("result");
+    if (it_parsed != parsed.items().end() && it_parsed->second.isString()) {
+      ResolvePromise(replyId, std::move(it_parsed->second));
+    } else {
+      ResolvePromise(replyId, "");
+    }
+  }
+}
 
-      it_parsed = parsed.find("result");
-      if (it_parsed != parsed.items().end() && it_parsed->second.isString()) {
-        std::string result = it_parsed->second.asString();
-        promise.set_value(result);
-      } else {
-        promise.set_value("");
-      }
+void WebSocketJSExecutor::OnBinaryMessageReceived(std::string_view data) {
+  BinaryFrame frame;
+  size_t offset = 0;
+  while (m_frameReader.ReadFrame(data, offset, frame)) {
+    if (frame.Kind == BinaryFrameKind::Reply) {
+      ResolvePromise(frame.Id, std::move(frame.Value));
     }
   }
 }
 
+void WebSocketJSExecutor::ResolvePromise(int replyId, folly::dynamic &&result) {
+  std::lock_guard<std::mutex> lock(m_lockPromises);
+  auto it_promise = m_promises.find(replyId);
+  if (it_promise != m_promises.end()) {
+    auto promise(std::move(it_promise->second));
+    m_promises.erase(it_promise);
+    promise.set_value(std::move(result));
+  }
+}
+
 } // namespace Microsoft::ReactNative
 
 #pragma warning(pop)
@@ -9,8 +9,10 @@
 #include <cxxreact/MessageQueueThread.h>
 
 #include <WebSocketJSExecutorFactory.h>
+#include "BinaryBridgeFraming.h"
 
 #include <memory>
+#include <string_view>
 #include <unordered_map>
 
 #include <winrt/Windows.Networking.Sockets.h>
@@ -69,9 +71,12 @@ class WebSocketJSExecutor : public facebook::react::JSExecutor,
  private:
   bool PrepareJavaScriptRuntime(int milliseconds);
   void PollPrepareJavaScriptRuntime();
-  std::string Call(const std::string &methodName, folly::dynamic &arguments);
-  std::future<std::string> SendMessageAsync(int requestId, const std::string &message);
+  folly::dynamic Call(const std::string &methodName, folly::dynamic &arguments);
+  folly::dynamic ToNativeCalls(folly::dynamic &&result);
+  std::future<folly::dynamic> SendMessageAsync(int requestId, const std::string &method, folly::dynamic fields);
   void OnMessageReceived(const std::string &msg);
+  void OnBinaryMessageReceived(std::string_view data);
+  void ResolvePromise(int replyId, folly::dynamic &&result);
 
   void SetState(State state) noexcept {
     m_state = state;
@@ -110,7 +115,16 @@ class WebSocketJSExecutor : public facebook::react::JSExecutor,
   folly::dynamic m_injectedObjects = folly::dynamic::object;
 
   std::mutex m_lockPromises;
-  std::unordered_map<int, std::promise<std::string>> m_promises;
+  // In JSON framing, the promise of a request gets the "result" text of its reply. In binary framing, it gets the
+  // decoded result.
+  std::unordered_map<int, std::promise<folly::dynamic>> m_promises;
+
+  // Binary framing is offered to the proxy in prepareJSRuntime when the WebSocketJSExecutor.BinaryFraming runtime
+  // option is set, and used once the proxy accepted it. Proxies that do not know about it keep using JSON.
+  bool m_binaryFramingOffered{false};
+  std::atomic<bool> m_binaryFraming{false};
+  BinaryFrameWriter m_frameWriter; // Guarded by m_lockPromises.
+  BinaryFrameReader m_frameReader; // Only used by the MessageReceived handler.
 
   State m_state = State::Disconnected;
   std::function<void(std::string)> m_errorCallback;
@@ -7,18 +7,28 @@
 #include <winrt/base.h>
 
 // Standard Library
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace Microsoft::React {
 
+/// <summary>
+/// Contiguous blob content and the storage it points into.
+/// The content stays valid as long as Owner is held, even if the blob is removed or moved to other storage.
+/// </summary>
+struct BlobContent {
+  std::shared_ptr<void const> Owner;
+  winrt::array_view<uint8_t const> Data;
+};
+
 struct IBlobPersistor {
   ///
   /// <exception cref="std::invalid_argument">
   /// When an entry for blobId cannot be found.
   /// </exception>
   ///
-  virtual winrt::array_view<uint8_t const> ResolveMessage(std::string &&blobId, int64_t offset, int64_t size) = 0;
+  virtual BlobContent ResolveMessage(std::string &&blobId, int64_t offset, int64_t size) = 0;
 
   virtual void RemoveMessage(std::string &&blobId) noexcept = 0;
 
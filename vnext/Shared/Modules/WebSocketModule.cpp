@@ -10,6 +10,7 @@
 #include <Modules/CxxModuleUtilities.h>
 #include <Modules/IWebSocketModuleContentHandler.h>
 #include <ReactPropertyBag.h>
+#include <utilities.h>
 #include "Networking/NetworkPropertyIds.h"
 
 // fmt
@@ -19,9 +20,6 @@
 #include <cxxreact/Instance.h>
 #include <cxxreact/JsArgumentHelpers.h>
 
-// Windows API
-#include <winrt/Windows.Security.Cryptography.h>
-
 // Standard Library
 #include <iomanip>
 
@@ -43,7 +41,6 @@ using winrt::Microsoft::ReactNative::ReactPropertyBag;
 using winrt::Microsoft::ReactNative::ReactPropertyId;
 
 using winrt::Windows::Foundation::IInspectable;
-using winrt::Windows::Security::Cryptography::CryptographicBuffer;
 
 namespace {
 using Microsoft::React::IWebSocketModuleProxy;
@@ -63,6 +60,13 @@ WebSocketModuleSharedStatePropertyId() noexcept {
   return prop;
 }
 
+// Binary messages arrive encoded in Base64 by the resource.
+vector<uint8_t> DecodeBinaryMessage(const string &message) {
+  vector<uint8_t> bytes(Microsoft::React::Utilities::Base64DecodedMaxSize(message.size()));
+  bytes.resize(Microsoft::React::Utilities::DecodeBase64(message, bytes.data()).value_or(0));
+  return bytes;
+}
+
 static shared_ptr<IWebSocketResource>
 GetOrCreateWebSocket(int64_t id, string &&url, weak_ptr<WebSocketModule::SharedState> weakState) {
   auto state = weakState.lock();
@@ -131,10 +135,7 @@ GetOrCreateWebSocket(int64_t id, string &&url, weak_ptr<WebSocketModule::SharedS
 
           if (contentHandler) {
             if (isBinary) {
-              auto buffer = CryptographicBuffer::DecodeFromBase64String(winrt::to_hstring(message));
-              winrt::com_array<uint8_t> arr;
-              CryptographicBuffer::CopyToByteArray(buffer, arr);
-              auto data = vector<uint8_t>(arr.begin(), arr.end());
+              auto data = DecodeBinaryMessage(message);
 
               contentHandler->ProcessMessage(std::move(data), args);
             } else {
@@ -361,10 +362,7 @@ shared_ptr<IWebSocketResource> WebSocketTurboModule::CreateResource(int64_t id,
 
     if (contentHandler) {
       if (isBinary) {
-        auto buffer = CryptographicBuffer::DecodeFromBase64String(winrt::to_hstring(message));
-        winrt::com_array<uint8_t> arr;
-        CryptographicBuffer::CopyToByteArray(buffer, arr);
-        auto data = vector<uint8_t>(arr.begin(), arr.end());
+        auto data = DecodeBinaryMessage(message);
 
         contentHandler->ProcessMessage(std::move(data), args);
       } else {
@@ -0,0 +1,242 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CachingHttpFilter.h"
+
+#include "WinRTTypes.h"
+
+// Windows API
+#include <robuffer.h>
+#include <winrt/Windows.Foundation.Collections.h>
+#include <winrt/Windows.Security.Cryptography.h>
+#include <winrt/Windows.Storage.Streams.h>
+#include <winrt/Windows.Web.Http.Headers.h>
+
+// Standard Library
+#include <algorithm>
+#include <chrono>
+
+using std::shared_ptr;
+using std::string;
+using winrt::Windows::Foundation::Collections::IIterable;
+using winrt::Windows::Foundation::Collections::IKeyValuePair;
+using winrt::Windows::Security::Cryptography::CryptographicBuffer;
+using winrt::Windows::Storage::Streams::IBuffer;
+using winrt::Windows::Web::Http::HttpBufferContent;
+using winrt::Windows::Web::Http::HttpRequestMessage;
+using winrt::Windows::Web::Http::HttpResponseMessage;
+using winrt::Windows::Web::Http::HttpResponseMessageSource;
+using winrt::Windows::Web::Http::HttpStatusCode;
+using winrt::Windows::Web::Http::IHttpContent;
+using winrt::Windows::Web::Http::Filters::IHttpFilter;
+
+namespace Microsoft::React::Networking {
+
+namespace {
+
+// Exposes the memory mapped body of a cache entry as a buffer, without copying it.
+struct MappedBodyBuffer
+    : winrt::implements<MappedBodyBuffer, IBuffer, ::Windows::Storage::Streams::IBufferByteAccess> {
+  MappedBodyBuffer(HttpDiskCache::Entry const &entry) noexcept
+      : m_file{entry.File}, m_body{entry.Body}, m_size{static_cast<uint32_t>(entry.BodySize)}, m_length{m_size} {}
+
+  uint32_t Capacity() const noexcept {
+    return m_size;
+  }
+
+  uint32_t Length() const noexcept {
+    return m_length;
+  }
+
+  void Length(uint32_t value) {
+    if (value > m_size) {
+      throw winrt::hresult_invalid_argument{};
+    }
+    m_length = value;
+  }
+
+  HRESULT __stdcall Buffer(uint8_t **value) noexcept final {
+    // The mapping is read-only. Consumers of the content only read from it.
+    *value = const_cast<uint8_t *>(m_body);
+    return S_OK;
+  }
+
+ private:
+  shared_ptr<const facebook::jsi::Buffer> m_file;
+  const uint8_t *m_body;
+  uint32_t m_size;
+  uint32_t m_length;
+};
+
+int64_t SecondsSinceEpoch() noexcept {
+  return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+HttpCacheHeaders ToCacheHeaders(IIterable<IKeyValuePair<winrt::hstring, winrt::hstring>> const &headers) {
+  HttpCacheHeaders result;
+  for (const auto &header : headers) {
+    // HttpBufferContent computes the length of the body it is given.
+    if (_wcsicmp(header.Key().c_str(), L"Content-Length") != 0) {
+      result.emplace_back(winrt::to_string(header.Key()), winrt::to_string(header.Value()));
+    }
+  }
+  return result;
+}
+
+HttpCacheHeaders ToCacheHeaders(IHttpContent const &content) {
+  return content ? ToCacheHeaders(content.Headers()) : HttpCacheHeaders{};
+}
+
+HttpCachePolicy GetCachePolicy(HttpCacheEntry const &entry) noexcept {
+  // Expires and Last-Modified are content headers.
+  auto policy = HttpCachePolicy::Parse(entry.Headers);
+  for (const auto &header : entry.ContentHeaders) {
+    policy.Apply(header.first, header.second);
+  }
+  return policy;
+}
+
+// Dates the entry by the Age the server reported, rather than keeping the Age header, which gets stale on disk.
+void SetGeneratedAt(HttpCacheEntry &entry, int64_t receivedAt) noexcept {
+  entry.GeneratedAt = receivedAt - GetCachePolicy(entry).Age;
+  entry.Headers.erase(
+      std::remove_if(
+          entry.Headers.begin(),
+          entry.Headers.end(),
+          [](const std::pair<string, string> &header) { return _stricmp(header.first.c_str(), "Age") == 0; }),
+      entry.Headers.end());
+}
+
+HttpResponseMessage
+MakeCachedResponse(HttpRequestMessage const &request, HttpCacheEntry const &entry, IBuffer const &body) {
+  HttpResponseMessage response{HttpStatusCode::Ok};
+  response.RequestMessage(request);
+  response.Source(HttpResponseMessageSource::Cache);
+  for (const auto &header : entry.Headers) {
+    response.Headers().TryAppendWithoutValidation(winrt::to_hstring(header.first), winrt::to_hstring(header.second));
+  }
+
+  HttpBufferContent content{body};
+  for (const auto &header : entry.ContentHeaders) {
+    content.Headers().TryAppendWithoutValidation(winrt::to_hstring(header.first), winrt::to_hstring(header.second));
+  }
+  response.Content(content);
+
+  return response;
+}
+
+} // namespace
+
+#pragma region CachingHttpFilter
+
+CachingHttpFilter::CachingHttpFilter(shared_ptr<HttpDiskCache> cache, IHttpFilter const &innerFilter) noexcept
+    : m_cache{std::move(cache)}, m_innerFilter{innerFilter} {}
+
+ResponseOperation CachingHttpFilter::SendRequestAsync(HttpRequestMessage const &request) {
+  auto coRequest = request;
+  auto coCache = m_cache;
+  auto coInnerFilter = m_innerFilter;
+
+  // Inner filters may change the URI of the request when following redirects.
+  auto url = winrt::to_string(coRequest.RequestUri().AbsoluteUri());
+  auto method = coRequest.Method().Method();
+
+  if (method != L"GET") {
+    auto response = co_await coInnerFilter.SendRequestAsync(coRequest);
+
+    // Unsafe methods invalidate the stored response (RFC 9111, section 4.4).
+    if (method != L"HEAD" && method != L"OPTIONS" && response.IsSuccessStatusCode()) {
+      coCache->Remove(url);
+    }
+    co_return response;
+  }
+
+  if (!IsCacheableRequest(ToCacheHeaders(coRequest.Headers()))) {
+    co_return co_await coInnerFilter.SendRequestAsync(coRequest);
+  }
+
+  auto entry = coCache->Lookup(url);
+  if (entry) {
+    auto policy = GetCachePolicy(entry->Response);
+    if (policy.IsFresh(entry->Response.GeneratedAt, SecondsSinceEpoch())) {
+      coCache->RecordHit();
+      co_return MakeCachedResponse(coRequest, entry->Response, winrt::make<MappedBodyBuffer>(*entry));
+    }
+
+    if (policy.HasValidators()) {
+      if (!policy.ETag.empty()) {
+        coRequest.Headers().TryAppendWithoutValidation(L"If-None-Match", winrt::to_hstring(policy.ETag));
+      }
+      if (!policy.LastModified.empty()) {
+        coRequest.Headers().TryAppendWithoutValidation(L"If-Modified-Since", winrt::to_hstring(policy.LastModified));
+      }
+    } else {
+      entry.reset();
+    }
+  }
+
+  auto response = co_await coInnerFilter.SendRequestAsync(coRequest);
+  auto receivedAt = SecondsSinceEpoch();
+
+  if (entry && response.StatusCode() == HttpStatusCode::NotModified) {
+    coCache->RecordNotModified();
+
+    auto updated = std::move(entry->Response);
+    UpdateHttpCacheHeaders(updated.Headers, ToCacheHeaders(response.Headers()));
+    UpdateHttpCacheHeaders(updated.ContentHeaders, ToCacheHeaders(response.Content()));
+    SetGeneratedAt(updated, receivedAt);
+
+    // The entry is unmapped so that it can be replaced.
+    auto body = CryptographicBuffer::CreateFromByteArray({entry->Body, entry->Body + entry->BodySize});
+    entry.reset();
+    coCache->Store(updated, body.data(), body.Length());
+
+    co_return MakeCachedResponse(coRequest, updated, body);
+  }
+
+  entry.reset();
+  coCache->RecordMiss();
+
+  auto content = response.Content();
+  if (response.StatusCode() != HttpStatusCode::Ok || !content) {
+    co_return response;
+  }
+
+  auto requestMessage = response.RequestMessage();
+  if (requestMessage && winrt::to_string(requestMessage.RequestUri().AbsoluteUri()) != url) {
+    // Redirected. The response belongs to another URL.
+    co_return response;
+  }
+
+  HttpCacheEntry stored{url, 0, ToCacheHeaders(response.Headers()), ToCacheHeaders(content)};
+  SetGeneratedAt(stored, receivedAt);
+  auto contentLength = content.Headers().ContentLength();
+  if (!GetCachePolicy(stored).IsStorable(stored.GeneratedAt) || !contentLength ||
+      contentLength.GetUInt64() > coCache->MaxBodySize()) {
+    co_return response;
+  }
+
+  auto body = co_await content.ReadAsBufferAsync();
+  coCache->Store(stored, body.data(), body.Length());
+
+  // Content can only be read once, so the response gets new content over the body that was read.
+  HttpBufferContent bufferContent{body};
+  for (const auto &header : stored.ContentHeaders) {
+    bufferContent.Headers().TryAppendWithoutValidation(
+        winrt::to_hstring(header.first), winrt::to_hstring(header.second));
+  }
+  response.Content(bufferContent);
+
+  co_return response;
+}
+
+#pragma endregion CachingHttpFilter
+
+IHttpFilter MakeCachingHttpFilter(IHttpFilter const &innerFilter) noexcept {
+  if (auto cache = HttpDiskCache::Default()) {
+    return winrt::make<CachingHttpFilter>(std::move(cache), innerFilter);
+  }
+  return innerFilter;
+}
+
+} // namespace Microsoft::React::Networking
@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "HttpDiskCache.h"
+
+// Windows API
+#include <winrt/Windows.Web.Http.Filters.h>
+#include <winrt/Windows.Web.Http.h>
+
+// Standard Library
+#include <memory>
+
+namespace Microsoft::React::Networking {
+
+// Answers GET requests from an HttpDiskCache when its entry is fresh, revalidates stale entries with the server using
+// their ETag or Last-Modified validators, and stores the storable responses of the inner filter.
+class CachingHttpFilter : public winrt::implements<CachingHttpFilter, winrt::Windows::Web::Http::Filters::IHttpFilter> {
+  std::shared_ptr<HttpDiskCache> m_cache;
+  winrt::Windows::Web::Http::Filters::IHttpFilter m_innerFilter;
+
+ public:
+  CachingHttpFilter(
+      std::shared_ptr<HttpDiskCache> cache,
+      winrt::Windows::Web::Http::Filters::IHttpFilter const &innerFilter) noexcept;
+
+#pragma region IHttpFilter
+
+  winrt::Windows::Foundation::IAsyncOperationWithProgress<
+      winrt::Windows::Web::Http::HttpResponseMessage,
+      winrt::Windows::Web::Http::HttpProgress>
+  SendRequestAsync(winrt::Windows::Web::Http::HttpRequestMessage const &request);
+
+#pragma endregion IHttpFilter
+};
+
+// Wraps `innerFilter` in a CachingHttpFilter over HttpDiskCache::Default(), or returns it when the cache is disabled.
+winrt::Windows::Web::Http::Filters::IHttpFilter MakeCachingHttpFilter(
+    winrt::Windows::Web::Http::Filters::IHttpFilter const &innerFilter) noexcept;
+
+} // namespace Microsoft::React::Networking
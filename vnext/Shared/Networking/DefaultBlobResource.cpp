@@ -3,6 +3,7 @@
 
 #include "DefaultBlobResource.h"
 
+#include <CppRuntimeOptions.h>
 #include <Modules/IHttpModuleProxy.h>
 #include <Modules/IWebSocketModuleProxy.h>
 #include <utilities.h>
@@ -12,8 +13,12 @@
 #include <boost/uuid/uuid_io.hpp>
 
 // Windows API
+#include <windows.h>
 #include <winrt/Windows.Security.Cryptography.h>
 
+// Standard Library
+#include <algorithm>
+
 using std::scoped_lock;
 using std::shared_ptr;
 using std::string;
@@ -26,9 +31,125 @@ namespace msrn = winrt::Microsoft::ReactNative;
 
 namespace {
 
+using Microsoft::React::Networking::BlobSlice;
+using Microsoft::React::Networking::IBlobSegment;
+
 constexpr Microsoft::React::Networking::IBlobResource::BlobFieldNames
     blobKeys{"blob", "blobId", "offset", "size", "type", "data"};
 
+class MemoryBlobSegment final : public IBlobSegment {
+  vector<uint8_t> m_content;
+  shared_ptr<std::atomic<size_t>> m_residentSize;
+
+ public:
+  MemoryBlobSegment(vector<uint8_t> &&content, shared_ptr<std::atomic<size_t>> residentSize) noexcept
+      : m_content{std::move(content)}, m_residentSize{std::move(residentSize)} {
+    *m_residentSize += m_content.size();
+  }
+
+  ~MemoryBlobSegment() noexcept override {
+    *m_residentSize -= m_content.size();
+  }
+
+  uint8_t const *Data() const noexcept override {
+    return m_content.data();
+  }
+
+  size_t Size() const noexcept override {
+    return m_content.size();
+  }
+
+  bool IsResident() const noexcept override {
+    return true;
+  }
+};
+
+// Content written to a temporary file, which gets deleted once the segment is released.
+class MappedBlobSegment final : public IBlobSegment {
+  std::unique_ptr<void, decltype(&CloseHandle)> m_file;
+  std::unique_ptr<void, decltype(&CloseHandle)> m_fileMapping;
+  std::unique_ptr<void, decltype(&UnmapViewOfFile)> m_fileData;
+  size_t m_size;
+
+ public:
+  MappedBlobSegment(
+      std::unique_ptr<void, decltype(&CloseHandle)> &&file,
+      std::unique_ptr<void, decltype(&CloseHandle)> &&fileMapping,
+      std::unique_ptr<void, decltype(&UnmapViewOfFile)> &&fileData,
+      size_t size) noexcept
+      : m_file{std::move(file)}, m_fileMapping{std::move(fileMapping)}, m_fileData{std::move(fileData)}, m_size{size} {}
+
+  // Returns nullptr if the content cannot be written and mapped.
+  static shared_ptr<IBlobSegment const>
+  Create(std::wstring const &fileName, vector<BlobSlice> const &slices, size_t size) noexcept {
+    if (size == 0) {
+      return nullptr;
+    }
+
+    wchar_t tempPath[MAX_PATH + 1];
+    auto tempPathLength = GetTempPathW(MAX_PATH + 1, tempPath);
+    if (tempPathLength == 0 || tempPathLength > MAX_PATH) {
+      return nullptr;
+    }
+
+    CREATEFILE2_EXTENDED_PARAMETERS params{};
+    params.dwSize = sizeof(params);
+    params.dwFileAttributes = FILE_ATTRIBUTE_TEMPORARY;
+    params.dwFileFlags = FILE_FLAG_DELETE_ON_CLOSE;
+    auto filePath = std::wstring(tempPath, tempPathLength) + fileName;
+    std::unique_ptr<void, decltype(&CloseHandle)> file{
+        CreateFile2(filePath.c_str(), GENERIC_READ | GENERIC_WRITE, 0 /*dwShareMode*/, CREATE_NEW, &params),
+        &CloseHandle};
+    if (file.get() == INVALID_HANDLE_VALUE) {
+      file.release();
+      return nullptr;
+    }
+
+    constexpr size_t maxWriteSize = 1 << 30;
+    for (auto const &slice : slices) {
+      auto data = slice.Segment->Data() + slice.Offset;
+      auto remaining = slice.Size;
+      while (remaining > 0) {
+        DWORD written = 0;
+        if (!WriteFile(file.get(), data, static_cast<DWORD>(std::min(remaining, maxWriteSize)), &written, nullptr) ||
+            written == 0) {
+          return nullptr;
+        }
+
+        data += written;
+        remaining -= written;
+      }
+    }
+
+    std::unique_ptr<void, decltype(&CloseHandle)> fileMapping{
+        CreateFileMappingFromApp(file.get(), nullptr /*SecurityAttributes*/, PAGE_READONLY, size, nullptr /*Name*/),
+        &CloseHandle};
+    if (!fileMapping) {
+      return nullptr;
+    }
+
+    std::unique_ptr<void, decltype(&UnmapViewOfFile)> fileData{
+        MapViewOfFileFromApp(fileMapping.get(), FILE_MAP_READ, 0 /*FileOffset*/, size), &UnmapViewOfFile};
+    if (!fileData) {
+      return nullptr;
+    }
+
+    return std::make_shared<MappedBlobSegment>(std::move(file), std::move(fileMapping), std::move(fileData), size);
+  }
+
+  uint8_t const *Data() const noexcept override {
+    return static_cast<uint8_t const *>(m_fileData.get());
+  }
+
+  size_t Size() const noexcept override {
+    return m_size;
+  }
+
+  bool IsResident() const noexcept override {
+    return false;
+  }
+};
+
 } // namespace
 
 namespace Microsoft::React::Networking {
@@ -59,7 +180,11 @@ DefaultBlobResource::DefaultBlobResource(
 
   auto propBag = ReactPropertyBag{inspectableProperties.try_as<IReactPropertyBag>()};
 
-  auto blobPersistor = std::make_shared<MemoryBlobPersistor>();
+  auto memoryBudget = GetRuntimeOptionInt("Blob.MemoryBudget");
+  auto spillSize = GetRuntimeOptionInt("Blob.SpillSize");
+  auto blobPersistor = std::make_shared<MemoryBlobPersistor>(
+      memoryBudget > 0 ? static_cast<size_t>(memoryBudget) : MemoryBlobPersistor::DefaultMemoryBudget,
+      spillSize > 0 ? static_cast<size_t>(spillSize) : MemoryBlobPersistor::DefaultSpillSize);
   auto contentHandler = std::make_shared<BlobWebSocketModuleContentHandler>(blobPersistor);
   auto requestBodyHandler = std::make_shared<BlobModuleRequestBodyHandler>(blobPersistor);
   auto responseHandler = std::make_shared<BlobModuleResponseHandler>(blobPersistor);
@@ -84,47 +209,48 @@ void DefaultBlobResource::SendOverSocket(string &&blobId, int64_t offset, int64_
     return;
   }
 
-  array_view<uint8_t const> data;
+  BlobContent content;
   try {
-    data = m_blobPersistor->ResolveMessage(std::move(blobId), offset, size);
+    content = m_blobPersistor->ResolveMessage(std::move(blobId), offset, size);
   } catch (const std::exception &e) {
     return m_callbacks.OnError(e.what());
   }
 
-  auto chars = reinterpret_cast<const char *>(data.data());
-  auto view = std::string_view(chars, data.size());
+  auto chars = reinterpret_cast<const char *>(content.Data.data());
+  auto view = std::string_view(chars, content.Data.size());
   wsProxy->SendBinary(Utilities::EncodeBase64(view), socketId);
 }
 
 void DefaultBlobResource::CreateFromParts(msrn::JSValueArray &&parts, string &&blobId) noexcept /*override*/ {
-  vector<uint8_t> buffer{};
+  vector<BlobSlice> slices{};
+  slices.reserve(parts.size());
 
   for (const auto &partItem : parts) {
     auto &part = partItem.AsObject();
     auto type = part.at(blobKeys.Type).AsString();
     if (blobKeys.Blob == type) {
       auto &blob = part.at(blobKeys.Data).AsObject();
-      array_view<uint8_t const> bufferPart;
+      vector<BlobSlice> partSlices;
       try {
-        bufferPart = m_blobPersistor->ResolveMessage(
+        partSlices = m_blobPersistor->ResolveSlices(
             blob.at(blobKeys.BlobId).AsString(), blob.at(blobKeys.Offset).AsInt64(), blob.at(blobKeys.Size).AsInt64());
       } catch (const std::exception &e) {
         return m_callbacks.OnError(e.what());
       }
 
-      buffer.reserve(buffer.size() + bufferPart.size());
-      buffer.insert(buffer.end(), bufferPart.begin(), bufferPart.end());
+      // Blob parts reference the existing content instead of copying it.
+      slices.insert(
+          slices.end(), std::make_move_iterator(partSlices.begin()), std::make_move_iterator(partSlices.end()));
     } else if ("string" == type) {
-      auto data = part.at(blobKeys.Data).AsString();
+      auto &data = part.at(blobKeys.Data).AsString();
 
-      buffer.reserve(buffer.size() + data.size());
-      buffer.insert(buffer.end(), data.begin(), data.end());
+      slices.push_back(m_blobPersistor->CreateSlice(vector<uint8_t>(data.begin(), data.end())));
     } else {
       return m_callbacks.OnError("Invalid type for blob: " + type);
     }
   }
 
-  m_blobPersistor->StoreMessage(std::move(buffer), std::move(blobId));
+  m_blobPersistor->StoreSlices(std::move(slices), std::move(blobId));
 }
 
 void DefaultBlobResource::Release(string &&blobId) noexcept /*override*/ {
@@ -167,26 +293,225 @@ IBlobResource::BlobCallbacks &DefaultBlobResource::Callbacks() noexcept /*overri
 
 #pragma region MemoryBlobPersistor
 
-#pragma region IBlobPersistor
-
-array_view<uint8_t const> MemoryBlobPersistor::ResolveMessage(string &&blobId, int64_t offset, int64_t size) {
-  if (size < 1)
-    return {};
+MemoryBlobPersistor::MemoryBlobPersistor() noexcept : MemoryBlobPersistor(DefaultMemoryBudget, DefaultSpillSize) {}
 
-  scoped_lock lock{m_mutex};
+MemoryBlobPersistor::MemoryBlobPersistor(size_t memoryBudget, size_t spillSize) noexcept
+    : m_residentSize{std::make_shared<std::atomic<size_t>>(0)},
+      m_memoryBudget{memoryBudget},
+      m_spillSize{spillSize} {}
 
-  auto dataItr = m_blobs.find(std::move(blobId));
+MemoryBlobPersistor::Blob &MemoryBlobPersistor::FindBlob(string const &blobId, int64_t offset, int64_t size) {
+  auto dataItr = m_blobs.find(blobId);
   // Not found.
-  if (dataItr == m_blobs.cend())
+  if (dataItr == m_blobs.end())
     throw std::invalid_argument("Blob object not found");
 
-  auto &bytes = (*dataItr).second;
+  auto &blob = (*dataItr).second;
   auto endBound = static_cast<size_t>(offset + size);
   // Out of bounds.
-  if (endBound > bytes.size() || offset >= static_cast<int64_t>(bytes.size()) || offset < 0)
+  if (endBound > blob.Size || offset >= static_cast<int64_t>(blob.Size) || offset < 0)
     throw std::out_of_range("Offset or size out of range");
 
-  return array_view<uint8_t const>(bytes.data() + offset, bytes.data() + endBound);
+  blob.LastUse = ++m_useCount;
+  return blob;
+}
+
+void MemoryBlobPersistor::StoreBlob(vector<BlobSlice> &&slices, size_t size, string &&blobId) noexcept {
+  auto useCount = ++m_useCount;
+  m_blobs.insert_or_assign(std::move(blobId), Blob{std::move(slices), size, useCount, useCount});
+}
+
+void MemoryBlobPersistor::ReplaceSlices(string const &blobId, uint64_t generation, BlobSlice &&slice) noexcept {
+  // Skip blobs that were removed or replaced since their slices were read.
+  auto dataItr = m_blobs.find(blobId);
+  if (dataItr == m_blobs.end() || (*dataItr).second.Generation != generation)
+    return;
+
+  auto &blob = (*dataItr).second;
+  blob.Slices = {std::move(slice)};
+  blob.Generation = ++m_useCount;
+}
+
+size_t MemoryBlobPersistor::ReleasableSize(Blob const &blob) const noexcept {
+  // A resident segment is released along with the blob only if no other blob or resolved content references it.
+  std::unordered_map<IBlobSegment const *, long> references{};
+  for (auto const &slice : blob.Slices) {
+    if (slice.Segment->IsResident()) {
+      ++references[slice.Segment.get()];
+    }
+  }
+
+  size_t result = 0;
+  for (auto const &slice : blob.Slices) {
+    auto itr = references.find(slice.Segment.get());
+    if (itr != references.end() && slice.Segment.use_count() == (*itr).second) {
+      result += slice.Segment->Size();
+      references.erase(itr);
+    }
+  }
+
+  return result;
+}
+
+shared_ptr<IBlobSegment const> MemoryBlobPersistor::Spill(vector<BlobSlice> const &slices, size_t size) noexcept {
+  std::wstring fileName;
+  {
+    scoped_lock lock{m_mutex};
+    fileName = L"ReactNativeBlob-" + boost::uuids::to_wstring(m_guidGenerator()) + L".tmp";
+  }
+
+  return MappedBlobSegment::Create(fileName, slices, size);
+}
+
+size_t MemoryBlobPersistor::PrepareSlices(vector<BlobSlice> &slices) noexcept {
+  slices.erase(
+      std::remove_if(slices.begin(), slices.end(), [](BlobSlice const &slice) { return slice.Size == 0; }),
+      slices.end());
+  size_t size = 0;
+  for (auto const &slice : slices) {
+    size += slice.Size;
+  }
+
+  // Oversized blobs go straight to a temporary file.
+  if (size >= m_spillSize) {
+    if (auto segment = Spill(slices, size)) {
+      slices = {BlobSlice{std::move(segment), 0, size}};
+    }
+  }
+
+  return size;
+}
+
+void MemoryBlobPersistor::EnforceMemoryBudget() noexcept {
+  struct Candidate {
+    string BlobId;
+    uint64_t Generation;
+    vector<BlobSlice> Slices;
+    size_t Size;
+  };
+
+  vector<Candidate> candidates{};
+  {
+    scoped_lock lock{m_mutex};
+    if (*m_residentSize <= m_memoryBudget) {
+      return;
+    }
+
+    // Releasable sizes are computed before copying any slices, as copies add references.
+    struct Entry {
+      string const *BlobId;
+      Blob const *Value;
+      size_t ReleasableSize;
+    };
+    vector<Entry> entries{};
+    for (auto const &[blobId, blob] : m_blobs) {
+      if (auto releasableSize = ReleasableSize(blob)) {
+        entries.push_back(Entry{&blobId, &blob, releasableSize});
+      }
+    }
+
+    // Spill the least recently used blobs first.
+    std::sort(entries.begin(), entries.end(), [](Entry const &left, Entry const &right) {
+      return left.Value->LastUse < right.Value->LastUse;
+    });
+
+    size_t excess = *m_residentSize - m_memoryBudget;
+    for (auto const &entry : entries) {
+      candidates.push_back(Candidate{*entry.BlobId, entry.Value->Generation, entry.Value->Slices, entry.Value->Size});
+      if (entry.ReleasableSize >= excess) {
+        break;
+      }
+      excess -= entry.ReleasableSize;
+    }
+  }
+
+  for (auto &candidate : candidates) {
+    auto segment = Spill(candidate.Slices, candidate.Size);
+    if (!segment) {
+      break;
+    }
+
+    // Drop the references held by the candidate, so that the resident segments are released with the blob slices.
+    candidate.Slices.clear();
+
+    scoped_lock lock{m_mutex};
+    ReplaceSlices(candidate.BlobId, candidate.Generation, BlobSlice{std::move(segment), 0, candidate.Size});
+  }
+}
+
+vector<BlobSlice> MemoryBlobPersistor::ResolveSlices(string &&blobId, int64_t offset, int64_t size) {
+  if (size < 1)
+    return {};
+
+  scoped_lock lock{m_mutex};
+
+  auto &blob = FindBlob(blobId, offset, size);
+  auto begin = static_cast<size_t>(offset);
+  auto end = begin + static_cast<size_t>(size);
+
+  vector<BlobSlice> result{};
+  size_t sliceBegin = 0;
+  for (auto const &slice : blob.Slices) {
+    auto sliceEnd = sliceBegin + slice.Size;
+    if (sliceEnd > begin) {
+      auto first = std::max(begin, sliceBegin);
+      auto last = std::min(end, sliceEnd);
+      result.push_back(BlobSlice{slice.Segment, slice.Offset + (first - sliceBegin), last - first});
+    }
+
+    sliceBegin = sliceEnd;
+    if (sliceBegin >= end)
+      break;
+  }
+
+  return result;
+}
+
+BlobSlice MemoryBlobPersistor::CreateSlice(vector<uint8_t> &&content) noexcept {
+  auto size = content.size();
+  return BlobSlice{std::make_shared<MemoryBlobSegment>(std::move(content), m_residentSize), 0, size};
+}
+
+void MemoryBlobPersistor::StoreSlices(vector<BlobSlice> &&slices, string &&blobId) noexcept {
+  auto size = PrepareSlices(slices);
+  {
+    scoped_lock lock{m_mutex};
+    StoreBlob(std::move(slices), size, std::move(blobId));
+  }
+
+  EnforceMemoryBudget();
+}
+
+size_t MemoryBlobPersistor::ResidentSize() const noexcept {
+  return *m_residentSize;
+}
+
+#pragma region IBlobPersistor
+
+BlobContent MemoryBlobPersistor::ResolveMessage(string &&blobId, int64_t offset, int64_t size) {
+  auto slices = ResolveSlices(std::move(blobId), offset, size);
+  if (slices.empty())
+    return {};
+
+  // Ranges within a single slice are returned in place.
+  if (slices.size() == 1) {
+    auto &slice = slices.front();
+    auto data = slice.Segment->Data() + slice.Offset;
+    return BlobContent{std::move(slice.Segment), array_view<uint8_t const>(data, data + slice.Size)};
+  }
+
+  // Ranges across slices need contiguous content, so only the range is copied. The blob itself is left unchanged.
+  vector<uint8_t> content{};
+  content.reserve(static_cast<size_t>(size));
+  for (auto const &slice : slices) {
+    auto data = slice.Segment->Data() + slice.Offset;
+    content.insert(content.end(), data, data + slice.Size);
+  }
+  slices.clear();
+
+  shared_ptr<IBlobSegment const> segment = CreateSlice(std::move(content)).Segment;
+  auto data = segment->Data();
+  return BlobContent{std::move(segment), array_view<uint8_t const>(data, data + size)};
 }
 
 void MemoryBlobPersistor::RemoveMessage(string &&blobId) noexcept {
@@ -196,16 +521,17 @@ void MemoryBlobPersistor::RemoveMessage(string &&blobId) noexcept {
 }
 
 void MemoryBlobPersistor::StoreMessage(vector<uint8_t> &&message, string &&blobId) noexcept {
-  scoped_lock lock{m_mutex};
-
-  m_blobs.insert_or_assign(std::move(blobId), std::move(message));
+  StoreSlices({CreateSlice(std::move(message))}, std::move(blobId));
 }
 
 string MemoryBlobPersistor::StoreMessage(vector<uint8_t> &&message) noexcept {
-  auto blobId = boost::uuids::to_string(m_guidGenerator());
+  string blobId;
+  {
+    scoped_lock lock{m_mutex};
+    blobId = boost::uuids::to_string(m_guidGenerator());
+  }
 
-  scoped_lock lock{m_mutex};
-  m_blobs.insert_or_assign(blobId, std::move(message));
+  StoreSlices({CreateSlice(std::move(message))}, string{blobId});
 
   return blobId;
 }
@@ -285,8 +611,9 @@ msrn::JSValueObject BlobModuleRequestBodyHandler::ToRequestBody(
 
   auto &blob = data[blobKeys.Blob].AsObject();
   auto blobId = blob[blobKeys.BlobId].AsString();
-  auto bytes = m_blobPersistor->ResolveMessage(
+  auto content = m_blobPersistor->ResolveMessage(
       std::move(blobId), blob[blobKeys.Offset].AsInt64(), blob[blobKeys.Size].AsInt64());
+  auto const &bytes = content.Data;
 
   return {
       {blobKeys.Type, type},
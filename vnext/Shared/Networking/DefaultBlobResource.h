@@ -17,20 +17,115 @@
 #include <boost/uuid/uuid_generators.hpp>
 
 // Standard Library
+#include <atomic>
 #include <mutex>
 #include <unordered_set>
 
 namespace Microsoft::React::Networking {
 
+/// <summary>
+/// Immutable blob content, shared by every blob that references it.
+/// </summary>
+struct IBlobSegment {
+  virtual ~IBlobSegment() noexcept {}
+
+  virtual uint8_t const *Data() const noexcept = 0;
+
+  virtual size_t Size() const noexcept = 0;
+
+  /// <summary>
+  /// Returns if the content is held in memory rather than in a memory-mapped temporary file.
+  /// </summary>
+  virtual bool IsResident() const noexcept = 0;
+};
+
+/// <summary>
+/// Byte range of a blob segment.
+/// </summary>
+struct BlobSlice {
+  std::shared_ptr<IBlobSegment const> Segment;
+  size_t Offset;
+  size_t Size;
+};
+
+/// <summary>
+/// Stores blobs as lists of slices over shared segments, so slicing and composing blobs does not copy content.
+/// Blobs at least as large as the spill size and the least recently used blobs beyond the memory budget are moved
+/// to memory-mapped temporary files.
+/// </summary>
+/// <remarks>
+/// Content returned by ResolveMessage holds the segment it points into, so it stays valid after the blob is removed
+/// or moved to a temporary file.
+/// Only blobs whose resident segments nothing else references are moved to temporary files, as moving the others
+/// would not release memory.
+/// Temporary files are written without holding the lock, so blobs may change meanwhile; the Generation of a blob
+/// tells whether its slices are still the ones written.
+/// </remarks>
 class MemoryBlobPersistor final : public IBlobPersistor {
-  std::unordered_map<std::string, std::vector<uint8_t>> m_blobs;
+  struct Blob {
+    std::vector<BlobSlice> Slices;
+    size_t Size;
+    uint64_t LastUse;
+    uint64_t Generation;
+  };
+
+  std::unordered_map<std::string, Blob> m_blobs;
   std::mutex m_mutex;
   boost::uuids::random_generator m_guidGenerator;
+  std::shared_ptr<std::atomic<size_t>> m_residentSize;
+  size_t m_memoryBudget;
+  size_t m_spillSize;
+  uint64_t m_useCount{0};
+
+  // The following methods must be called with m_mutex held.
+
+  Blob &FindBlob(std::string const &blobId, int64_t offset, int64_t size);
+
+  void StoreBlob(std::vector<BlobSlice> &&slices, size_t size, std::string &&blobId) noexcept;
+
+  void ReplaceSlices(std::string const &blobId, uint64_t generation, BlobSlice &&slice) noexcept;
+
+  size_t ReleasableSize(Blob const &blob) const noexcept;
+
+  // The following methods must be called without m_mutex held, as they may write temporary files.
+
+  std::shared_ptr<IBlobSegment const> Spill(std::vector<BlobSlice> const &slices, size_t size) noexcept;
+
+  size_t PrepareSlices(std::vector<BlobSlice> &slices) noexcept;
+
+  void EnforceMemoryBudget() noexcept;
 
  public:
+  static constexpr size_t DefaultMemoryBudget = 256 * 1024 * 1024;
+  static constexpr size_t DefaultSpillSize = 64 * 1024 * 1024;
+
+  MemoryBlobPersistor() noexcept;
+
+  MemoryBlobPersistor(size_t memoryBudget, size_t spillSize) noexcept;
+
+  /// <summary>
+  /// Returns the slices covering a blob range without copying its content.
+  /// </summary>
+  /// <exception cref="std::invalid_argument">
+  /// When an entry for blobId cannot be found.
+  /// </exception>
+  std::vector<BlobSlice> ResolveSlices(std::string &&blobId, int64_t offset, int64_t size);
+
+  /// <summary>
+  /// Returns a slice over new resident content, to be stored with StoreSlices.
+  /// </summary>
+  BlobSlice CreateSlice(std::vector<uint8_t> &&content) noexcept;
+
+  void StoreSlices(std::vector<BlobSlice> &&slices, std::string &&blobId) noexcept;
+
+  /// <summary>
+  /// Returns the number of blob content bytes held in memory.
+  /// </summary>
+  size_t ResidentSize() const noexcept;
+
 #pragma region IBlobPersistor
 
-  winrt::array_view<uint8_t const> ResolveMessage(std::string &&blobId, int64_t offset, int64_t size) override;
+  BlobContent ResolveMessage(std::string &&blobId, int64_t offset, int64_t size) override;
 
   void RemoveMessage(std::string &&blobId) noexcept override;
 
@@ -0,0 +1,388 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::React::Networking {
+
+using HttpCacheHeaders = std::vector<std::pair<std::string, std::string>>;
+
+namespace HttpCacheDetail {
+
+inline char ToLower(char c) noexcept {
+  return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+inline bool EqualsIgnoreCase(std::string_view left, std::string_view right) noexcept {
+  if (left.size() != right.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < left.size(); ++i) {
+    if (ToLower(left[i]) != ToLower(right[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline std::string_view Trim(std::string_view value) noexcept {
+  while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+    value.remove_prefix(1);
+  }
+  while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+    value.remove_suffix(1);
+  }
+  return value;
+}
+
+// Calls `callback` with each trimmed, non-empty element of a comma separated header value.
+template <typename TCallback>
+void ForEachElement(std::string_view value, TCallback &&callback) noexcept {
+  while (!value.empty()) {
+    auto comma = value.find(',');
+    auto element = Trim(value.substr(0, comma));
+    if (!element.empty()) {
+      callback(element);
+    }
+    value = comma == std::string_view::npos ? std::string_view{} : value.substr(comma + 1);
+  }
+}
+
+inline std::optional<int64_t> ParseSeconds(std::string_view value) noexcept {
+  if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+    value = value.substr(1, value.size() - 2);
+  }
+  if (value.empty()) {
+    return std::nullopt;
+  }
+
+  int64_t seconds = 0;
+  for (auto c : value) {
+    if (c < '0' || c > '9') {
+      return std::nullopt;
+    }
+    // Larger values mean "forever" (RFC 9111, section 1.2.2).
+    seconds = seconds < INT32_MAX ? seconds * 10 + (c - '0') : INT32_MAX;
+  }
+  return std::min<int64_t>(seconds, INT32_MAX);
+}
+
+} // namespace HttpCacheDetail
+
+// Parses an HTTP date in the IMF-fixdate format, such as "Sun, 06 Nov 1994 08:49:37 GMT", to seconds since the Unix
+// epoch. The obsolete RFC 850 and asctime formats are not supported: like any invalid date, they make a response stale.
+inline std::optional<int64_t> ParseHttpDate(std::string_view value) noexcept {
+  auto comma = value.find(", ");
+  if (comma == std::string_view::npos) {
+    return std::nullopt;
+  }
+  value = value.substr(comma + 2);
+  if (value.size() != 24 || value[2] != ' ' || value[6] != ' ' || value[11] != ' ' || value[14] != ':' ||
+      value[17] != ':' || value.substr(20) != " GMT") {
+    return std::nullopt;
+  }
+
+  auto number = [&value](size_t offset, size_t length) -> int64_t {
+    int64_t result = 0;
+    for (size_t i = offset; i < offset + length; ++i) {
+      if (value[i] < '0' || value[i] > '9') {
+        return -1;
+      }
+      result = result * 10 + (value[i] - '0');
+    }
+    return result;
+  };
+
+  constexpr std::string_view months = "JanFebMarAprMayJunJulAugSepOctNovDec";
+  auto monthIndex = months.find(value.substr(3, 3));
+  if (monthIndex == std::string_view::npos || monthIndex % 3 != 0) {
+    return std::nullopt;
+  }
+
+  auto day = number(0, 2);
+  auto month = static_cast<int64_t>(monthIndex / 3) + 1;
+  auto year = number(7, 4);
+  auto hours = number(12, 2);
+  auto minutes = number(15, 2);
+  auto seconds = number(18, 2);
+  if (day < 1 || day > 31 || year < 1970 || hours < 0 || hours > 23 || minutes < 0 || minutes > 59 || seconds < 0 ||
+      seconds > 60) {
+    return std::nullopt;
+  }
+
+  // Days since the epoch of a date in the proleptic Gregorian calendar.
+  auto shiftedYear = month <= 2 ? year - 1 : year;
+  auto era = shiftedYear / 400;
+  auto yearOfEra = shiftedYear - era * 400;
+  auto dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  auto dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  auto days = era * 146097 + dayOfEra - 719468;
+
+  return days * 86400 + hours * 3600 + minutes * 60 + seconds;
+}
+
+// What the headers of a response allow a private cache to do with it (RFC 9111).
+struct HttpCachePolicy {
+  bool NoStore{false};
+  bool NoCache{false};
+  std::optional<int64_t> MaxAge;
+  std::optional<int64_t> Expires;
+  std::optional<int64_t> Date;
+  int64_t Age{0};
+  std::string ETag;
+  std::string LastModified;
+  // The response depends on request headers other than Accept-Encoding, which entries are not keyed by.
+  bool VariesOnRequest{false};
+
+  void Apply(std::string_view name, std::string_view value) noexcept {
+    using namespace HttpCacheDetail;
+
+    value = Trim(value);
+    if (EqualsIgnoreCase(name, "Cache-Control")) {
+      ForEachElement(value, [this](std::string_view directive) {
+        auto equals = directive.find('=');
+        auto directiveName = Trim(directive.substr(0, equals));
+        if (EqualsIgnoreCase(directiveName, "no-store")) {
+          NoStore = true;
+        } else if (EqualsIgnoreCase(directiveName, "no-cache")) {
+          NoCache = true;
+        } else if (EqualsIgnoreCase(directiveName, "max-age") && equals != std::string_view::npos) {
+          // An invalid max-age makes the response stale.
+          MaxAge = ParseSeconds(Trim(directive.substr(equals + 1))).value_or(0);
+        }
+      });
+    } else if (EqualsIgnoreCase(name, "Expires")) {
+      Expires = ParseHttpDate(value).value_or(0);
+    } else if (EqualsIgnoreCase(name, "Date")) {
+      Date = ParseHttpDate(value);
+    } else if (EqualsIgnoreCase(name, "Age")) {
+      Age = ParseSeconds(value).value_or(0);
+    } else if (EqualsIgnoreCase(name, "ETag")) {
+      ETag = std::string{value};
+    } else if (EqualsIgnoreCase(name, "Last-Modified")) {
+      LastModified = std::string{value};
+    } else if (EqualsIgnoreCase(name, "Vary")) {
+      ForEachElement(value, [this](std::string_view field) {
+        if (!EqualsIgnoreCase(field, "Accept-Encoding")) {
+          VariesOnRequest = true;
+        }
+      });
+    }
+  }
+
+  static HttpCachePolicy Parse(const HttpCacheHeaders &headers) noexcept {
+    HttpCachePolicy policy;
+    for (const auto &header : headers) {
+      policy.Apply(header.first, header.second);
+    }
+    return policy;
+  }
+
+  bool HasValidators() const noexcept {
+    return !ETag.empty() || !LastModified.empty();
+  }
+
+  // How long, in seconds, the response stays fresh after it was generated at `generatedAt`. Responses without an
+  // explicit lifetime are not given a heuristic one: they are revalidated every time.
+  int64_t FreshnessLifetime(int64_t generatedAt) const noexcept {
+    if (NoCache) {
+      return 0;
+    }
+    if (MaxAge) {
+      return *MaxAge;
+    }
+    if (Expires) {
+      return std::max<int64_t>(*Expires - Date.value_or(generatedAt), 0);
+    }
+    return 0;
+  }
+
+  // Whether a response, generated at `generatedAt`, can be served without contacting the server at `now`.
+  bool IsFresh(int64_t generatedAt, int64_t now) const noexcept {
+    return now - generatedAt < FreshnessLifetime(generatedAt);
+  }
+
+  // Whether the response can be stored: it must be allowed to, and be either fresh for a while or revalidatable.
+  bool IsStorable(int64_t generatedAt) const noexcept {
+    return !NoStore && !VariesOnRequest && (FreshnessLifetime(generatedAt) > 0 || HasValidators());
+  }
+};
+
+// Whether a request may be answered from the cache. Requests asking to bypass it, and the conditional and range
+// requests that the app makes itself, go to the network.
+inline bool IsCacheableRequest(const HttpCacheHeaders &requestHeaders) noexcept {
+  using namespace HttpCacheDetail;
+
+  bool cacheable = true;
+  for (const auto &header : requestHeaders) {
+    if (EqualsIgnoreCase(header.first, "Cache-Control") || EqualsIgnoreCase(header.first, "Pragma")) {
+      ForEachElement(header.second, [&cacheable](std::string_view directive) {
+        if (EqualsIgnoreCase(directive, "no-cache") || EqualsIgnoreCase(directive, "no-store") ||
+            EqualsIgnoreCase(directive, "max-age=0")) {
+          cacheable = false;
+        }
+      });
+    } else if (
+        EqualsIgnoreCase(header.first, "If-None-Match") || EqualsIgnoreCase(header.first, "If-Modified-Since") ||
+        EqualsIgnoreCase(header.first, "Range")) {
+      cacheable = false;
+    }
+  }
+  return cacheable;
+}
+
+// A response kept in the cache. Content headers are kept apart from the other response headers, since they belong to
+// the content of a WinRT response.
+struct HttpCacheEntry {
+  std::string Url;
+  // When the response was generated, in seconds since the Unix epoch.
+  int64_t GeneratedAt{0};
+  HttpCacheHeaders Headers;
+  HttpCacheHeaders ContentHeaders;
+};
+
+// Updates the stored headers of a response with those of a 304 Not Modified response that revalidated it (RFC 9111,
+// section 4.3.4): the headers it has replace the stored headers of the same name.
+inline void UpdateHttpCacheHeaders(HttpCacheHeaders &stored, const HttpCacheHeaders &updates) {
+  using namespace HttpCacheDetail;
+
+  stored.erase(
+      std::remove_if(
+          stored.begin(),
+          stored.end(),
+          [&updates](const std::pair<std::string, std::string> &header) {
+            return std::any_of(updates.begin(), updates.end(), [&header](const auto &update) {
+              return EqualsIgnoreCase(header.first, update.first);
+            });
+          }),
+      stored.end());
+  stored.insert(stored.end(), updates.begin(), updates.end());
+}
+
+namespace HttpCacheDetail {
+
+constexpr std::string_view EntryMagic = "RNWHttpCache1\n";
+
+inline bool ReadLine(std::string_view &data, std::string_view &line) noexcept {
+  auto newLine = data.find('\n');
+  if (newLine == std::string_view::npos) {
+    return false;
+  }
+  line = data.substr(0, newLine);
+  data.remove_prefix(newLine + 1);
+  return true;
+}
+
+inline bool ReadNumber(std::string_view &data, uint64_t &number) noexcept {
+  std::string_view line;
+  if (!ReadLine(data, line) || line.empty() || line.size() > 19) {
+    return false;
+  }
+  number = 0;
+  for (auto c : line) {
+    if (c < '0' || c > '9') {
+      return false;
+    }
+    number = number * 10 + (c - '0');
+  }
+  return true;
+}
+
+inline bool ReadHeaders(std::string_view &data, HttpCacheHeaders &headers) noexcept {
+  uint64_t count = 0;
+  if (!ReadNumber(data, count)) {
+    return false;
+  }
+  for (uint64_t i = 0; i < count; ++i) {
+    std::string_view line;
+    if (!ReadLine(data, line)) {
+      return false;
+    }
+    auto colon = line.find(": ");
+    if (colon == std::string_view::npos || colon == 0) {
+      return false;
+    }
+    headers.emplace_back(line.substr(0, colon), line.substr(colon + 2));
+  }
+  return true;
+}
+
+inline void WriteHeaders(std::string &data, const HttpCacheHeaders &headers) {
+  auto isValid = [](const std::pair<std::string, std::string> &header) {
+    return !header.first.empty() && header.first.find_first_of(":\r\n") == std::string::npos &&
+        header.second.find_first_of("\r\n") == std::string::npos;
+  };
+
+  size_t count = 0;
+  for (const auto &header : headers) {
+    count += isValid(header) ? 1 : 0;
+  }
+  data.append(std::to_string(count)).push_back('\n');
+  for (const auto &header : headers) {
+    if (isValid(header)) {
+      data.append(header.first).append(": ").append(header.second).push_back('\n');
+    }
+  }
+}
+
+} // namespace HttpCacheDetail
+
+// Serializes an entry and the size of its body. The body follows the returned bytes.
+inline std::string SerializeHttpCacheEntry(const HttpCacheEntry &entry, size_t bodySize) {
+  using namespace HttpCacheDetail;
+
+  std::string data{EntryMagic};
+  data.append(entry.Url).push_back('\n');
+  data.append(std::to_string(std::max<int64_t>(entry.GeneratedAt, 0))).push_back('\n');
+  WriteHeaders(data, entry.Headers);
+  WriteHeaders(data, entry.ContentHeaders);
+  data.append(std::to_string(bodySize)).push_back('\n');
+  return data;
+}
+
+// Parses a serialized entry followed by its body, as found in the `size` bytes at `data`. Fails unless the body ends
+// exactly at the end of the data, so that truncated entries are not used.
+inline bool ParseHttpCacheEntry(
+    const uint8_t *data,
+    size_t size,
+    HttpCacheEntry &entry,
+    size_t &bodyOffset,
+    size_t &bodySize) noexcept {
+  using namespace HttpCacheDetail;
+
+  std::string_view remaining{reinterpret_cast<const char *>(data), size};
+  if (remaining.substr(0, EntryMagic.size()) != EntryMagic) {
+    return false;
+  }
+  remaining.remove_prefix(EntryMagic.size());
+
+  std::string_view url;
+  uint64_t generatedAt = 0;
+  uint64_t length = 0;
+  try {
+    if (!ReadLine(remaining, url) || !ReadNumber(remaining, generatedAt) || !ReadHeaders(remaining, entry.Headers) ||
+        !ReadHeaders(remaining, entry.ContentHeaders) || !ReadNumber(remaining, length) ||
+        length != remaining.size()) {
+      return false;
+    }
+    entry.Url = std::string{url};
+  } catch (const std::bad_alloc &) {
+    return false;
+  }
+
+  entry.GeneratedAt = static_cast<int64_t>(generatedAt);
+  bodyOffset = size - remaining.size();
+  bodySize = static_cast<size_t>(length);
+  return true;
+}
+
+} // namespace Microsoft::React::Networking
@@ -0,0 +1,255 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HttpDiskCache.h"
+
+#include <CppRuntimeOptions.h>
+#include <Hasher.h>
+#include <MemoryMappedBuffer.h>
+
+// Windows API
+#include <windows.h>
+#include <winrt/base.h>
+
+// Standard Library
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+using std::shared_ptr;
+using std::string;
+using std::wstring;
+
+namespace Microsoft::React::Networking {
+
+namespace {
+
+constexpr wchar_t EntryPrefix[] = L"rnwhttp_";
+
+uint64_t FileTimeToUInt64(const FILETIME &time) noexcept {
+  return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+}
+
+} // namespace
+
+#pragma region HttpDiskCache
+
+HttpDiskCache::HttpDiskCache(wstring directory, uint64_t capacityInBytes) noexcept
+    : m_directory{std::move(directory)}, m_capacity{capacityInBytes} {
+  if (!m_directory.empty() && m_directory.back() != L'\\') {
+    m_directory.push_back(L'\\');
+  }
+  CreateDirectoryW(m_directory.c_str(), nullptr /*lpSecurityAttributes*/);
+}
+
+/*static*/ shared_ptr<HttpDiskCache> HttpDiskCache::Default() noexcept {
+  static std::mutex mutex;
+  static shared_ptr<HttpDiskCache> cache;
+
+  auto capacity = GetRuntimeOptionInt("Http.DiskCacheCapacity");
+  if (capacity <= 0) {
+    return nullptr;
+  }
+
+  wstring directory{winrt::to_hstring(GetRuntimeOptionString("Http.DiskCacheDirectory"))};
+  if (directory.empty()) {
+    wchar_t tempPath[MAX_PATH];
+    if (!GetTempPathW(static_cast<DWORD>(std::size(tempPath)), tempPath)) {
+      return nullptr;
+    }
+    directory = wstring{tempPath} + L"rnw_http_cache";
+  }
+  if (directory.back() != L'\\') {
+    directory.push_back(L'\\');
+  }
+
+  std::scoped_lock lock{mutex};
+  // The options can change between instances, such as in tests.
+  if (!cache || cache->Capacity() != static_cast<uint64_t>(capacity) || cache->Directory() != directory) {
+    cache = std::make_shared<HttpDiskCache>(std::move(directory), static_cast<uint64_t>(capacity));
+  }
+  return cache;
+}
+
+const wstring &HttpDiskCache::Directory() const noexcept {
+  return m_directory;
+}
+
+uint64_t HttpDiskCache::Capacity() const noexcept {
+  return m_capacity;
+}
+
+uint64_t HttpDiskCache::MaxBodySize() const noexcept {
+  return m_capacity / 8;
+}
+
+wstring HttpDiskCache::EntryPath(const string &url) const noexcept {
+  auto hash = Microsoft::ReactNative::GetSHA256Hash(url.data(), url.size());
+  if (!hash) {
+    // Hashing failed.
+    std::terminate();
+  }
+
+  constexpr wchar_t hexDigits[] = L"0123456789abcdef";
+  wstring path = m_directory + EntryPrefix;
+  for (size_t i = 0; i < 16 && i < hash.value().size(); ++i) {
+    path.push_back(hexDigits[hash.value()[i] >> 4]);
+    path.push_back(hexDigits[hash.value()[i] & 0xf]);
+  }
+  path.append(L".cache");
+  return path;
+}
+
+std::optional<HttpDiskCache::Entry> HttpDiskCache::Lookup(const string &url) noexcept {
+  auto entryPath = EntryPath(url);
+
+  Entry entry;
+  try {
+    entry.File = Microsoft::JSI::MakeMemoryMappedBuffer(entryPath.c_str());
+  } catch (const facebook::jsi::JSINativeException &) {
+    return std::nullopt;
+  }
+
+  size_t bodyOffset = 0;
+  if (!ParseHttpCacheEntry(entry.File->data(), entry.File->size(), entry.Response, bodyOffset, entry.BodySize) ||
+      entry.Response.Url != url) {
+    // Corrupted, or another URL with the same hash. The next Store replaces it.
+    return std::nullopt;
+  }
+  entry.Body = entry.File->data() + bodyOffset;
+
+  // Mark the entry as recently used for Evict.
+  HANDLE file = CreateFile2(
+      entryPath.c_str(),
+      FILE_WRITE_ATTRIBUTES,
+      FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+      OPEN_EXISTING,
+      nullptr /* pCreateExParams */);
+  if (file != INVALID_HANDLE_VALUE) {
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    SetFileTime(file, nullptr, nullptr, &now);
+    CloseHandle(file);
+  }
+
+  return entry;
+}
+
+bool HttpDiskCache::Store(const HttpCacheEntry &response, const uint8_t *body, size_t bodySize) noexcept {
+  if (bodySize > MaxBodySize()) {
+    return false;
+  }
+
+  auto entryPath = EntryPath(response.Url);
+  auto tempPath = entryPath.substr(0, entryPath.size() - 6) + L"_" + std::to_wstring(GetCurrentProcessId()) + L"_" +
+      std::to_wstring(GetCurrentThreadId()) + L".tmp";
+
+  try {
+    auto header = SerializeHttpCacheEntry(response, bodySize);
+    std::ofstream file(tempPath.c_str(), std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return false;
+    }
+
+    file.write(header.data(), header.size());
+    file.write(reinterpret_cast<const char *>(body), bodySize);
+    file.close();
+    if (!file) {
+      DeleteFileW(tempPath.c_str());
+      return false;
+    }
+  } catch (const std::exception &) {
+    DeleteFileW(tempPath.c_str());
+    return false;
+  }
+
+  // The rename fails while the previous entry is mapped, in which case it is kept until the next Store.
+  if (!MoveFileExW(tempPath.c_str(), entryPath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+    DeleteFileW(tempPath.c_str());
+    return false;
+  }
+
+  ++m_stores;
+  Evict(entryPath);
+  return true;
+}
+
+void HttpDiskCache::Remove(const string &url) noexcept {
+  DeleteFileW(EntryPath(url).c_str());
+}
+
+void HttpDiskCache::Evict(const wstring &keepPath) noexcept {
+  struct File {
+    wstring path;
+    uint64_t size;
+    uint64_t lastWriteTime;
+  };
+
+  std::vector<File> files;
+  uint64_t totalSize = 0;
+
+  WIN32_FIND_DATAW findData;
+  HANDLE find = FindFirstFileExW(
+      (m_directory + EntryPrefix + L"*").c_str(), FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, 0);
+  if (find == INVALID_HANDLE_VALUE) {
+    return;
+  }
+
+  try {
+    do {
+      if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+        continue;
+      }
+
+      std::wstring_view name{findData.cFileName};
+      auto path = m_directory + wstring(name);
+      if (name.size() > 4 && name.substr(name.size() - 4) == L".tmp") {
+        // Left behind by a crash while storing. Fails for the files that are still being written.
+        DeleteFileW(path.c_str());
+      } else if (name.size() > 6 && name.substr(name.size() - 6) == L".cache") {
+        auto size = (static_cast<uint64_t>(findData.nFileSizeHigh) << 32) | findData.nFileSizeLow;
+        totalSize += size;
+        if (path != keepPath) {
+          files.push_back({std::move(path), size, FileTimeToUInt64(findData.ftLastWriteTime)});
+        }
+      }
+    } while (FindNextFileW(find, &findData));
+  } catch (const std::bad_alloc &) {
+  }
+  FindClose(find);
+
+  std::sort(files.begin(), files.end(), [](const File &left, const File &right) {
+    return left.lastWriteTime < right.lastWriteTime;
+  });
+
+  // Entries that are mapped cannot be deleted, and are left for a later eviction.
+  for (const auto &file : files) {
+    if (totalSize <= m_capacity) {
+      break;
+    }
+    if (DeleteFileW(file.path.c_str())) {
+      totalSize -= file.size;
+    }
+  }
+}
+
+void HttpDiskCache::RecordHit() noexcept {
+  ++m_hits;
+}
+
+void HttpDiskCache::RecordNotModified() noexcept {
+  ++m_notModified;
+}
+
+void HttpDiskCache::RecordMiss() noexcept {
+  ++m_misses;
+}
+
+HttpDiskCacheStats HttpDiskCache::Stats() const noexcept {
+  return {m_hits.load(), m_notModified.load(), m_misses.load(), m_stores.load()};
+}
+
+#pragma endregion HttpDiskCache
+
+} // namespace Microsoft::React::Networking
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "HttpCachePolicy.h"
+
+// React Native
+#include <jsi/jsi.h>
+
+// Standard Library
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace Microsoft::React::Networking {
+
+struct HttpDiskCacheStats {
+  // Requests answered by a fresh entry, without contacting the server.
+  uint64_t Hits{0};
+  // Requests answered by a stale entry the server confirmed with a 304 Not Modified.
+  uint64_t NotModified{0};
+  // Cacheable requests that had to download their response.
+  uint64_t Misses{0};
+  // Responses written to the cache.
+  uint64_t Stores{0};
+};
+
+// Keeps HTTP responses on disk across runs, one file per URL. The files are memory mapped when read, and the least
+// recently used ones are deleted once the cache holds more than its capacity. Instances of the app share the files.
+class HttpDiskCache final {
+ public:
+  struct Entry {
+    HttpCacheEntry Response;
+    // Keeps the body mapped.
+    std::shared_ptr<const facebook::jsi::Buffer> File;
+    const uint8_t *Body{nullptr};
+    size_t BodySize{0};
+  };
+
+  HttpDiskCache(std::wstring directory, uint64_t capacityInBytes) noexcept;
+
+  // The cache of the process, configured by the "Http.DiskCacheCapacity" runtime option, in bytes, and the optional
+  // "Http.DiskCacheDirectory" runtime option. Returns nullptr when the capacity is not positive.
+  static std::shared_ptr<HttpDiskCache> Default() noexcept;
+
+  const std::wstring &Directory() const noexcept;
+  uint64_t Capacity() const noexcept;
+
+  // Returns the entry for `url`, and marks it as recently used.
+  std::optional<Entry> Lookup(const std::string &url) noexcept;
+
+  // Replaces the entry for the URL of `response` with it and `body`. Bodies larger than an eighth of the capacity are
+  // not kept.
+  bool Store(const HttpCacheEntry &response, const uint8_t *body, size_t bodySize) noexcept;
+
+  void Remove(const std::string &url) noexcept;
+
+  // The largest body Store keeps.
+  uint64_t MaxBodySize() const noexcept;
+
+  void RecordHit() noexcept;
+  void RecordNotModified() noexcept;
+  void RecordMiss() noexcept;
+
+  HttpDiskCacheStats Stats() const noexcept;
+
+ private:
+  std::wstring EntryPath(const std::string &url) const noexcept;
+  void Evict(const std::wstring &keepPath) noexcept;
+
+  std::wstring m_directory;
+  uint64_t m_capacity;
+  std::atomic<uint64_t> m_hits{0};
+  std::atomic<uint64_t> m_notModified{0};
+  std::atomic<uint64_t> m_misses{0};
+  std::atomic<uint64_t> m_stores{0};
+};
+
+} // namespace Microsoft::React::Networking
@@ -12,6 +12,7 @@
 #include <Utils/CppWinrtLessExceptions.h>
 #include <Utils/WinRTConversions.h>
 #include <utilities.h>
+#include "CachingHttpFilter.h"
 #include "IRedirectEventSource.h"
 #include "Networking/NetworkPropertyIds.h"
 #include "OriginPolicyHttpFilter.h"
@@ -26,6 +27,9 @@
 #include <winrt/Windows.Storage.Streams.h>
 #include <winrt/Windows.Web.Http.Headers.h>
 
+// Standard Library
+#include <algorithm>
+
 using std::function;
 using std::scoped_lock;
 using std::shared_ptr;
@@ -43,6 +47,7 @@ using winrt::Windows::Foundation::Uri;
 using winrt::Windows::Security::Cryptography::CryptographicBuffer;
 using winrt::Windows::Storage::StorageFile;
 using winrt::Windows::Storage::Streams::DataReader;
+using winrt::Windows::Storage::Streams::InputStreamOptions;
 using winrt::Windows::Storage::Streams::UnicodeEncoding;
 using winrt::Windows::Web::Http::HttpBufferContent;
 using winrt::Windows::Web::Http::HttpMethod;
@@ -67,6 +72,38 @@ constexpr char responseTypeText[] = "text";
 constexpr char responseTypeBase64[] = "base64";
 constexpr char responseTypeBlob[] = "blob";
 
+// Returns the maximum number of response content bytes to load before handing them over.
+// Note, the minimum apparent valid chunk size is 128 KB
+// Apple's implementation appears to grab 5-8 KB chunks
+uint32_t ResponseHighWaterMark(bool incrementalUpdates) noexcept {
+  auto highWaterMark = Microsoft::React::GetRuntimeOptionInt("Http.ResponseHighWaterMark");
+  if (highWaterMark > 0) {
+    return static_cast<uint32_t>(highWaterMark);
+  }
+
+  return incrementalUpdates ? 128_KiB : 8_MiB;
+}
+
+// Returns the capacity to reserve for accumulated response content.
+// Content-Length is only a hint from the server, so it never reserves more than the high-water mark upfront.
+size_t InitialResponseCapacity(int64_t totalBytes, uint32_t highWaterMark) noexcept {
+  if (totalBytes <= 0) {
+    return 0;
+  }
+
+  return static_cast<size_t>(std::min<int64_t>(totalBytes, highWaterMark));
+}
+
+// Appends the loaded reader content to the buffer without intermediate copies.
+template <typename TBuffer>
+void ReadAppend(DataReader const &reader, TBuffer &buffer) {
+  auto offset = buffer.size();
+  buffer.resize(offset + reader.UnconsumedBufferLength());
+
+  auto data = Microsoft::Common::Utilities::CheckedReinterpretCast<uint8_t *>(buffer.data()) + offset;
+  reader.ReadBytes(winrt::array_view<uint8_t>{data, static_cast<uint32_t>(buffer.size() - offset)});
+}
+
 } // namespace
 namespace Microsoft::React::Networking {
 
@@ -196,7 +233,10 @@ IAsyncOperation<HttpRequestMessage> WinRTHttpResource::CreateRequest(
     } else if (data.find("string") != data.cend()) {
       content = HttpStringContent{to_hstring(data["string"].AsString())};
     } else if (data.find("base64") != data.cend()) {
-      auto buffer = CryptographicBuffer::DecodeFromBase64String(to_hstring(data["base64"].AsString()));
+      auto buffer = Utilities::DecodeBase64ToBuffer(data["base64"].AsString());
+      if (!buffer) {
+        throw hresult_error{E_INVALIDARG, L"Invalid Base64 request body"};
+      }
       content = HttpBufferContent{std::move(buffer)};
     } else if (data.find("uri") != data.cend()) {
       auto file = co_await StorageFile::GetFileFromApplicationUriAsync(Uri{to_hstring(data["uri"].AsString())});
@@ -522,21 +562,30 @@ WinRTHttpResource::PerformSendRequest(HttpMethod &&method, Uri &&rtUri, IInspect
       auto inputStream = co_await response.Content().ReadAsInputStreamAsync();
       auto reader = DataReader{inputStream};
 
-      // Accumulate all incoming request data in 8MB chunks
-      // Note, the minimum apparent valid chunk size is 128 KB
-      // Apple's implementation appears to grab 5-8 KB chunks
-      const uint32_t segmentSize = reqArgs->IncrementalUpdates ? 128_KiB : 8_MiB;
+      // Content-Length, when known, is reported as progress total and sizes the accumulated content upfront.
+      int64_t totalBytes = 0;
+      if (auto contentLength = response.Content().Headers().ContentLength()) {
+        totalBytes = static_cast<int64_t>(contentLength.Value());
+      }
+
+      // No more than the high-water mark is buffered before being handed over.
+      // Incremental updates deliver whatever has arrived instead of waiting for a full segment.
+      const uint32_t highWaterMark = ResponseHighWaterMark(reqArgs->IncrementalUpdates);
+      if (reqArgs->IncrementalUpdates) {
+        reader.InputStreamOptions(InputStreamOptions::Partial);
+      }
 
       // Let response handler take over, if set
       if (auto responseHandler = self->m_responseHandler.lock()) {
         if (responseHandler->Supports(reqArgs->ResponseType)) {
           vector<uint8_t> responseData{};
-          while (auto loaded = co_await reader.LoadAsync(segmentSize)) {
-            auto length = reader.UnconsumedBufferLength();
-            auto data = vector<uint8_t>(length);
-            reader.ReadBytes(data);
+          responseData.reserve(InitialResponseCapacity(totalBytes, highWaterMark));
+          while (auto loaded = co_await reader.LoadAsync(highWaterMark)) {
+            ReadAppend(reader, responseData);
 
-            responseData.insert(responseData.cend(), data.cbegin(), data.cend());
+            if (reqArgs->IncrementalUpdates && self->m_onDataProgress) {
+              self->m_onDataProgress(reqArgs->RequestId, static_cast<int64_t>(responseData.size()), totalBytes);
+            }
           }
 
           auto blob = responseHandler->ToResponseData(std::move(responseData));
@@ -555,48 +604,49 @@ WinRTHttpResource::PerformSendRequest(HttpMethod &&method, Uri &&rtUri, IInspect
 
       if (isText) {
         reader.UnicodeEncoding(UnicodeEncoding::Utf8);
-      }
 
-      int64_t receivedBytes = 0;
-      string responseData;
-      winrt::Windows::Storage::Streams::IBuffer buffer;
-      while (auto loaded = co_await reader.LoadAsync(segmentSize)) {
-        auto length = reader.UnconsumedBufferLength();
-        receivedBytes += length;
-
-        if (isText) {
-          auto data = vector<uint8_t>(length);
-          reader.ReadBytes(data);
+        int64_t receivedBytes = 0;
+        string responseData;
+        if (!reqArgs->IncrementalUpdates) {
+          responseData.reserve(InitialResponseCapacity(totalBytes, highWaterMark));
+        }
 
-          auto incrementData = string(Common::Utilities::CheckedReinterpretCast<char *>(data.data()), data.size());
+        while (auto loaded = co_await reader.LoadAsync(highWaterMark)) {
           // #9534 - Send incremental updates.
           // See https://github.com/facebook/react-native/blob/v0.70.6/Libraries/Network/RCTNetworking.mm#L561
           if (reqArgs->IncrementalUpdates) {
-            responseData = std::move(incrementData);
+            string incrementData;
+            ReadAppend(reader, incrementData);
+            receivedBytes += static_cast<int64_t>(incrementData.size());
 
             if (self->m_onIncrementalData) {
-              // For total, see #10849
-              self->m_onIncrementalData(reqArgs->RequestId, std::move(responseData), receivedBytes, 0 /*total*/);
+              self->m_onIncrementalData(reqArgs->RequestId, std::move(incrementData), receivedBytes, totalBytes);
             }
           } else {
-            responseData += std::move(incrementData);
+            ReadAppend(reader, responseData);
           }
-        } else {
-          buffer = reader.ReadBuffer(length);
-          auto data = CryptographicBuffer::EncodeToBase64String(buffer);
+        }
 
-          responseData += winrt::to_string(std::wstring_view(data));
+        // If dealing with text-incremental response data, use m_onIncrementalData instead
+        if (self->m_onData && !reqArgs->IncrementalUpdates) {
+          self->m_onData(reqArgs->RequestId, std::move(responseData));
+        }
+      } else {
+        // Binary content is encoded once it is complete, so Base64 padding is only applied at its end.
+        vector<uint8_t> responseData{};
+        responseData.reserve(InitialResponseCapacity(totalBytes, highWaterMark));
+        while (auto loaded = co_await reader.LoadAsync(highWaterMark)) {
+          ReadAppend(reader, responseData);
 
           if (self->m_onDataProgress) {
-            // For total, see #10849
-            self->m_onDataProgress(reqArgs->RequestId, receivedBytes, 0 /*total*/);
+            self->m_onDataProgress(reqArgs->RequestId, static_cast<int64_t>(responseData.size()), totalBytes);
           }
         }
-      }
 
-      // If dealing with text-incremental response data, use m_onIncrementalData instead
-      if (self->m_onData && !(reqArgs->IncrementalUpdates && isText)) {
-        self->m_onData(reqArgs->RequestId, std::move(responseData));
+        if (self->m_onData) {
+          auto chars = Common::Utilities::CheckedReinterpretCast<char *>(responseData.data());
+          self->m_onData(reqArgs->RequestId, Utilities::EncodeBase64(std::string_view(chars, responseData.size())));
+        }
       }
 
       if (self->m_onComplete) {
@@ -668,7 +718,8 @@ void WinRTHttpResource::AddResponseHandler(shared_ptr<IResponseHandler> response
   HttpClient client;
 
   if (static_cast<OriginPolicy>(GetRuntimeOptionInt("Http.OriginPolicy")) == OriginPolicy::None) {
-    client = HttpClient{redirFilter};
+    // Responses are only cached without an origin policy, since cached responses would skip its validation.
+    client = HttpClient{MakeCachingHttpFilter(redirFilter)};
   } else {
     auto globalOrigin = GetRuntimeOptionString("Http.GlobalOrigin");
     auto opFilter = winrt::make<OriginPolicyHttpFilter>(std::move(globalOrigin), redirFilter);
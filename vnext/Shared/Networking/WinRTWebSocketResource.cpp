@@ -17,7 +17,9 @@
 #include <windows.Networking.Sockets.h>
 #include <windows.Storage.Streams.h>
 #include <winrt/Windows.Foundation.Collections.h>
-#include <winrt/Windows.Security.Cryptography.h>
+
+// Standard Library
+#include <stdexcept>
 
 using Microsoft::Common::Utilities::CheckedReinterpretCast;
 
@@ -44,7 +46,6 @@ using winrt::Windows::Networking::Sockets::IWebSocketClosedEventArgs;
 using winrt::Windows::Networking::Sockets::MessageWebSocket;
 using winrt::Windows::Networking::Sockets::SocketMessageType;
 using winrt::Windows::Networking::Sockets::WebSocketClosedEventArgs;
-using winrt::Windows::Security::Cryptography::CryptographicBuffer;
 using winrt::Windows::Security::Cryptography::Certificates::ChainValidationResult;
 using winrt::Windows::Storage::Streams::DataWriter;
 using winrt::Windows::Storage::Streams::DataWriterStoreOperation;
@@ -89,6 +90,33 @@ DispatchQueue GetCurrentOrSerialQueue() noexcept {
 
   return queue;
 }
+
+// Binary messages up to this size leave their decoding buffer to the next one.
+constexpr size_t MaxRetainedBinaryMessageSize = 1024 * 1024;
+
+// Decodes the Base64 `message` into `bytes`, which the resource keeps across its sequential writes, and writes it to
+// `writer`. Returns the number of bytes written.
+size_t WriteBinaryMessage(IDataWriter const &writer, const string &message, vector<uint8_t> &bytes) {
+  bytes.resize(Microsoft::React::Utilities::Base64DecodedMaxSize(message.size()));
+  auto size = Microsoft::React::Utilities::DecodeBase64(message, bytes.data());
+  if (!size) {
+    throw std::invalid_argument("Invalid Base64 binary message");
+  }
+
+  // The writer copies the bytes.
+  writer.WriteBytes(winrt::array_view<const uint8_t>(bytes.data(), bytes.data() + *size));
+
+  if (bytes.capacity() > MaxRetainedBinaryMessageSize) {
+    bytes.clear();
+    bytes.shrink_to_fit();
+  }
+  return *size;
+}
+
+string ReadBinaryMessage(IDataReader const &reader, uint32_t length) {
+  auto buffer = reader.ReadBuffer(length);
+  return Microsoft::React::Utilities::EncodeBase64(buffer);
+}
 } // namespace
 
 namespace Microsoft::React::Networking {
@@ -188,10 +216,7 @@ void WinRTWebSocketResource2::OnMessageReceived(
 
       response = string(CheckedReinterpretCast<char *>(data.data()), data.size());
     } else {
-      auto buffer = reader.ReadBuffer(len);
-      auto data = CryptographicBuffer::EncodeToBase64String(buffer);
-
-      response = winrt::to_string(std::wstring_view(data));
+      response = ReadBinaryMessage(reader, len);
     }
   } catch (hresult_error const &e) {
     return self->Fail(e, ErrorType::Receive);
@@ -295,10 +320,7 @@ IAsyncAction WinRTWebSocketResource2::PerformWrite(string &&message, bool isBina
     if (isBinary) {
       self->m_socket.Control().MessageType(SocketMessageType::Binary);
 
-      auto buffer = CryptographicBuffer::DecodeFromBase64String(winrt::to_hstring(message));
-      if (buffer) {
-        self->m_writer.WriteBuffer(buffer);
-      }
+      WriteBinaryMessage(self->m_writer, message, self->m_binaryMessageBuffer);
     } else {
       self->m_socket.Control().MessageType(SocketMessageType::Utf8);
 
@@ -563,11 +585,7 @@ fire_and_forget WinRTWebSocketResource::PerformWrite(string &&message, bool isBi
     if (isBinaryLocal) {
       self->m_socket.Control().MessageType(SocketMessageType::Binary);
 
-      auto buffer = CryptographicBuffer::DecodeFromBase64String(winrt::to_hstring(messageLocal));
-      if (buffer) {
-        length = buffer.Length();
-        self->m_writer.WriteBuffer(buffer);
-      }
+      length = WriteBinaryMessage(self->m_writer, messageLocal, self->m_binaryMessageBuffer);
     } else {
       self->m_socket.Control().MessageType(SocketMessageType::Utf8);
 
@@ -676,10 +694,7 @@ void WinRTWebSocketResource::Connect(string &&url, const Protocols &protocols, c
 
         response = string(CheckedReinterpretCast<char *>(data.data()), data.size());
       } else {
-        auto buffer = reader.ReadBuffer(len);
-        hstring data = CryptographicBuffer::EncodeToBase64String(buffer);
-
-        response = winrt::to_string(std::wstring_view(data));
+        response = ReadBinaryMessage(reader, len);
       }
 
       if (self->m_readHandler) {
@@ -13,6 +13,7 @@
 #include <future>
 #include <mutex>
 #include <queue>
+#include <vector>
 
 namespace Microsoft::React::Networking {
 
@@ -122,6 +123,8 @@ class WinRTWebSocketResource2 : public IWebSocketResource,
   std::function<void(Error &&)> m_errorHandler;
 
   winrt::Windows::Storage::Streams::IDataWriter m_writer;
+  // Decoded binary messages, reused by the sequenced writes.
+  std::vector<uint8_t> m_binaryMessageBuffer;
 
   void Fail(std::string &&message, ErrorType type) noexcept;
   void Fail(winrt::hresult &&e, ErrorType type) noexcept;
@@ -236,6 +239,8 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
   std::string m_closeReason;
   std::queue<std::pair<std::string, bool>> m_writeQueue;
   std::mutex m_writeQueueMutex;
+  // Decoded binary messages, reused by the writes, which run one at a time on m_dispatchQueue.
+  std::vector<uint8_t> m_binaryMessageBuffer;
 
   std::function<void()> m_connectHandler;
   std::function<void()> m_pingHandler;
@@ -427,7 +427,7 @@ InstanceImpl::InstanceImpl(
           wchar_t tempPath[MAX_PATH];
           if (GetTempPathW(MAX_PATH, tempPath)) {
             preparedScriptStore =
-                std::make_shared<facebook::react::BasePreparedScriptStoreImpl>(winrt::to_string(tempPath));
+                std::make_shared<facebook::react::LruPreparedScriptStore>(winrt::to_string(tempPath));
           }
 
           m_devSettings->jsiRuntimeHolder = std::make_shared<Microsoft::ReactNative::HermesRuntimeHolder>(
@@ -441,7 +441,7 @@ InstanceImpl::InstanceImpl(
           wchar_t tempPath[MAX_PATH];
           if (GetTempPathW(MAX_PATH, tempPath)) {
             preparedScriptStore =
-                std::make_shared<facebook::react::BasePreparedScriptStoreImpl>(winrt::to_string(tempPath));
+                std::make_shared<facebook::react::LruPreparedScriptStore>(winrt::to_string(tempPath));
           }
 
           m_devSettings->jsiRuntimeHolder = std::make_shared<facebook::react::V8JSIRuntimeHolder>(
@@ -459,7 +459,7 @@ InstanceImpl::InstanceImpl(
           wchar_t tempPath[MAX_PATH];
           if (GetTempPathW(MAX_PATH, tempPath)) {
             preparedScriptStore =
-                std::make_shared<facebook::react::BasePreparedScriptStoreImpl>(winrt::to_string(tempPath));
+                std::make_shared<facebook::react::LruPreparedScriptStore>(winrt::to_string(tempPath));
           }
 
           m_devSettings->jsiRuntimeHolder = make_shared<Microsoft::ReactNative::V8RuntimeHolder>(
@@ -6,21 +6,33 @@
 #include <cxxreact/Instance.h>
 #include <cxxreact/TraceSection.h>
 #include <eventWaitHandle/eventWaitHandle.h>
+#include <tracing/tracing.h>
+#include <algorithm>
 #include <cassert>
+#include <utility>
 
 using namespace facebook::react;
 
 namespace Microsoft::ReactNative {
 
 BatchingQueueCallInvoker::BatchingQueueCallInvoker(
-    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread)
-    : m_queueThread(queueThread) {}
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::chrono::milliseconds sliceTimeBudget,
+    size_t maxBatchSize)
+    : m_queueThread(queueThread),
+      m_sliceTimeBudget(sliceTimeBudget),
+      m_maxBatchSize(std::max<size_t>(maxBatchSize, 1)) {}
 
 void BatchingQueueCallInvoker::invokeAsync(
     const std::string &methodName,
     facebook::react::NativeMethodCallFunc &&func) noexcept {
   EnsureQueue();
-  m_taskQueue->emplace_back(std::move(func));
+  m_taskQueue.emplace_back(std::move(func));
+
+  // Do not let a long JS batch accumulate an unbounded amount of work before the queue thread can start on it.
+  if (m_taskQueue.size() >= m_maxBatchSize) {
+    PostBatch();
+  }
 
 // #define TRACK_UI_CALLS
 #ifdef TRACK_UI_CALLS
@@ -32,23 +44,107 @@ void BatchingQueueCallInvoker::invokeAsync(
 }
 
 void BatchingQueueCallInvoker::EnsureQueue() noexcept {
-  if (!m_taskQueue) {
-    m_taskQueue = std::make_shared<WorkItemQueue>();
-    m_taskQueue->reserve(2048);
+  if (m_taskQueue.capacity() == 0) {
+    {
+      std::scoped_lock lock(m_mutex);
+      if (!m_batchPool.empty()) {
+        m_taskQueue = std::move(m_batchPool.back());
+        m_batchPool.pop_back();
+        return;
+      }
+    }
+
+    m_taskQueue.reserve(m_maxBatchSize);
   }
 }
 
 void BatchingQueueCallInvoker::PostBatch() noexcept {
-  if (m_taskQueue) {
-    m_queueThread->runOnQueue([taskQueue{std::move(m_taskQueue)}]() noexcept {
-      TraceSection s1("BatchingQueueCallInvoker::PostBatch");
-      for (auto &task : *taskQueue) {
-        TraceSection s2("BatchingQueueCallInvoker::PostBatch::Task");
-        task();
-        task = nullptr;
-      }
-    });
+  if (m_taskQueue.empty()) {
+    return;
   }
+
+  bool isRunScheduled;
+  {
+    std::scoped_lock lock(m_mutex);
+    m_pendingBatches.push_back(std::move(m_taskQueue));
+    isRunScheduled = std::exchange(m_isRunScheduled, true);
+  }
+
+  // The moved-from vector is in an unspecified state.
+  m_taskQueue = WorkItemQueue{};
+
+  // Batches are always run in order by a single RunBatches task. It is posted only if it is not pending yet.
+  if (!isRunScheduled) {
+    ScheduleRunBatches();
+  }
+}
+
+void BatchingQueueCallInvoker::ScheduleRunBatches() noexcept {
+  m_queueThread->runOnQueue([self = shared_from_this()]() noexcept { self->RunBatches(); });
+}
+
+void BatchingQueueCallInvoker::RunBatches() noexcept {
+  TraceSection s1("BatchingQueueCallInvoker::PostBatch");
+  auto now = std::chrono::steady_clock::now();
+  auto sliceEndTime = now + m_sliceTimeBudget;
+  bool isFirstTask = true;
+  while (TryStartNextBatch()) {
+    auto startTime = now;
+    while (m_runningTaskIndex < m_runningBatch.size() &&
+           (isFirstTask || now < sliceEndTime || m_quitting.load(std::memory_order_relaxed))) {
+      TraceSection s2("BatchingQueueCallInvoker::PostBatch::Task");
+      auto &task = m_runningBatch[m_runningTaskIndex++];
+      task();
+      task = nullptr;
+      isFirstTask = false;
+      now = std::chrono::steady_clock::now();
+    }
+
+    m_runningBatchTime += now - startTime;
+    if (m_runningTaskIndex < m_runningBatch.size()) {
+      // The time slice is over: let the queue thread run other work and continue from the same task later.
+      ScheduleRunBatches();
+      return;
+    }
+
+    FinishRunningBatch();
+  }
+}
+
+bool BatchingQueueCallInvoker::TryStartNextBatch() noexcept {
+  if (m_runningTaskIndex < m_runningBatch.size()) {
+    return true;
+  }
+
+  std::scoped_lock lock(m_mutex);
+  if (m_pendingBatches.empty()) {
+    m_isRunScheduled = false;
+    return false;
+  }
+
+  m_runningBatch = std::move(m_pendingBatches.front());
+  m_pendingBatches.pop_front();
+  m_runningTaskIndex = 0;
+  m_runningBatchTime = {};
+  return true;
+}
+
+void BatchingQueueCallInvoker::FinishRunningBatch() noexcept {
+  facebook::react::tracing::counter(
+      "BatchingQueueCallInvoker::BatchTaskCount", static_cast<int64_t>(m_runningBatch.size()));
+  facebook::react::tracing::counter(
+      "BatchingQueueCallInvoker::BatchExecutionTimeUs",
+      std::chrono::duration_cast<std::chrono::microseconds>(m_runningBatchTime).count());
+
+  m_runningBatch.clear();
+  m_runningTaskIndex = 0;
+
+  std::scoped_lock lock(m_mutex);
+  if (m_batchPool.size() < MaxPooledBatchCount) {
+    m_batchPool.push_back(std::move(m_runningBatch));
+  }
+
+  m_runningBatch = WorkItemQueue{};
 }
 
 void BatchingQueueCallInvoker::onBatchComplete() noexcept {
@@ -56,6 +152,8 @@ void BatchingQueueCallInvoker::onBatchComplete() noexcept {
 }
 
 void BatchingQueueCallInvoker::quitSynchronous() noexcept {
+  // Run the remaining batches without yielding: the slices posted after the queue thread quits would be lost.
+  m_quitting = true;
   PostBatch();
   m_queueThread->quitSynchronous();
 }
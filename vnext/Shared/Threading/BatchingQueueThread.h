@@ -5,6 +5,11 @@
 
 #include <ReactCommon/CallInvoker.h>
 #include <Shared/BatchingMessageQueueThread.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <thread>
 
 namespace facebook::react {
@@ -13,8 +18,21 @@ class Instance;
 
 namespace Microsoft::ReactNative {
 
-struct BatchingQueueCallInvoker : facebook::react::NativeMethodCallInvoker {
-  BatchingQueueCallInvoker(std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread);
+// Collects native calls made during a JS batch and runs them on the queue thread.
+//
+// The calls are handed over to the queue thread in batches: on batch completion or when the batch reaches
+// maxBatchSize calls. The queue thread runs the batches in slices bounded by sliceTimeBudget and yields
+// between slices, so that a long JS batch does not block the queue thread for many frames.
+// The batch vectors are recycled to avoid reallocating them for every batch.
+struct BatchingQueueCallInvoker : facebook::react::NativeMethodCallInvoker,
+                                  std::enable_shared_from_this<BatchingQueueCallInvoker> {
+  static constexpr std::chrono::milliseconds DefaultSliceTimeBudget{8};
+  static constexpr size_t DefaultMaxBatchSize{2048};
+
+  BatchingQueueCallInvoker(
+      std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+      std::chrono::milliseconds sliceTimeBudget = DefaultSliceTimeBudget,
+      size_t maxBatchSize = DefaultMaxBatchSize);
 
   void invokeAsync(const std::string &methodName, facebook::react::NativeMethodCallFunc &&func) noexcept override;
   void EnsureQueue() noexcept;
@@ -23,11 +41,37 @@ struct BatchingQueueCallInvoker : facebook::react::NativeMethodCallInvoker {
   void PostBatch() noexcept;
   void invokeSync(const std::string &methodName, facebook::react::NativeMethodCallFunc &&func) noexcept override;
 
+ private:
+  using WorkItemQueue = std::vector<std::function<void()>>;
+
+  static constexpr size_t MaxPooledBatchCount{4};
+
+  void ScheduleRunBatches() noexcept;
+
+  // Called on the queue thread.
+  void RunBatches() noexcept;
+  bool TryStartNextBatch() noexcept;
+  void FinishRunningBatch() noexcept;
+
  private:
   std::shared_ptr<facebook::react::MessageQueueThread> m_queueThread;
+  const std::chrono::milliseconds m_sliceTimeBudget;
+  const size_t m_maxBatchSize;
+  std::atomic<bool> m_quitting{false};
 
-  using WorkItemQueue = std::vector<std::function<void()>>;
-  std::shared_ptr<WorkItemQueue> m_taskQueue;
+  // The batch that is being collected.
+  WorkItemQueue m_taskQueue;
+
+  // Batches that are handed over to the queue thread and the recycled batch vectors.
+  std::mutex m_mutex;
+  std::deque<WorkItemQueue> m_pendingBatches;
+  std::vector<WorkItemQueue> m_batchPool;
+  bool m_isRunScheduled{false};
+
+  // The batch that is being run by the queue thread.
+  WorkItemQueue m_runningBatch;
+  size_t m_runningTaskIndex{0};
+  std::chrono::steady_clock::duration m_runningBatchTime{};
 };
 
 // Executes the function on the provided UI Dispatcher
@@ -3,9 +3,15 @@
 
 #include "WinRTConversions.h"
 
+#include <utilities.h>
+
 // Standard Library
+#include <limits>
 #include <sstream>
 
+using winrt::Windows::Storage::Streams::Buffer;
+using winrt::Windows::Storage::Streams::IBuffer;
+
 namespace Microsoft::React::Utilities {
 
 std::string HResultToString(winrt::hresult_error const &e) {
@@ -19,4 +25,26 @@ std::string HResultToString(winrt::hresult &&result) {
   return HResultToString(winrt::hresult_error(std::move(result), winrt::hresult_error::from_abi));
 }
 
+IBuffer DecodeBase64ToBuffer(std::string_view base64) {
+  auto capacity = Base64DecodedMaxSize(base64.size());
+  if (capacity > std::numeric_limits<uint32_t>::max()) {
+    return nullptr;
+  }
+
+  Buffer buffer{static_cast<uint32_t>(capacity)};
+  auto size = DecodeBase64(base64, buffer.data());
+  if (!size) {
+    return nullptr;
+  }
+
+  buffer.Length(static_cast<uint32_t>(*size));
+  return buffer;
+}
+
+std::string EncodeBase64(IBuffer const &buffer) {
+  std::string result(Base64EncodedSize(buffer.Length()), '\0');
+  EncodeBase64(buffer.data(), buffer.Length(), result.data());
+  return result;
+}
+
 } // namespace Microsoft::React::Utilities
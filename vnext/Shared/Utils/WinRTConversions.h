@@ -4,12 +4,22 @@
 #pragma once
 
 // Windows API
+#include <winrt/Windows.Storage.Streams.h>
 #include <winrt/base.h>
 
+// Standard Library
+#include <string_view>
+
 namespace Microsoft::React::Utilities {
 
 std::string HResultToString(winrt::hresult_error const &e);
 
 std::string HResultToString(winrt::hresult &&result);
 
+// Decodes `base64` directly into a new buffer, without widening it to an hstring first as
+// CryptographicBuffer::DecodeFromBase64String requires. Returns nullptr when `base64` is not valid Base64.
+winrt::Windows::Storage::Streams::IBuffer DecodeBase64ToBuffer(std::string_view base64);
+
+std::string EncodeBase64(winrt::Windows::Storage::Streams::IBuffer const &buffer);
+
 } // namespace Microsoft::React::Utilities
@@ -174,6 +174,15 @@ void counterJSHook(uint64_t tag, const std::string &profile_name, int value) {
       TraceLoggingInt64(value, "value"));
 }
 
+void counter(const char *name, int64_t value) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "SystraceCounter",
+      TraceLoggingString(name, "profile_name"),
+      TraceLoggingUInt64(TRACE_TAG_REACT_CXX_BRIDGE, "tag"),
+      TraceLoggingInt64(value, "value"));
+}
+
 void initializeJSHooks(jsi::Runtime &runtime, bool isProfiling) {
   // TODO:: Assess the performance impact of hooking up the JS trace events. Especially when the tracing is not enabled.
   // If significant, this should be put under flag based on devsettings
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 // forward declaration.
 namespace facebook {
 namespace jsi {
@@ -15,6 +17,9 @@ void initializeJSHooks(facebook::jsi::Runtime &runtime, bool isProfiling);
 
 void log(const char *msg);
 void error(const char *msg);
+
+// Writes the value of a native counter, e.g. a size or a duration of a unit of work.
+void counter(const char *name, int64_t value);
 } // namespace tracing
 } // namespace react
 } // namespace facebook